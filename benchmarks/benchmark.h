@@ -0,0 +1,99 @@
+#ifndef BLOGATOR_BENCHMARKS_BENCHMARK_H
+#define BLOGATOR_BENCHMARKS_BENCHMARK_H
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace blogator::benchmark {
+    /**
+     * Runs a workload a number of times and reports the best time of all the runs
+     * @tparam F Workload function type
+     * @param name Workload name
+     * @param runs Number of runs
+     * @param fn   Workload
+     * @return Best run time (in ms)
+     */
+    template<typename F> double measure( const std::string &name, size_t runs, F fn ) {
+        auto best = std::chrono::duration<double, std::milli>::max();
+
+        for( size_t i = 0; i < runs; ++i ) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto time  = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start );
+
+            if( time < best )
+                best = time;
+        }
+
+        std::cout << "  " << std::left << std::setw( 40 ) << name << std::right
+                  << std::fixed << std::setprecision( 3 ) << std::setw( 12 ) << best.count() << " ms\n";
+
+        return best.count();
+    }
+
+    /**
+     * Prints the speedup between 2 timings
+     * @param before Time before
+     * @param after  Time after
+     */
+    inline void printSpeedup( double before, double after ) {
+        std::cout << "  " << std::left << std::setw( 40 ) << "speedup" << std::right
+                  << std::fixed << std::setprecision( 2 ) << std::setw( 12 ) << ( before / after ) << " x\n";
+    }
+
+    /**
+     * Prints a per-run count
+     * @param name  Count name
+     * @param count Count value
+     */
+    inline void printCount( const std::string &name, size_t count ) {
+        std::cout << "  " << std::left << std::setw( 40 ) << name << std::right
+                  << std::setw( 12 ) << count << "\n";
+    }
+
+    /**
+     * Prints a rate
+     * @param name  Rate name
+     * @param count Number of items processed
+     * @param time  Time taken (in ms)
+     */
+    inline void printRate( const std::string &name, size_t count, double time ) {
+        std::cout << "  " << std::left << std::setw( 40 ) << name << std::right
+                  << std::fixed << std::setprecision( 0 ) << std::setw( 12 ) << ( count / ( time / 1000 ) ) << " /s\n";
+    }
+
+    /**
+     * Gets the number of `write`-type syscalls made by the process so far (Linux only)
+     * @return Syscall count (0 if not available)
+     */
+    inline size_t writeSyscallCount() {
+        auto in  = std::ifstream( "/proc/self/io" );
+        auto key = std::string();
+        auto val = size_t( 0 );
+
+        while( in >> key >> val ) {
+            if( key == "syscw:" )
+                return val;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Prevents the compiler from optimising away a value
+     * @param val Value
+     */
+    template<typename T> void doNotOptimise( const T &val ) {
+        asm volatile( "" : : "r,m"( val ) : "memory" );
+    }
+
+    void readFilePropertiesScan();
+    void extractRelativePaths();
+    void pageOutput();
+    void batchedOutput();
+}
+
+#endif //BLOGATOR_BENCHMARKS_BENCHMARK_H
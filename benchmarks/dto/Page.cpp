@@ -0,0 +1,77 @@
+#include "../benchmark.h"
+
+#include <vector>
+
+#include "../../src/dto/Page.h"
+
+namespace blogator::benchmark {
+    /**
+     * Creates the lines of a synthetic post page (nav trees + body)
+     * @param n Page seed
+     * @return Lines of the page
+     */
+    static std::vector<std::string> makePageLines( size_t n ) {
+        auto lines = std::vector<std::string>();
+        auto str   = std::to_string( n );
+
+        for( size_t i = 0; i < 1500; ++i ) {
+            if( i % 3 == 0 )
+                lines.emplace_back( "<li><input type=\"checkbox\" id=\"tree_" + std::to_string( i ) + "\"/><label for=\"tree_" + std::to_string( i ) + "\">2020</label>" );
+            else if( i % 3 == 1 )
+                lines.emplace_back( "<li><a href=\"../posts/" + std::to_string( i ) + ".html\">Post " + std::to_string( i ) + "</a></li>" );
+            else
+                lines.emplace_back( "<p>Lorem ipsum dolor sit amet, consectetur adipiscing elit (page " + str + ").</p>" );
+        }
+
+        return lines;
+    }
+
+    /**
+     * Benchmarks the page output
+     * (std::ofstream with `std::endl` line endings vs the buffered dto::Page written on close)
+     */
+    void pageOutput() {
+        const size_t page_count = 100;
+        const size_t runs       = 3;
+        const auto   dir        = std::filesystem::temp_directory_path() / "blogator_bench_page";
+
+        auto lines = std::vector<std::vector<std::string>>();
+
+        for( size_t i = 0; i < page_count; ++i )
+            lines.emplace_back( makePageLines( i ) );
+
+        std::filesystem::create_directories( dir );
+
+        auto syscalls = writeSyscallCount();
+        auto before   = measure( "std::ofstream + std::endl (original)", runs, [&]() {
+            for( size_t i = 0; i < page_count; ++i ) {
+                auto out = std::ofstream( dir / ( std::to_string( i ) + ".html" ) );
+
+                for( const auto &line : lines[ i ] )
+                    out << "\t" << line << std::endl;
+
+                out.close();
+            }
+        } );
+        const auto before_syscalls = ( writeSyscallCount() - syscalls ) / runs;
+
+        syscalls = writeSyscallCount();
+        auto after = measure( "buffered dto::Page", runs, [&]() {
+            for( size_t i = 0; i < page_count; ++i ) {
+                auto page = dto::Page( dir / ( std::to_string( i ) + ".html" ) );
+
+                for( const auto &line : lines[ i ] )
+                    page._out << "\t" << line << "\n";
+
+                page._out.close();
+            }
+        } );
+        const auto after_syscalls = ( writeSyscallCount() - syscalls ) / runs;
+
+        printSpeedup( before, after );
+        printCount( "write syscalls/run (original)", before_syscalls );
+        printCount( "write syscalls/run (buffered)", after_syscalls );
+
+        std::filesystem::remove_all( dir );
+    }
+}
@@ -0,0 +1,94 @@
+#include "../benchmark.h"
+
+#include <regex>
+#include <sstream>
+#include <vector>
+
+#include "../../src/dto/Templates.h"
+
+namespace blogator::benchmark {
+    /**
+     * Creates a synthetic HTML page with relative paths
+     * @param n Page seed
+     * @return HTML DTO of the page
+     */
+    static dto::HTML makePage( size_t n ) {
+        auto html = dto::HTML();
+        auto str  = std::to_string( n );
+
+        html._lines.emplace_back( "<head>" );
+        html._lines.emplace_back( "    <link rel=\"stylesheet\" type=\"text/css\" href=\"../css/blog.css\" /><link rel=\"stylesheet\" href=\"../css/post" + str + ".css\" />" );
+        html._lines.emplace_back( "    <script src=\"../js/main.js\"></script>" );
+        html._lines.emplace_back( "</head>" );
+
+        for( size_t i = 0; i < 60; ++i ) {
+            if( i % 6 == 0 )
+                html._lines.emplace_back( "<p>See <a href=\"../posts/" + std::to_string( i ) + ".html\">this post</a> and <a href=\"https://www.example.com/page.html\">this site</a>.</p>" );
+            else if( i % 9 == 0 )
+                html._lines.emplace_back( "<img src=\"../img/picture " + str + ".png\" alt=\"image\"/><img src=\"../img/thumb.jpeg\"/>" );
+            else
+                html._lines.emplace_back( "<p>Lorem ipsum dolor sit amet, <b>consectetur</b> adipiscing elit, sed do eiusmod tempor incididunt ut labore.</p>" );
+        }
+
+        return html;
+    }
+
+    /**
+     * Benchmarks dto::Templates::extractRelativePaths(..)
+     * (original regex + stringstream rebuild vs the in-place attribute scanner)
+     */
+    void extractRelativePaths() {
+        const size_t page_count = 50;
+        const size_t runs       = 3;
+
+        auto pages = std::vector<dto::HTML>();
+
+        for( size_t i = 0; i < page_count; ++i )
+            pages.emplace_back( makePage( i ) );
+
+        auto before = measure( "regex (original)", runs, [&]() {
+            const auto path_rx = std::regex( R"((.*?<.*?(?:src|href)=")(?!www|http)([^/]{1}[a-zA-Z\%\.\-_\d/\s]+\.[a-zA-Z\d_]{2,4})("))" );
+
+            for( auto page : pages ) {
+                auto   pos    = dto::ConsecutivePathPositions_t();
+                size_t line_i = 0;
+
+                std::string::size_type last_size = 0;
+
+                for( auto &line : page._lines ) {
+                    std::stringstream ss;
+                    auto it = std::sregex_iterator( line.begin(), line.end(), path_rx );
+                    auto substr_start = 0;
+
+                    while( it != std::sregex_iterator() ) {
+                        auto col = substr_start + it->str( 1 ).length() - last_size;
+
+                        pos.insert( std::make_pair( dto::InsertPosition( line_i, col ), it->str( 2 ) ) );
+                        ss << it->str( 1 ) << it->str( 3 );
+
+                        substr_start += it->str( 0 ).length();
+                        last_size     = it->str( 2 ).length();
+                        ++it;
+                    }
+
+                    ss << line.substr( substr_start );
+                    line = ss.str();
+                    last_size = 0;
+                    ++line_i;
+                }
+
+                doNotOptimise( pos );
+                doNotOptimise( page );
+            }
+        } );
+
+        auto after = measure( "in-place attribute scanner", runs, [&]() {
+            for( auto page : pages ) {
+                doNotOptimise( dto::Templates::extractRelativePaths( page ) );
+                doNotOptimise( page );
+            }
+        } );
+
+        printSpeedup( before, after );
+    }
+}
@@ -0,0 +1,69 @@
+#include "../benchmark.h"
+
+#include <vector>
+
+#include "../../src/dto/Page.h"
+#include "../../src/fs/OutputQueue.h"
+
+namespace blogator::benchmark {
+    /**
+     * Benchmarks the page file output backends on many small pages
+     * (exists check + direct write per page vs the name registry + io_uring batches)
+     */
+    void batchedOutput() {
+        const size_t page_count = 20000;
+        const size_t runs       = 3;
+        const auto   dir        = std::filesystem::temp_directory_path() / "blogator_bench_output";
+        const auto   content    = std::string( 2048, 'x' ) + "\n";
+
+        auto &queue = fs::OutputQueue::getInstance();
+        auto  paths = std::vector<std::vector<std::filesystem::path>>(); //fresh directory for each run
+        auto  run   = size_t( 0 );
+
+        for( size_t r = 0; r < runs * 2; ++r ) {
+            const auto run_dir = dir / std::to_string( r );
+            std::filesystem::create_directories( run_dir );
+
+            paths.emplace_back();
+            for( size_t i = 0; i < page_count; ++i )
+                paths.back().emplace_back( run_dir / ( std::to_string( i ) + ".html" ) );
+        }
+
+        queue.configure( fs::OutputQueue::Backend::DIRECT );
+
+        auto before = measure( "exists() + direct writes (original)", runs, [&]() {
+            for( const auto &path : paths[ run++ ] ) {
+                if( std::filesystem::exists( path ) )
+                    return;
+
+                auto page = dto::Page( path );
+                page._out << content;
+                page._out.close();
+            }
+        } );
+
+        if( queue.configure( fs::OutputQueue::Backend::IO_URING ) != fs::OutputQueue::Backend::IO_URING )
+            std::cout << "  (io_uring not available: direct writes)\n";
+
+        auto after = measure( "registry + io_uring batches", runs, [&]() {
+            for( const auto &path : paths[ run++ ] ) {
+                if( !queue.claim( path ) )
+                    return;
+
+                auto page = dto::Page( path );
+                page._out << content;
+                page._out.close();
+            }
+
+            queue.flush();
+        } );
+
+        queue.configure( fs::OutputQueue::Backend::DIRECT );
+
+        printSpeedup( before, after );
+        printRate( "files/s (original)", page_count, before );
+        printRate( "files/s (io_uring)", page_count, after );
+
+        std::filesystem::remove_all( dir );
+    }
+}
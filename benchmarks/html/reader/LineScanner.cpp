@@ -0,0 +1,125 @@
+#include "../../benchmark.h"
+
+#include <deque>
+#include <vector>
+
+#include "../../../src/html/reader/reader.h"
+#include "../../../src/html/reader/LineScanner.h"
+#include "../../../src/dto/TableOfContents.h"
+
+namespace blogator::benchmark {
+    /**
+     * Creates a synthetic post's source
+     * @param n Post seed
+     * @return Lines of the post
+     */
+    static std::vector<std::string> makePost( size_t n ) {
+        auto lines = std::vector<std::string>();
+        auto str   = std::to_string( n );
+
+        lines.emplace_back( "<div class=\"post-header\">" );
+        lines.emplace_back( "    <h1><span class=\"title\">Post number " + str + "</span></h1>" );
+        lines.emplace_back( "    <time datetime=\"2020-01-" + std::to_string( 1 + n % 28 ) + "\">" + str + "</time>" );
+        lines.emplace_back( "    <span class=\"author\">Author " + std::to_string( n % 5 ) + "</span>" );
+        lines.emplace_back( "    <span class=\"tag\">tag" + std::to_string( n % 7 ) + "</span><span class=\"tag\">tag" + std::to_string( n % 3 ) + "</span>" );
+        lines.emplace_back( "</div>" );
+        lines.emplace_back( "<div class=\"auto-toc\"></div>" );
+        lines.emplace_back( "<p><span class=\"summary\">A short summary for post " + str + " with <a href=\"../link.html\">a link</a>.</span></p>" );
+
+        for( size_t i = 0; i < 40; ++i ) {
+            if( i % 8 == 0 )
+                lines.emplace_back( "<h" + std::to_string( 2 + i % 3 ) + ">Section " + std::to_string( i ) + "</h" + std::to_string( 2 + i % 3 ) + ">" );
+            else if( i % 5 == 0 )
+                lines.emplace_back( "<p>Some text with an <img src=\"../img/picture.png\" alt=\"image\"/> and <code>code</code>.</p>" );
+            else
+                lines.emplace_back( "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua." );
+        }
+
+        lines.emplace_back( "</div>" );
+        return lines;
+    }
+
+    /**
+     * Benchmarks the per-line scanning done in indexer::readFileProperties
+     * (original multiple find/regex passes vs the single pass LineScanner)
+     */
+    void readFilePropertiesScan() {
+        const size_t post_count = 200;
+        const size_t runs       = 3;
+
+        auto posts = std::vector<std::vector<std::string>>();
+
+        for( size_t i = 0; i < post_count; ++i )
+            posts.emplace_back( makePost( i ) );
+
+        auto before = measure( "find/regex passes (original)", runs, [&]() {
+            using namespace html::reader;
+
+            for( const auto &post : posts ) {
+                auto toc       = dto::TableOfContents( 3, 1 );
+                auto summaries = std::deque<dto::InsertPosition>();
+                bool title     = false;
+                bool date      = false;
+                size_t line_count = 0;
+
+                for( const auto &line : post ) {
+                    if( !title )
+                        title = !getContentBetween( "<span class=\"title\">", "</span>", line ).empty();
+                    if( !date )
+                        date = !getContentBetween( "<time datetime=\"", "\"", line ).empty();
+
+                    getSummaryPositions( line_count, line, summaries );
+                    toc.findHeading( line_count, line );
+                    toc.findTocBlock( line_count, line, "auto-toc" );
+                    doNotOptimise( getContentsBetween( "<span class=\"author\">", "</span>", line ) );
+                    doNotOptimise( getContentsBetween( "<span class=\"tag\">", "</span>", line ) );
+                    ++line_count;
+                }
+
+                doNotOptimise( summaries );
+                doNotOptimise( toc );
+            }
+        } );
+
+        auto after = measure( "single pass LineScanner", runs, [&]() {
+            using namespace html::reader;
+            using Marker = LineScanner::Marker;
+
+            auto scanner = LineScanner();
+
+            for( const auto &post : posts ) {
+                auto toc       = dto::TableOfContents( 3, 1 );
+                auto summaries = std::deque<dto::InsertPosition>();
+                bool title     = false;
+                bool date      = false;
+                size_t line_count = 0;
+
+                for( const auto &line : post ) {
+                    scanner.scan( line );
+
+                    if( !title && scanner.found( Marker::TITLE ) )
+                        title = !scanner.contentBetween( Marker::TITLE, Marker::SPAN_CLOSE ).empty();
+                    if( !date && scanner.found( Marker::DATE ) )
+                        date = !scanner.contentBetween( Marker::DATE, '"' ).empty();
+
+                    scanner.summaryPositions( line_count, summaries );
+
+                    if( scanner.found( Marker::HEADING ) )
+                        toc.findHeading( line_count, line );
+                    if( scanner.found( Marker::CLASS_ATTR ) )
+                        toc.findTocBlock( line_count, line, "auto-toc" );
+                    if( scanner.found( Marker::AUTHOR ) )
+                        doNotOptimise( scanner.contentsBetween( Marker::AUTHOR, Marker::SPAN_CLOSE ) );
+                    if( scanner.found( Marker::TAG ) )
+                        doNotOptimise( scanner.contentsBetween( Marker::TAG, Marker::SPAN_CLOSE ) );
+                    ++line_count;
+                }
+
+                doNotOptimise( summaries );
+                doNotOptimise( toc );
+            }
+        } );
+
+        printSpeedup( before, after );
+    }
+}
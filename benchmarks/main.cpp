@@ -0,0 +1,21 @@
+#include <iostream>
+
+#include "benchmark.h"
+
+int main() {
+    std::cout << "Blogator benchmarks\n\n";
+
+    std::cout << "[indexer::readFileProperties] per-line marker scanning\n";
+    blogator::benchmark::readFilePropertiesScan();
+
+    std::cout << "\n[dto::Templates::extractRelativePaths] relative path extraction\n";
+    blogator::benchmark::extractRelativePaths();
+
+    std::cout << "\n[dto::Page] page file output\n";
+    blogator::benchmark::pageOutput();
+
+    std::cout << "\n[fs::OutputQueue] page file output backends\n";
+    blogator::benchmark::batchedOutput();
+
+    return 0;
+}
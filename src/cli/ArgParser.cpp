@@ -1,6 +1,7 @@
 #include "ArgParser.h"
 
 #include <iostream>
+#include <limits>
 
 #include "../fs/ConfigReader.h"
 
@@ -43,6 +44,31 @@ blogator::cli::ArgParser::State blogator::cli::ArgParser::parse( int argc, char
                 _display.setShowDebug( true );
                 break;
 
+            case Flag::JOBS: //-j N, --jobs N
+                if( i + 1 >= argc ) {
+                    _display.error( "[CLI] missing job count after: " + str );
+                    error = true;
+                } else if( !setJobCount( std::string( argv[ ++i ] ) ) ) {
+                    error = true;
+                }
+                break;
+
+            case Flag::IO_URING: //-u, --io-uring
+                _io_uring = true;
+                break;
+
+            case Flag::INCREMENTAL: //-i, --incremental
+                _incremental = true;
+                break;
+
+            case Flag::WRITE_IF_CHANGED: //-w, --write-if-changed
+                _write_if_changed = true;
+                break;
+
+            case Flag::STAGE: //-s, --stage
+                _stage = true;
+                break;
+
             case Flag::INVALID:
                 break;
         }
@@ -87,6 +113,46 @@ std::filesystem::path blogator::cli::ArgParser::getTempDirectory() const {
     return std::filesystem::temp_directory_path() / "blogator";
 }
 
+/**
+ * Gets the number of concurrent jobs to use
+ * @return Job count (1 by default)
+ */
+unsigned blogator::cli::ArgParser::getJobCount() const {
+    return _job_count;
+}
+
+/**
+ * Gets the io_uring output backend flag
+ * @return Flag to batch the page file writes as io_uring submissions (false by default)
+ */
+bool blogator::cli::ArgParser::useIOUring() const {
+    return _io_uring;
+}
+
+/**
+ * Gets the incremental build flag
+ * @return Flag to only re-render the outputs affected by the changes since the last run (false by default)
+ */
+bool blogator::cli::ArgParser::useIncrementalBuild() const {
+    return _incremental;
+}
+
+/**
+ * Gets the write-if-changed flag
+ * @return Flag to leave the output files whose content is unchanged untouched (false by default)
+ */
+bool blogator::cli::ArgParser::useWriteIfChanged() const {
+    return _write_if_changed;
+}
+
+/**
+ * Gets the staged publish flag
+ * @return Flag to generate into a staging tree published atomically at the end of the run (false by default)
+ */
+bool blogator::cli::ArgParser::useStagedPublish() const {
+    return _stage;
+}
+
 /**
  * Creates a default configuration file as described in the fs::ConfigReader
  * @return Success in creating the file
@@ -136,6 +202,30 @@ bool blogator::cli::ArgParser::setPath( const std::string &str ) {
     }
 }
 
+/**
+ * Sets the number of concurrent jobs
+ * @param str argument string representing a positive integer
+ * @return Validity of the string
+ */
+bool blogator::cli::ArgParser::setJobCount( const std::string &str ) {
+    try {
+        size_t pos  = 0;
+        auto   jobs = std::stoul( str, &pos );
+
+        if( pos != str.size() || jobs == 0 || jobs > std::numeric_limits<unsigned>::max() ) {
+            _display.error( "[CLI] Job count must be a positive integer: " + str );
+            return false;
+        }
+
+        _job_count = static_cast<unsigned>( jobs );
+        return true;
+
+    } catch( std::exception &e ) {
+        _display.error( "[CLI] Invalid job count: " + str );
+        return false;
+    }
+}
+
 /**
  * Gets the associated Flag enum for a string representing a flag
  * @param str Flag as a string
@@ -163,6 +253,12 @@ void blogator::cli::ArgParser::printHelp() const {
         << "  -h, --help           Displays this information.\n"
         << "  -d, --debug          Turns on the debug messages.\n"
         << "  -c, --create-config  Creates an example config file in the working directory.\n"
+        << "  -j, --jobs N         Number of concurrent jobs to use for the workloads (default: 1).\n"
+        << "  -u, --io-uring       Writes the pages in batches of io_uring submissions (if available).\n"
+        << "  -i, --incremental    Only re-renders the pages affected by the changes since the last run.\n"
+        << "  -w, --write-if-changed\n"
+        << "                       Only writes the files whose content changed and removes the stale ones.\n"
+        << "  -s, --stage          Generates into a staging tree and swaps it with the live files once done.\n"
         << "\n"
         << "<directory>            [optional] Working directory of the site from which to\n"
         << "                       generate the blog. If no path is provided then the working\n"
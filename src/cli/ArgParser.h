@@ -19,7 +19,12 @@ namespace blogator::cli {
 
         friend std::ostream &operator <<( std::ostream &s, const ArgParser &arg_parser ) {
             s << "> Working directory ...: " << arg_parser.getWorkingDirectory() << "\n"
-              << "> Temporary directory .: " << arg_parser.getTempDirectory();
+              << "> Temporary directory .: " << arg_parser.getTempDirectory() << "\n"
+              << "> Job count ...........: " << arg_parser.getJobCount() << "\n"
+              << "> io_uring output .....: " << ( arg_parser.useIOUring() ? "TRUE" : "FALSE" ) << "\n"
+              << "> Incremental build ...: " << ( arg_parser.useIncrementalBuild() ? "TRUE" : "FALSE" ) << "\n"
+              << "> Write if changed ....: " << ( arg_parser.useWriteIfChanged() ? "TRUE" : "FALSE" ) << "\n"
+              << "> Staged publish ......: " << ( arg_parser.useStagedPublish() ? "TRUE" : "FALSE" );
             return s;
         }
 
@@ -27,24 +32,45 @@ namespace blogator::cli {
 
         std::filesystem::path getWorkingDirectory() const;
         std::filesystem::path getTempDirectory() const;
+        unsigned getJobCount() const;
+        bool useIOUring() const;
+        bool useIncrementalBuild() const;
+        bool useWriteIfChanged() const;
+        bool useStagedPublish() const;
 
       private:
-        enum class Flag { INVALID, HELP, CREATE_CONFIG, SHOW_DEBUG_MSGS };
+        enum class Flag { INVALID, HELP, CREATE_CONFIG, SHOW_DEBUG_MSGS, JOBS, IO_URING, INCREMENTAL, WRITE_IF_CHANGED, STAGE };
 
         MsgInterface          &_display;
         std::filesystem::path  _working_dir;
+        unsigned               _job_count        { 1 };
+        bool                   _io_uring         { false };
+        bool                   _incremental      { false };
+        bool                   _write_if_changed { false };
+        bool                   _stage            { false };
 
         const std::unordered_map<std::string, Flag> _flag_lookup = std::unordered_map<std::string, Flag>( {
-            { "-h",              Flag::HELP },
-            { "-?",              Flag::HELP },
-            { "--help",          Flag::HELP },
-            { "-d",              Flag::SHOW_DEBUG_MSGS },
-            { "--debug",         Flag::SHOW_DEBUG_MSGS },
-            { "-c",              Flag::CREATE_CONFIG },
-            { "--create-config", Flag::CREATE_CONFIG }
+            { "-h",                 Flag::HELP },
+            { "-?",                 Flag::HELP },
+            { "--help",             Flag::HELP },
+            { "-d",                 Flag::SHOW_DEBUG_MSGS },
+            { "--debug",            Flag::SHOW_DEBUG_MSGS },
+            { "-c",                 Flag::CREATE_CONFIG },
+            { "--create-config",    Flag::CREATE_CONFIG },
+            { "-j",                 Flag::JOBS },
+            { "--jobs",             Flag::JOBS },
+            { "-u",                 Flag::IO_URING },
+            { "--io-uring",         Flag::IO_URING },
+            { "-i",                 Flag::INCREMENTAL },
+            { "--incremental",      Flag::INCREMENTAL },
+            { "-w",                 Flag::WRITE_IF_CHANGED },
+            { "--write-if-changed", Flag::WRITE_IF_CHANGED },
+            { "-s",                 Flag::STAGE },
+            { "--stage",            Flag::STAGE }
         } );
 
         bool setPath( const std::string & str );
+        bool setJobCount( const std::string & str );
         Flag isFlag( const std::string &str ) const;
 
         void printHelp() const;
@@ -1,5 +1,12 @@
 #include "MsgInterface.h"
 
+namespace blogator::cli {
+    /**
+     * Message buffer of the current thread (nullptr when messages go straight to the display)
+     */
+    thread_local MsgInterface::MsgBuffer_t * thread_buffer = nullptr;
+}
+
 /**
  * Gets the interface instance
  * @return Interface instance
@@ -23,6 +30,13 @@ blogator::cli::MsgInterface::MsgInterface() :
  */
 void blogator::cli::MsgInterface::begin( const std::string & process_name,
                                          const std::string & next_step ) {
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    if( _group_depth > 0 ) {
+        _display_out->update( process_name, ( _total_steps > 0 ? (double) _current_step / (double) _total_steps : 0 ) );
+        return;
+    }
+
     if( _current_step < _total_steps )
         _display_out->done();
 
@@ -42,6 +56,14 @@ void blogator::cli::MsgInterface::begin( const std::string &process_name,
                                          const unsigned &steps,
                                          const std::string &next_step )
 {
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    if( _group_depth > 0 ) { //adds its steps to the group's
+        _total_steps += steps;
+        _display_out->update( process_name, (double) _current_step / (double) _total_steps );
+        return;
+    }
+
     if( _current_step < _total_steps )
         _display_out->done();
 
@@ -56,6 +78,7 @@ void blogator::cli::MsgInterface::begin( const std::string &process_name,
  * @param steps Workload steps to add
  */
 void blogator::cli::MsgInterface::addSteps( const unsigned & steps ) {
+    std::lock_guard<std::mutex> lock( _mutex );
     _total_steps += steps;
 }
 
@@ -64,6 +87,7 @@ void blogator::cli::MsgInterface::addSteps( const unsigned & steps ) {
  * @param msg Step status message
  */
 void blogator::cli::MsgInterface::end( const std::string &msg ) {
+    std::lock_guard<std::mutex> lock( _mutex );
     _current_step = _total_steps;
     _display_out->update( msg, ( double ) _current_step / ( double ) _total_steps );
 }
@@ -73,6 +97,7 @@ void blogator::cli::MsgInterface::end( const std::string &msg ) {
  * @return Progress as a fraction (0-1)
  */
 double blogator::cli::MsgInterface::total() const {
+    std::lock_guard<std::mutex> lock( _mutex );
     return (double) _current_step / (double) _total_steps;
 }
 
@@ -81,6 +106,7 @@ double blogator::cli::MsgInterface::total() const {
  * @return Active state
  */
 bool blogator::cli::MsgInterface::isActive() const {
+    std::lock_guard<std::mutex> lock( _mutex );
     return _current_step > 0 && _current_step <= _total_steps;
 }
 
@@ -88,6 +114,8 @@ bool blogator::cli::MsgInterface::isActive() const {
  * Increments progress by 1
  */
 void blogator::cli::MsgInterface::progress() {
+    std::lock_guard<std::mutex> lock( _mutex );
+
     ++_current_step;
     _display_out->update( (double) _current_step / (double) _total_steps );
 }
@@ -97,6 +125,8 @@ void blogator::cli::MsgInterface::progress() {
  * @param next_step Step description
  */
 void blogator::cli::MsgInterface::progress( const std::string &next_step ) {
+    std::lock_guard<std::mutex> lock( _mutex );
+
     ++_current_step;
     _display_out->update( next_step, (double) _current_step / (double) _total_steps );
 }
@@ -107,6 +137,8 @@ void blogator::cli::MsgInterface::progress( const std::string &next_step ) {
  * @param step_count Increment amount
  */
 void blogator::cli::MsgInterface::progress( const std::string & next_step, const unsigned & step_count ) {
+    std::lock_guard<std::mutex> lock( _mutex );
+
     _current_step += step_count;
     _display_out->update( next_step, (double) _current_step / (double) _total_steps );
 }
@@ -117,11 +149,21 @@ void blogator::cli::MsgInterface::resetLinePos() {
 }
 
 void blogator::cli::MsgInterface::debug( const std::string & msg ) {
-    _display_out->debug( msg );
+    if( thread_buffer != nullptr ) {
+        thread_buffer->emplace_back( BufferedMsg { BufferedMsg::Type::DEBUG, msg } );
+    } else {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _display_out->debug( msg );
+    }
 }
 
 void blogator::cli::MsgInterface::msg( const std::string & msg ) {
-    _display_out->message( msg );
+    if( thread_buffer != nullptr ) {
+        thread_buffer->emplace_back( BufferedMsg { BufferedMsg::Type::MSG, msg } );
+    } else {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _display_out->message( msg );
+    }
 }
 
 void blogator::cli::MsgInterface::msg( const std::string &msg,
@@ -129,18 +171,105 @@ void blogator::cli::MsgInterface::msg( const std::string &msg,
                                        const std::string &yes,
                                        const std::string &no )
 {
+    std::lock_guard<std::mutex> lock( _mutex );
     _display_out->message( msg, cond, yes, no );
 }
 
 void blogator::cli::MsgInterface::warning( const std::string & msg ) {
-    _display_out->warning( msg );
+    if( thread_buffer != nullptr ) {
+        thread_buffer->emplace_back( BufferedMsg { BufferedMsg::Type::WARNING, msg } );
+    } else {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _display_out->warning( msg );
+    }
 }
 
 void blogator::cli::MsgInterface::error( const std::string & msg ) {
-    _display_out->error( msg );
+    if( thread_buffer != nullptr ) {
+        thread_buffer->emplace_back( BufferedMsg { BufferedMsg::Type::ERROR, msg } );
+    } else {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _display_out->error( msg );
+    }
 }
 
 void blogator::cli::MsgInterface::setShowDebug( bool state ) {
     _display_out->setDebug( state );
     _display_out->message( std::string( "Show debug messages: " ) + ( state ? "ON" : "OFF" ) );
+}
+
+/**
+ * Starts aggregating the progress of concurrent workloads into a single progress bar
+ * (the workloads begun whilst grouped add their steps to the group's; nested groups are merged)
+ * @param process_name Name of the grouped workloads
+ */
+void blogator::cli::MsgInterface::beginGroup( const std::string &process_name ) {
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    if( _group_depth++ > 0 )
+        return; //EARLY-RETURN
+
+    if( _current_step < _total_steps )
+        _display_out->done();
+
+    _display_out->flushBuffer();
+    _display_out->newProcess( process_name, "" );
+    _current_step = 0;
+    _total_steps  = 0;
+}
+
+/**
+ * Ends the aggregation of the progress started with `beginGroup(..)`
+ */
+void blogator::cli::MsgInterface::endGroup() {
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    if( _group_depth == 0 || --_group_depth > 0 )
+        return; //EARLY-RETURN
+
+    _current_step = _total_steps;
+    _display_out->update( "DONE", 1 );
+}
+
+/**
+ * Redirects the text messages sent from the calling thread into a buffer so that they can be
+ * flushed to the display later in a deterministic order (progress updates are always sent live)
+ * @param buffer Message buffer (nullptr to send messages straight to the display again)
+ * @return Previous message buffer of the thread (for restoring when buffering is nested)
+ */
+blogator::cli::MsgInterface::MsgBuffer_t * blogator::cli::MsgInterface::setThreadBuffer( MsgBuffer_t *buffer ) {
+    auto *previous = thread_buffer;
+    thread_buffer = buffer;
+    return previous;
+}
+
+/**
+ * Gets the message buffer of the calling thread
+ * @return Message buffer (nullptr when messages are sent straight to the display)
+ */
+blogator::cli::MsgInterface::MsgBuffer_t * blogator::cli::MsgInterface::getThreadBuffer() const {
+    return thread_buffer;
+}
+
+/**
+ * Sends the content of a message buffer to the display in the order it was buffered
+ * @param buffer Message buffer
+ */
+void blogator::cli::MsgInterface::flush( const MsgBuffer_t &buffer ) {
+    for( const auto & m : buffer ) {
+        switch( m.type ) {
+            case BufferedMsg::Type::DEBUG:
+                debug( m.str );
+                break;
+            case BufferedMsg::Type::MSG:
+                msg( m.str );
+                break;
+            case BufferedMsg::Type::WARNING:
+                warning( m.str );
+                break;
+            case BufferedMsg::Type::ERROR:
+                error( m.str );
+                break;
+        }
+    }
 }
\ No newline at end of file
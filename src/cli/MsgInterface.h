@@ -3,13 +3,24 @@
 
 #include <iostream>
 #include <list>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "MsgDisplay.h"
 
 namespace blogator::cli {
     class MsgInterface {
       public:
+        struct BufferedMsg { //progress updates are never buffered
+            enum class Type { DEBUG, MSG, WARNING, ERROR };
+
+            Type        type;
+            std::string str;
+        };
+
+        typedef std::vector<BufferedMsg> MsgBuffer_t;
+
         static MsgInterface & getInstance();
         virtual ~MsgInterface() = default;
 
@@ -33,11 +44,20 @@ namespace blogator::cli {
 
         void setShowDebug( bool state );
 
+        void beginGroup( const std::string &process_name );
+        void endGroup();
+
+        MsgBuffer_t * setThreadBuffer( MsgBuffer_t *buffer );
+        MsgBuffer_t * getThreadBuffer() const;
+        void flush( const MsgBuffer_t &buffer );
+
       private:
         MsgInterface();
         std::unique_ptr<MsgDisplay> _display_out;
+        mutable std::mutex          _mutex;
         unsigned                    _current_step { 0 };
         unsigned                    _total_steps  { 0 };
+        unsigned                    _group_depth  { 0 }; //nesting level of the aggregated progress groups
     };
 }
 
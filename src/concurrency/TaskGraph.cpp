@@ -0,0 +1,158 @@
+#include "TaskGraph.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "../cli/MsgInterface.h"
+
+/**
+ * Adds a task to the graph
+ * @param task         Task
+ * @param dependencies IDs of the tasks that must complete before the task can run
+ * @return ID of the task
+ * @throws std::invalid_argument when a dependency is not a task already in the graph
+ */
+blogator::concurrency::TaskGraph::TaskID_t blogator::concurrency::TaskGraph::add( Task_t task,
+                                                                                  const TaskIDs_t &dependencies )
+{
+    const auto id = _nodes.size();
+
+    for( const auto &dep : dependencies ) {
+        if( dep >= id )
+            throw std::invalid_argument(
+                "[concurrency::TaskGraph::add(..)] Task " + std::to_string( id ) + " "
+                "cannot depend on task " + std::to_string( dep ) + " (not added before it)."
+            );
+    }
+
+    auto &node = _nodes.emplace_back( Node { std::move( task ), {}, 0, nullptr } );
+
+    for( const auto &dep : dependencies ) {
+        _nodes[ dep ].dependents.emplace_back( id );
+        ++node.dependency_count;
+    }
+
+    return id;
+}
+
+/**
+ * Runs all the tasks in the graph
+ * @param jobs          Number of worker threads to use (<= 1 runs everything on the calling thread in insertion order)
+ * @param progress_name Name given to the aggregated progress of the tasks when run concurrently
+ * @throws the exception raised by the first failed task (in insertion order) once all the workers have stopped
+ */
+void blogator::concurrency::TaskGraph::run( unsigned jobs, const std::string &progress_name ) {
+    if( jobs > 1 && _nodes.size() > 1 ) {
+        runConcurrently( jobs, progress_name );
+    } else {
+        for( auto &node : _nodes )
+            node.task();
+    }
+}
+
+/**
+ * Gets the number of tasks in the graph
+ * @return Task count
+ */
+size_t blogator::concurrency::TaskGraph::size() const {
+    return _nodes.size();
+}
+
+/**
+ * Runs all the tasks in the graph on a pool of worker threads
+ * Note: the display messages of each task are buffered and flushed in insertion order on the
+ *       calling thread once all the workers have stopped so they match a serial run. The progress
+ *       of the tasks is shown live, aggregated into a single progress bar.
+ * @param jobs          Number of worker threads to use
+ * @param progress_name Name given to the aggregated progress of the tasks
+ * @throws the exception raised by the first failed task (in insertion order) once all the workers have stopped
+ */
+void blogator::concurrency::TaskGraph::runConcurrently( unsigned jobs, const std::string &progress_name ) {
+    std::mutex               mutex;
+    std::condition_variable  cv;
+    std::set<TaskID_t>       ready;                     //lowest IDs first so the serial order is favoured
+    size_t                   running  = 0;
+    TaskID_t                 failed_i = _nodes.size(); //lowest task ID that failed so far
+    std::vector<std::thread> workers;
+
+    auto &display  = cli::MsgInterface::getInstance();
+    auto  messages = std::vector<cli::MsgInterface::MsgBuffer_t>( _nodes.size() );
+    auto  pending  = std::vector<size_t>( _nodes.size() );
+
+    for( TaskID_t id = 0; id < _nodes.size(); ++id ) {
+        pending[ id ] = _nodes[ id ].dependency_count;
+
+        if( pending[ id ] == 0 )
+            ready.insert( id );
+    }
+
+    auto work = [&]() {
+        auto lock = std::unique_lock<std::mutex>( mutex );
+
+        while( true ) {
+            cv.wait( lock, [&]() { return !ready.empty() || running == 0; } );
+
+            if( ready.empty() ) //nothing running means nothing else will become ready
+                break;
+
+            const auto id = *ready.begin();
+            ready.erase( ready.begin() );
+
+            if( id > failed_i ) //skips what a serial run would not have reached
+                continue;
+
+            ++running;
+            lock.unlock();
+
+            auto &node         = _nodes[ id ];
+            auto *outer_buffer = display.setThreadBuffer( &messages[ id ] );
+
+            try {
+                node.task();
+            } catch( ... ) {
+                node.error = std::current_exception();
+            }
+
+            display.setThreadBuffer( outer_buffer );
+
+            lock.lock();
+            --running;
+
+            if( node.error ) {
+                failed_i = std::min( failed_i, id );
+            } else {
+                for( const auto &dependent : node.dependents ) {
+                    if( --pending[ dependent ] == 0 )
+                        ready.insert( dependent );
+                }
+            }
+
+            cv.notify_all();
+        }
+
+        cv.notify_all();
+    };
+
+    const auto thread_count = std::min<size_t>( jobs, _nodes.size() );
+
+    display.beginGroup( progress_name );
+
+    for( size_t t = 0; t < thread_count; ++t )
+        workers.emplace_back( work );
+
+    for( auto &w : workers )
+        w.join();
+
+    display.endGroup();
+
+    for( const auto &buffer : messages )
+        display.flush( buffer );
+
+    if( failed_i < _nodes.size() )
+        std::rethrow_exception( _nodes[ failed_i ].error );
+}
@@ -0,0 +1,45 @@
+#ifndef BLOGATOR_CONCURRENCY_TASKGRAPH_H
+#define BLOGATOR_CONCURRENCY_TASKGRAPH_H
+
+#include <exception>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace blogator::concurrency {
+    /**
+     * Dependency-aware task scheduler
+     *
+     * Tasks are run on a pool of worker threads as soon as all the tasks they depend on have
+     * completed. Dependencies can only be on tasks added before so the insertion order is always
+     * a valid serial order which is what a single job run uses. When a task fails, its dependents
+     * and any of the tasks added after it that have not started yet are skipped (i.e.: what a
+     * serial run would not have reached). The display messages of the tasks are kept in the
+     * serial order too whilst their progress is shown live as a single progress bar.
+     */
+    class TaskGraph {
+      public:
+        typedef size_t                 TaskID_t;
+        typedef std::vector<TaskID_t>  TaskIDs_t;
+        typedef std::function<void()>  Task_t;
+
+        TaskID_t add( Task_t task, const TaskIDs_t &dependencies = {} );
+        void run( unsigned jobs, const std::string &progress_name = "Running tasks" );
+
+        [[nodiscard]] size_t size() const;
+
+      private:
+        struct Node {
+            Task_t             task;
+            TaskIDs_t          dependents;
+            size_t             dependency_count { 0 };
+            std::exception_ptr error;
+        };
+
+        std::vector<Node> _nodes;
+
+        void runConcurrently( unsigned jobs, const std::string &progress_name );
+    };
+}
+
+#endif //BLOGATOR_CONCURRENCY_TASKGRAPH_H
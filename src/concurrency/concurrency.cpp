@@ -0,0 +1,52 @@
+#include "concurrency.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <exception>
+
+/**
+ * Calls a function for each of the indices in the range [0, count) using a pool of worker threads
+ * Note: the order in which the indices are processed is not guaranteed when jobs > 1
+ * @param jobs  Number of worker threads to use (<= 1 runs everything on the calling thread)
+ * @param count Number of indices to process
+ * @param fn    Function to call for each index
+ * @throws the first exception raised inside 'fn' once all the workers have stopped
+ */
+void blogator::concurrency::forEach( unsigned jobs, size_t count, const std::function<void( size_t )> &fn ) {
+    if( jobs <= 1 || count <= 1 ) {
+        for( size_t i = 0; i < count; ++i )
+            fn( i );
+        return;
+    }
+
+    std::atomic<size_t>      next { 0 };
+    std::exception_ptr       error;
+    std::mutex               error_mtx;
+    std::vector<std::thread> workers;
+
+    auto work = [&]() {
+        for( size_t i = next++; i < count; i = next++ ) {
+            try {
+                fn( i );
+            } catch( ... ) {
+                std::lock_guard<std::mutex> lock( error_mtx );
+                if( !error )
+                    error = std::current_exception();
+                next = count; //stop handing out work
+            }
+        }
+    };
+
+    const auto thread_count = std::min<size_t>( jobs, count );
+
+    for( size_t t = 0; t < thread_count; ++t )
+        workers.emplace_back( work );
+
+    for( auto &w : workers )
+        w.join();
+
+    if( error )
+        std::rethrow_exception( error );
+}
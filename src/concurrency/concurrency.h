@@ -0,0 +1,10 @@
+#ifndef BLOGATOR_CONCURRENCY_H
+#define BLOGATOR_CONCURRENCY_H
+
+#include <functional>
+
+namespace blogator::concurrency {
+    void forEach( unsigned jobs, size_t count, const std::function<void( size_t )> &fn );
+}
+
+#endif //BLOGATOR_CONCURRENCY_H
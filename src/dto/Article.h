@@ -5,31 +5,18 @@
 #include <filesystem>
 #include <set>
 #include <list>
+#include <vector>
 #include <cstring>
 
 #include "DateStamp.h"
 #include "Template.h"
 #include "SeekRange.h"
 #include "TableOfContents.h"
+#include "PostBody.h"
+#include "Dictionary.h"
 
 namespace blogator::dto {
     struct Article {
-        struct CaseInsensitiveCompare {
-            bool operator()( const std::string &lhs, const std::string &rhs ) const {
-                std::string::size_type bound = std::min( lhs.size(), rhs.size() );
-                std::string::size_type i     = 0;
-
-                for( auto it1 = lhs.begin(), it2 = rhs.begin(); i < bound; ++i, ++it1, ++it2 ) {
-                    if( std::tolower( *it1 ) < std::tolower( *it2 ) )
-                        return true;
-                    if( std::tolower( *it2 ) < std::tolower( *it1 ) )
-                        return false;
-                }
-
-                return false;
-            }
-        };
-
         friend std::ostream &operator <<( std::ostream &s, const Article &article ) {
             s << "Article={ \n"
               << "\tNumber.............: " << article._number << "\n"
@@ -37,7 +24,7 @@ namespace blogator::dto {
               << "\tFeatured...........: " << ( article._is_featured ? "yes" : "no" ) << "\n"
               << "\tAuthor(s) .........: ";
             for( const auto &a : article._authors )
-                s << "\"" << a << "\" ";
+                s << "\"" << Dictionary::authors().str( a ) << "\" ";
             if( article._toc ) {
                 s << "\n\tHeading(s).........: \n";
                 for( const auto &h : article._toc->headings() ) {
@@ -53,7 +40,7 @@ namespace blogator::dto {
               << "\tArticle stylesheet.: " << article._paths.css.string() << "\n"
               << "\tTags...............: ";
             for( const auto &t : article._tags )
-                s << "\"" << t << "\" ";
+                s << "\"" << Dictionary::tags().str( t ) << "\" ";
             s << "\n\tSummary rel path(s): ";
             for( const auto &l : article._summary.path_write_pos )
                 s << l.first << " ";
@@ -76,15 +63,22 @@ namespace blogator::dto {
 
         } _summary;
 
+        struct Names { //as written in the post's source (interned then released when the article is merged into the index)
+            std::vector<std::string> authors;
+            std::vector<std::string> tags;
+
+        } _names;
+
         size_t      _number;
         std::string _heading;
         DateStamp   _datestamp;
         bool        _is_featured;
 
-        std::set<std::string, CaseInsensitiveCompare> _authors;
-        std::set<std::string, CaseInsensitiveCompare> _tags;
-        std::shared_ptr<dto::TableOfContents>         _toc; //optional (shared_ptr since the FeatAggregator makes a copy of the article atm)
-        std::shared_ptr<dto::Template>                _cust_index_entry; //cache
+        Dictionary::IDs_t                     _authors; //IDs in dto::Dictionary::authors() (alphabetical order once indexed)
+        Dictionary::IDs_t                     _tags;    //IDs in dto::Dictionary::tags() (alphabetical order once indexed)
+        std::shared_ptr<dto::TableOfContents> _toc; //optional
+        std::shared_ptr<dto::Template>        _cust_index_entry; //cache
+        std::shared_ptr<const dto::PostBody>  _body; //optional (source lines kept from indexing for the post page writer)
     };
 }
 
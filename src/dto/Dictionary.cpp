@@ -0,0 +1,134 @@
+#include "Dictionary.h"
+
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+
+/**
+ * Gets the global tag dictionary
+ * @return Tag dictionary
+ */
+blogator::dto::Dictionary & blogator::dto::Dictionary::tags() {
+    static Dictionary instance;
+    return instance;
+}
+
+/**
+ * Gets the global author dictionary
+ * @return Author dictionary
+ */
+blogator::dto::Dictionary & blogator::dto::Dictionary::authors() {
+    static Dictionary instance;
+    return instance;
+}
+
+/**
+ * Gets the global year dictionary
+ * @return Year dictionary
+ */
+blogator::dto::Dictionary & blogator::dto::Dictionary::years() {
+    static Dictionary instance;
+    return instance;
+}
+
+/**
+ * Interns a string
+ * @param str String
+ * @return ID of the string
+ */
+blogator::dto::Dictionary::ID_t blogator::dto::Dictionary::intern( std::string_view str ) {
+    auto key  = fold( str );
+    auto lock = std::unique_lock<std::shared_mutex>( _mutex );
+    auto it   = _ids.find( key );
+
+    if( it != _ids.end() ) //first spelling is kept for display
+        return it->second;
+
+    const auto id = static_cast<ID_t>( _entries.size() );
+
+    _entries.emplace_back( Entry( { key, std::string( str ) } ) );
+    _ids.emplace( std::move( key ), id );
+
+    return id;
+}
+
+/**
+ * Finds the ID of a string
+ * @param str String
+ * @return ID of the string (empty when not interned)
+ */
+std::optional<blogator::dto::Dictionary::ID_t> blogator::dto::Dictionary::find( std::string_view str ) const {
+    const auto key  = fold( str );
+    auto       lock = std::shared_lock<std::shared_mutex>( _mutex );
+    const auto it   = _ids.find( key );
+
+    if( it != _ids.cend() )
+        return it->second;
+
+    return {};
+}
+
+/**
+ * Gets the display string of an ID
+ * @param id ID
+ * @return Display string
+ * @throws std::out_of_range when the ID is not in the dictionary
+ */
+const std::string & blogator::dto::Dictionary::str( ID_t id ) const {
+    auto lock = std::shared_lock<std::shared_mutex>( _mutex );
+    return _entries.at( id ).str; //entries are never modified or moved once added
+}
+
+/**
+ * Gets the case-folded string of an ID
+ * @param id ID
+ * @return Case-folded string
+ * @throws std::out_of_range when the ID is not in the dictionary
+ */
+const std::string & blogator::dto::Dictionary::key( ID_t id ) const {
+    auto lock = std::shared_lock<std::shared_mutex>( _mutex );
+    return _entries.at( id ).key; //entries are never modified or moved once added
+}
+
+/**
+ * Gets the number of strings interned
+ * @return Dictionary size
+ */
+size_t blogator::dto::Dictionary::size() const {
+    auto lock = std::shared_lock<std::shared_mutex>( _mutex );
+    return _entries.size();
+}
+
+/**
+ * Adds an ID to a collection if not already in it
+ * @param ids Collection of IDs
+ * @param id  ID to add
+ */
+void blogator::dto::Dictionary::add( IDs_t &ids, ID_t id ) {
+    if( std::find( ids.cbegin(), ids.cend(), id ) == ids.cend() )
+        ids.emplace_back( id );
+}
+
+/**
+ * Sorts a collection of IDs alphabetically (case-insensitive) and removes any duplicates
+ * @param ids Collection of IDs
+ */
+void blogator::dto::Dictionary::sort( IDs_t &ids ) const {
+    std::sort( ids.begin(), ids.end(), Order( *this ) );
+    ids.erase( std::unique( ids.begin(), ids.end() ), ids.end() );
+}
+
+/**
+ * Case-folds a string
+ * @param str String
+ * @return Lower case string
+ */
+std::string blogator::dto::Dictionary::fold( std::string_view str ) {
+    auto folded = std::string( str );
+
+    std::transform( folded.begin(), folded.end(), folded.begin(), []( unsigned char c ) {
+        return static_cast<char>( std::tolower( c ) );
+    } );
+
+    return folded;
+}
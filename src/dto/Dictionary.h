@@ -0,0 +1,71 @@
+#ifndef BLOGATOR_DTO_DICTIONARY_H
+#define BLOGATOR_DTO_DICTIONARY_H
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace blogator::dto {
+    /**
+     * Interned case-insensitive string dictionary (i.e.: tags, authors)
+     *
+     * Each distinct string is case-folded once and given a dense integer ID so that everything
+     * downstream can compare/store IDs instead of strings. The display string of an ID is the
+     * first spelling interned for it (the indexer interns the names in the posts' merge order).
+     * Interning, searching and resolving are thread-safe and the strings of an ID never change.
+     */
+    class Dictionary {
+      public:
+        typedef uint32_t          ID_t;
+        typedef std::vector<ID_t> IDs_t;
+
+        /**
+         * Alphabetical (case-insensitive) ordering of IDs
+         */
+        struct Order {
+            explicit Order( const Dictionary &dictionary ) : _dictionary( &dictionary ) {};
+
+            bool operator()( ID_t lhs, ID_t rhs ) const {
+                return _dictionary->key( lhs ) < _dictionary->key( rhs );
+            }
+
+            const Dictionary *_dictionary;
+        };
+
+        Dictionary() = default;
+        Dictionary( const Dictionary & ) = delete;
+        Dictionary &operator =( const Dictionary & ) = delete;
+
+        static Dictionary & tags();
+        static Dictionary & authors();
+        static Dictionary & years();
+
+        ID_t intern( std::string_view str );
+        [[nodiscard]] std::optional<ID_t> find( std::string_view str ) const;
+        [[nodiscard]] const std::string & str( ID_t id ) const;
+        [[nodiscard]] const std::string & key( ID_t id ) const;
+        [[nodiscard]] size_t size() const;
+
+        static void add( IDs_t &ids, ID_t id );
+        void sort( IDs_t &ids ) const;
+
+        static std::string fold( std::string_view str );
+
+      private:
+        struct Entry {
+            std::string key; //case-folded string
+            std::string str; //display string
+        };
+
+        mutable std::shared_mutex             _mutex;
+        std::unordered_map<std::string, ID_t> _ids;     //{K=case-folded string, V=ID}
+        std::deque<Entry>                     _entries; //indexed by ID (deque so references stay valid)
+    };
+}
+
+#endif //BLOGATOR_DTO_DICTIONARY_H
@@ -7,6 +7,7 @@
 #include <map>
 
 #include "Article.h"
+#include "Dictionary.h"
 
 namespace blogator::dto {
     struct Index {
@@ -21,12 +22,24 @@ namespace blogator::dto {
             PagePaths_t         file_names;      //page file name(s) in the list's sub-directory
         };
 
-        typedef std::map<std::string, ListIndexContent, dto::Article::CaseInsensitiveCompare> ListIndexPaths_t;
+        typedef std::map<Dictionary::ID_t, ListIndexContent, Dictionary::Order> ListIndexPaths_t;
 
         struct Category {
-            size_t                   page_count { 0 };
-            ListIndexPaths_t         cats;
-            std::vector<std::string> top; //size set in configuration file
+            explicit Category( const Dictionary &dict ) : dictionary( &dict ), cats( Dictionary::Order( dict ) ) {};
+
+            /**
+             * Gets the display name of a category
+             * @param id Category ID
+             * @return Category name
+             */
+            [[nodiscard]] const std::string & name( Dictionary::ID_t id ) const {
+                return dictionary->str( id );
+            }
+
+            const Dictionary *dictionary;      //dictionary of the category IDs
+            size_t            page_count { 0 };
+            ListIndexPaths_t  cats;            //categories in alphabetical order (case-insensitive)
+            Dictionary::IDs_t top;             //size set in configuration file
         };
 
         //======================================VARIABLES===========================================
@@ -53,9 +66,9 @@ namespace blogator::dto {
         } _paths;
 
         struct Indices {
-            Category byTag;
-            Category byAuthor;
-            Category byYear;
+            Category byTag    { Dictionary::tags() };
+            Category byAuthor { Dictionary::authors() };
+            Category byYear   { Dictionary::years() };
 
             struct ChronoIndex {
                 size_t      page_count;
@@ -65,8 +78,8 @@ namespace blogator::dto {
 
         } _indices;
 
-        Articles_t _articles;
-        Articles_t _featured;
+        Articles_t          _articles;
+        std::vector<size_t> _featured; //indices to the featured articles in _articles (in featured order)
 
         /**
          * Output stream operator
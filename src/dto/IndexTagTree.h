@@ -5,6 +5,7 @@
 #include <vector>
 #include <string>
 #include "HTML.h"
+#include "Dictionary.h"
 
 namespace blogator::dto {
     struct IndexTagTree {
@@ -24,10 +25,10 @@ namespace blogator::dto {
          * -----------------------------------------------------------------------------------------
          * · Used to set the parent tag(s) of an article link in the tag tree to
          *   'checked' (expanded) without having to search all the html lines
-         * K = Tag string
+         * K = Tag ID (dto::Dictionary::tags())
          * V = Tag parent the html tag index
          */
-        typedef std::unordered_map<std::string, HTML::LineIndex_t> ParentTagLineMap_t;
+        typedef std::unordered_map<Dictionary::ID_t, HTML::LineIndex_t> ParentTagLineMap_t;
 
 
         HTML html;
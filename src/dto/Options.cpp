@@ -21,12 +21,14 @@ void blogator::dto::Options::setupAbsolutePaths( const std::filesystem::path & r
     _paths.template_dir     = _paths.root_dir / _folders.templates.root;
     _paths.source_dir       = _paths.root_dir / _folders.source.root;
     _paths.posts_dir        = _paths.root_dir / _folders.posts.root;
+    _paths.posts_ssi_dir    = _paths.root_dir / _folders.posts.ssi;
     _paths.css_dir          = _paths.root_dir / _folders.css.root;
     _paths.index_dir        = _paths.root_dir / _folders.index.root;
     _paths.index_date_dir   = _paths.root_dir / _folders.index.by_date;
     _paths.index_year_dir   = _paths.root_dir / _folders.index.by_year;
     _paths.index_tag_dir    = _paths.root_dir / _folders.index.by_tag;
     _paths.index_author_dir = _paths.root_dir / _folders.index.by_author;
+    _paths.stage_dir        = _paths.root_dir / _folders.stage.root;
 }
 
 /**
@@ -40,6 +42,69 @@ void blogator::dto::Options::setTempPath( const std::filesystem::path &temp_path
     _paths.temp_dir = temp_path;
 }
 
+/**
+ * Sets the number of worker threads to use for the parallelisable workloads
+ * @param jobs Job count
+ */
+void blogator::dto::Options::setJobCount( unsigned jobs ) {
+    auto &display = cli::MsgInterface::getInstance();
+    display.debug( "Job count ...........: " + std::to_string( jobs ) );
+
+    _concurrency.jobs = ( jobs > 0 ? jobs : 1 );
+}
+
+/**
+ * Sets the io_uring output backend flag
+ * @param flag Flag to batch the page file writes as io_uring submissions
+ */
+void blogator::dto::Options::setIOUring( bool flag ) {
+    auto &display = cli::MsgInterface::getInstance();
+    display.debug( std::string( "io_uring output ....: " ) + ( flag ? "TRUE" : "FALSE" ) );
+
+    _output.io_uring = flag;
+}
+
+/**
+ * Sets the incremental build flag
+ * @param flag Flag to only re-render the outputs affected by the inputs changed since the last run
+ */
+void blogator::dto::Options::setIncrementalBuild( bool flag ) {
+    auto &display = cli::MsgInterface::getInstance();
+    display.debug( std::string( "Incremental build ...: " ) + ( flag ? "TRUE" : "FALSE" ) );
+
+    _output.incremental = flag;
+}
+
+/**
+ * Sets the write-if-changed flag
+ * @param flag Flag to only write the output files whose content differs from the one on disk
+ */
+void blogator::dto::Options::setWriteIfChanged( bool flag ) {
+    auto &display = cli::MsgInterface::getInstance();
+    display.debug( std::string( "Write if changed ....: " ) + ( flag ? "TRUE" : "FALSE" ) );
+
+    _output.write_if_changed = flag;
+}
+
+/**
+ * Sets the staged publish flag
+ * @param flag Flag to generate into a staging tree that replaces the live generated files at the end of the run
+ */
+void blogator::dto::Options::setStagedPublish( bool flag ) {
+    auto &display = cli::MsgInterface::getInstance();
+    display.debug( std::string( "Staged publish ......: " ) + ( flag ? "TRUE" : "FALSE" ) );
+
+    _output.staged = flag;
+}
+
+/**
+ * Checks if the generated files of the previous run are purged before generating the new ones
+ * @return Purge state (false for incremental, write-if-changed and staged runs)
+ */
+bool blogator::dto::Options::purgesOutput() const {
+    return !_output.incremental && !_output.write_if_changed && !_output.staged;
+}
+
 /**
  * Gets the software's name string
  * @return Software name
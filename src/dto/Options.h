@@ -22,6 +22,13 @@ namespace blogator::dto {
 
         void setupAbsolutePaths( const std::filesystem::path & root_path );
         void setTempPath( const std::filesystem::path &temp_path );
+        void setJobCount( unsigned jobs );
+        void setIOUring( bool flag );
+        void setIncrementalBuild( bool flag );
+        void setWriteIfChanged( bool flag );
+        void setStagedPublish( bool flag );
+
+        bool purgesOutput() const;
 
         std::string getSoftwareNameStr() const;
         std::string getSoftwareVersionStr() const;
@@ -37,15 +44,31 @@ namespace blogator::dto {
             std::filesystem::path source_dir;       //input directory for generating posts from
             std::filesystem::path template_dir;     //input directory for generating posts from
             std::filesystem::path posts_dir;        //output directory for generated posts
+            std::filesystem::path posts_ssi_dir;    //output directory for the server-side include fragments of the post pages
             std::filesystem::path css_dir;          //CSS directory where all required stylesheets exist
             std::filesystem::path index_dir;        //output directory for the blog/news index
             std::filesystem::path index_date_dir;   //output directory for the blog/news index by dates
             std::filesystem::path index_year_dir;   //output directory for the blog/news index by years
             std::filesystem::path index_tag_dir;    //output directory for the blog/news index by tags
             std::filesystem::path index_author_dir; //output directory for the blog/news index by authors
+            std::filesystem::path stage_dir;        //staging directory mirroring the site's root for the generated files
 
         } _paths;
 
+        struct Concurrency {
+            unsigned jobs { 1 }; //number of worker threads to use for the parallelisable workloads
+
+        } _concurrency;
+
+        struct Output {
+            bool     io_uring         { false }; //batch the page file writes as io_uring submissions
+            unsigned batch_size       { 64 };    //number of pages per io_uring batch
+            bool     incremental      { false }; //only re-render the outputs whose inputs changed since the last run (no purge)
+            bool     write_if_changed { false }; //leave the files whose content is unchanged untouched (no purge)
+            bool     staged           { false }; //generate into a staging tree published at the end of the run (no purge)
+
+        } _output;
+
         struct RelPaths { //Relative directory i/o paths structure
             struct Source { //IN for all posts and templates
                 const std::filesystem::path root = "source";
@@ -65,12 +88,17 @@ namespace blogator::dto {
 
             struct Posts { //OUT of processed posts
                 const std::filesystem::path root = "posts";
+                const std::filesystem::path ssi  = "posts/ssi";
             } posts;
 
             struct CSS { //IN for stylesheets
                 const std::filesystem::path root = "css";
             } css;
 
+            struct Stage { //OUT of a staged run (swapped with the live files when published)
+                const std::filesystem::path root = ".blogator-stage";
+            } stage;
+
         } _folders;
 
         struct FileNames {
@@ -78,6 +106,8 @@ namespace blogator::dto {
             const std::filesystem::path year_list   = "years.html";
             const std::filesystem::path tag_list    = "tags.html";
             const std::filesystem::path author_list = "authors.html";
+            const std::filesystem::path ssi_dates   = "index-pane-dates.html";
+            const std::filesystem::path ssi_tags    = "index-pane-tags.html";
 
         } _filenames;
 
@@ -87,9 +117,17 @@ namespace blogator::dto {
         } _templates;
 
         struct Posts {
-            bool build_future    = false;
-            bool safe_purge      = true;
-            bool adapt_rel_paths = false;
+            enum class FileNames {
+                NUMBER,      //position in the chronological order (e.g.: '12.html')
+                SOURCE_PATH, //slug of the source file's path (e.g.: 'news--my-post.html' for 'source/news/my-post.html')
+                TITLE,       //slug of the post's title + source path hash (e.g.: 'my-first-post-70bc3e.html')
+            };
+
+            bool      build_future    = false;
+            bool      safe_purge      = true;
+            bool      adapt_rel_paths = false;
+            bool      cache           = true;              //persistent cache of the indexed posts' properties (in the temp directory)
+            FileNames file_names      = FileNames::NUMBER; //naming of the post pages' output files
 
             struct ToC {
                 int         generate_toc = 0;
@@ -99,6 +137,11 @@ namespace blogator::dto {
 
             } toc;
 
+            struct SSI { //server-side includes
+                bool        index_panes      = false;                 //write the index trees once and include them in the post pages
+                std::string current_post_css = "font-weight: bold;"; //style declarations for the current post's links in the included trees
+            } ssi;
+
             struct CSS {
                 std::string toc = "auto-toc"; //Table of Contents
             } block_classes;
@@ -111,6 +154,7 @@ namespace blogator::dto {
             std::string summary_pad_end    { "" };
             std::string featured_css_class { "" };
             size_t      items_per_page     { 10 };    //number of posts-per-page in the indices
+            bool        stable_pagination  { false }; //pages anchored at the oldest post (only the newest page changes with new posts)
             bool        index_by_year      { false }; //flag to create a year based index
             bool        index_by_tag       { true  }; //flag to create a tag based index
             bool        index_by_author    { false }; //flag to create a author based index
@@ -0,0 +1,334 @@
+#include "Page.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+
+#include "../fs/OutputQueue.h"
+
+/**
+ * Constructor (opens/truncates the file or, when the output queue is deferred, defers it to the queue)
+ * @param path      File path
+ * @param open_file Flag to open the file (memory buffer only when false)
+ */
+blogator::dto::PageStream::PageStream( const std::filesystem::path &path, bool open_file ) :
+    std::ostream( nullptr ),
+    _fd( -1 )
+{
+    rdbuf( &_buffer );
+
+    if( open_file && fs::OutputQueue::getInstance().deferred() )
+        _queued_path = path;
+    else if( open_file )
+        _fd = ::open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666 );
+
+    if( open_file && _fd < 0 && _queued_path.empty() )
+        setstate( std::ios_base::failbit );
+}
+
+/**
+ * Destructor (writes the buffered content if not already closed)
+ */
+blogator::dto::PageStream::~PageStream() {
+    if( is_open() )
+        close();
+}
+
+/**
+ * Gets the file open state
+ * @return Open state
+ */
+bool blogator::dto::PageStream::is_open() const {
+    return _fd >= 0 || !_queued_path.empty();
+}
+
+/**
+ * Gets the content buffered so far
+ * @return Buffered content (since the last file appended)
+ */
+std::string_view blogator::dto::PageStream::view() const {
+    return _buffer.view();
+}
+
+/**
+ * Appends the content of a file verbatim without going through the buffer
+ * (the buffered content is written out first and the file is copied kernel-side)
+ * @param path          Path of the file to append
+ * @param complete_line Flag to add a line feed after the content when it does not end with one
+ * @return Appended state (false when the page is not backed by an open file or the file cannot be opened
+ *         or is too small to be worth it: nothing is done and the content must be streamed instead)
+ */
+bool blogator::dto::PageStream::appendFile( const std::filesystem::path &path, bool complete_line ) {
+    if( _fd < 0 || !good() )
+        return false;
+
+    const int in_fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+
+    if( in_fd < 0 )
+        return false;
+
+    struct stat in_stat {};
+
+    if( ::fstat( in_fd, &in_stat ) != 0 || !S_ISREG( in_stat.st_mode ) ||
+        static_cast<size_t>( in_stat.st_size ) < KERNEL_COPY_MIN_SIZE )
+    {
+        ::close( in_fd );
+        return false;
+    }
+
+    if( writeAll( _fd, _buffer.view() ) && copyAll( in_fd, _fd ) ) {
+        _buffer.clear();
+
+        char  last   = '\n';
+        off_t offset = ::lseek( in_fd, 0, SEEK_CUR );
+
+        if( complete_line && offset > 0 && ::pread( in_fd, &last, 1, offset - 1 ) == 1 && last != '\n' )
+            put( '\n' );
+
+    } else {
+        _buffer.clear();
+        setstate( std::ios_base::badbit );
+    }
+
+    ::close( in_fd );
+    return true;
+}
+
+/**
+ * Writes the buffered content to the file and closes it (or hands it to the output queue)
+ */
+void blogator::dto::PageStream::close() {
+    if( !is_open() ) {
+        setstate( std::ios_base::failbit );
+        return;
+    }
+
+    if( !_queued_path.empty() ) {
+        fs::OutputQueue::getInstance().push( std::move( _queued_path ), std::string( _buffer.view() ) );
+        _queued_path.clear();
+        return;
+    }
+
+    const auto written = writeAll( _fd, _buffer.view() );
+
+    if( ::close( _fd ) != 0 || !written )
+        setstate( std::ios_base::badbit );
+
+    _fd = -1;
+}
+
+/**
+ * Writes data to a file descriptor (retries on partial writes/interrupts)
+ * @param fd   File descriptor
+ * @param data Data to write
+ * @return Success
+ */
+bool blogator::dto::PageStream::writeAll( int fd, std::string_view data ) {
+    while( !data.empty() ) {
+        const auto n = ::write( fd, data.data(), data.size() );
+
+        if( n < 0 ) {
+            if( errno == EINTR )
+                continue;
+
+            return false;
+        }
+
+        data.remove_prefix( static_cast<size_t>( n ) );
+    }
+
+    return true;
+}
+
+/**
+ * Copies the rest of a file into another from their current offsets
+ * (`copy_file_range`, falling back to `sendfile` then to read/write where not supported)
+ * @param in_fd  Source file descriptor
+ * @param out_fd Target file descriptor
+ * @return Success
+ */
+bool blogator::dto::PageStream::copyAll( int in_fd, int out_fd ) {
+    static constexpr size_t CHUNK_SIZE = 1024 * 1024 * 1024;
+
+    const auto unsupported = []( int error ) {
+        return error == ENOSYS || error == EXDEV || error == EINVAL || error == EOPNOTSUPP;
+    };
+
+    for( ;; ) { //copy_file_range(..)
+        const auto n = ::copy_file_range( in_fd, nullptr, out_fd, nullptr, CHUNK_SIZE, 0 );
+
+        if( n == 0 )
+            return true;
+
+        if( n < 0 ) {
+            if( errno == EINTR )
+                continue;
+            if( unsupported( errno ) )
+                break;
+
+            return false;
+        }
+    }
+
+    for( ;; ) { //sendfile(..)
+        const auto n = ::sendfile( out_fd, in_fd, nullptr, CHUNK_SIZE );
+
+        if( n == 0 )
+            return true;
+
+        if( n < 0 ) {
+            if( errno == EINTR )
+                continue;
+            if( unsupported( errno ) )
+                break;
+
+            return false;
+        }
+    }
+
+    auto buffer = std::vector<char>( 64 * 1024 );
+
+    for( ;; ) { //read(..)/write(..)
+        const auto n = ::read( in_fd, buffer.data(), buffer.size() );
+
+        if( n == 0 )
+            return true;
+
+        if( n < 0 ) {
+            if( errno == EINTR )
+                continue;
+
+            return false;
+        }
+
+        if( !writeAll( out_fd, std::string_view( buffer.data(), static_cast<size_t>( n ) ) ) )
+            return false;
+    }
+}
+
+/**
+ * Constructor (takes a buffer from the thread's pool)
+ */
+blogator::dto::PageStream::Buffer::Buffer() {
+    auto &buffers = pool();
+
+    if( !buffers.empty() ) {
+        _buffer = std::move( buffers.back() );
+        buffers.pop_back();
+    }
+
+    if( _buffer.size() < INITIAL_CAPACITY )
+        _buffer.resize( INITIAL_CAPACITY );
+
+    setp( _buffer.data(), _buffer.data() + _buffer.size() );
+}
+
+/**
+ * Destructor (returns the buffer to the thread's pool)
+ */
+blogator::dto::PageStream::Buffer::~Buffer() {
+    auto &buffers = pool();
+
+    if( buffers.size() < POOL_CAPACITY && _buffer.capacity() <= RETAIN_CAPACITY )
+        buffers.emplace_back( std::move( _buffer ) ); //stale content is overwritten by the next user
+}
+
+/**
+ * Gets the content buffered so far
+ * @return Buffered content
+ */
+std::string_view blogator::dto::PageStream::Buffer::view() const {
+    return std::string_view( pbase(), static_cast<size_t>( pptr() - pbase() ) );
+}
+
+/**
+ * Discards the content buffered so far
+ */
+void blogator::dto::PageStream::Buffer::clear() {
+    setp( _buffer.data(), _buffer.data() + _buffer.size() );
+}
+
+/**
+ * Puts a character in the buffer when the put area is full
+ * @param c Character
+ * @return Character or EOF (no-op)
+ */
+blogator::dto::PageStream::Buffer::int_type blogator::dto::PageStream::Buffer::overflow( int_type c ) {
+    if( traits_type::eq_int_type( c, traits_type::eof() ) )
+        return traits_type::not_eof( c );
+
+    grow( 1 );
+    *pptr() = traits_type::to_char_type( c );
+    pbump( 1 );
+
+    return c;
+}
+
+/**
+ * Puts a sequence of characters in the buffer
+ * @param s Characters
+ * @param n Number of characters
+ * @return Number of characters put
+ */
+std::streamsize blogator::dto::PageStream::Buffer::xsputn( const char_type *s, std::streamsize n ) {
+    if( n <= 0 )
+        return 0;
+
+    const auto count = static_cast<size_t>( n );
+
+    if( static_cast<size_t>( epptr() - pptr() ) < count )
+        grow( count );
+
+    std::copy( s, s + count, pptr() );
+    pbump( static_cast<int>( n ) );
+
+    return n;
+}
+
+/**
+ * Synchronises with the file (no-op as content is only written on close)
+ * @return Success (0)
+ */
+int blogator::dto::PageStream::Buffer::sync() {
+    return 0;
+}
+
+/**
+ * Grows the buffer
+ * @param min_free Minimum free space required after the content
+ */
+void blogator::dto::PageStream::Buffer::grow( size_t min_free ) {
+    const auto used = static_cast<size_t>( pptr() - pbase() );
+
+    _buffer.resize( std::max( _buffer.size() * 2, used + min_free ) );
+    setp( _buffer.data(), _buffer.data() + _buffer.size() );
+
+    for( auto n = used; n > 0; ) { //pbump(..) takes an int
+        const auto step = std::min<size_t>( n, std::numeric_limits<int>::max() );
+        pbump( static_cast<int>( step ) );
+        n -= step;
+    }
+}
+
+/**
+ * Gets the calling thread's pool of buffers
+ * @return Buffer pool
+ */
+std::vector<std::string> & blogator::dto::PageStream::Buffer::pool() {
+    thread_local std::vector<std::string> buffers;
+    return buffers;
+}
+
+/**
+ * Constructor (opens/truncates the page's file)
+ * @param abs_path  Absolute path of the page's file
+ * @param open_file Flag to open the file (memory buffer only when false)
+ */
+blogator::dto::Page::Page( std::filesystem::path abs_path, bool open_file ) :
+    _abs_path( std::move( abs_path ) ),
+    _out( _abs_path, open_file )
+{}
@@ -1,14 +1,84 @@
 #ifndef BLOGATOR_PAGE_H
 #define BLOGATOR_PAGE_H
 
-#include <fstream>
 #include <filesystem>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace blogator::dto {
+    /**
+     * Output stream of a page
+     *
+     * The page is assembled in a growable contiguous memory buffer (taken from a per-thread pool)
+     * and written to the file with a single `write` call when the stream is closed. Flushing the
+     * stream (i.e.: `std::endl`) does not touch the file. Large files appended verbatim are copied
+     * kernel-side into the page's file after what has been buffered so far. When the output queue
+     * is deferred (batched or write-if-changed), the file is not opened and the content is handed
+     * over to the queue on close.
+     */
+    class PageStream : public std::ostream {
+      public:
+        explicit PageStream( const std::filesystem::path &path, bool open_file = true );
+        PageStream( const PageStream & ) = delete;
+        ~PageStream() override;
+
+        PageStream & operator =( const PageStream & ) = delete;
+
+        [[nodiscard]] bool is_open() const;
+        [[nodiscard]] std::string_view view() const;
+        bool appendFile( const std::filesystem::path &path, bool complete_line = false );
+        void close();
+
+        static constexpr size_t KERNEL_COPY_MIN_SIZE = 64 * 1024; //smallest file worth copying kernel-side
+
+      private:
+        /**
+         * Growable memory buffer backing the stream
+         */
+        class Buffer : public std::streambuf {
+          public:
+            Buffer();
+            ~Buffer() override;
+
+            [[nodiscard]] std::string_view view() const;
+            void clear();
+
+          protected:
+            int_type overflow( int_type c ) override;
+            std::streamsize xsputn( const char_type *s, std::streamsize n ) override;
+            int sync() override;
+
+          private:
+            static constexpr size_t INITIAL_CAPACITY = 64 * 1024;
+            static constexpr size_t POOL_CAPACITY    = 4;
+            static constexpr size_t RETAIN_CAPACITY  = 4 * 1024 * 1024;
+
+            std::string _buffer;
+
+            void grow( size_t min_free );
+
+            static std::vector<std::string> & pool();
+        };
+
+        int                   _fd;
+        std::filesystem::path _queued_path; //path of the page to hand to the output queue (empty when not queued)
+        Buffer                _buffer;
+
+        static bool writeAll( int fd, std::string_view data );
+        static bool copyAll( int in_fd, int out_fd );
+    };
+
+    /**
+     * Output page (can be kept in memory only for assembling fragments meant for the given path)
+     */
     struct Page {
+        explicit Page( std::filesystem::path abs_path, bool open_file = true );
+
         std::filesystem::path _abs_path;
-        std::ofstream         _out;
+        PageStream            _out;
     };
 }
 
-#endif //BLOGATOR_PAGE_H
\ No newline at end of file
+#endif //BLOGATOR_PAGE_H
@@ -0,0 +1,83 @@
+#include "PatchableHTML.h"
+
+#include <algorithm>
+
+/**
+ * Constructor
+ * @param html   HTML lines
+ * @param indent Space to place before each of the lines (i.e.: html indent)
+ */
+blogator::dto::PatchableHTML::PatchableHTML( const HTML &html, const std::string &indent ) {
+    static const std::string checkbox_tag = "<input type=\"checkbox\"";
+    static const std::string link_tag     = "<a ";
+
+    std::string::size_type size = 0;
+    for( const auto &line : html._lines )
+        size += indent.size() + line.size() + 1;
+
+    _buffer.reserve( size );
+    _checkbox_pos.reserve( html._lines.size() );
+    _link_pos.reserve( html._lines.size() );
+
+    for( const auto &line : html._lines ) {
+        const auto offset   = _buffer.size() + indent.size();
+        const auto checkbox = line.find( checkbox_tag );
+        const auto link     = line.find( link_tag );
+
+        _checkbox_pos.emplace_back( checkbox == std::string::npos ? std::string::npos : offset + checkbox + checkbox_tag.size() );
+        _link_pos.emplace_back( link == std::string::npos ? std::string::npos : offset + link + link_tag.size() );
+
+        _buffer.append( indent ).append( line ).append( "\n" );
+    }
+}
+
+/**
+ * Writes the html with states set on some of its lines
+ * (a line listed as both a checkbox and a link line only gets the checkbox state)
+ * @param out            Output stream
+ * @param checkbox_lines Lines where the first checkbox is set to 'checked'
+ * @param link_lines     Lines where the first link is given the 'current-post' class
+ */
+void blogator::dto::PatchableHTML::write( std::ostream &out,
+                                          const LineIndices_t &checkbox_lines,
+                                          const LineIndices_t &link_lines ) const
+{
+    static const std::string checkbox_patch = " checked ";
+    static const std::string link_patch     = "class=\"current-post\" ";
+
+    auto patches = std::vector<std::pair<std::string::size_type, const std::string *>>();
+
+    for( const auto &i : checkbox_lines ) {
+        if( i < _checkbox_pos.size() && _checkbox_pos[ i ] != std::string::npos )
+            patches.emplace_back( _checkbox_pos[ i ], &checkbox_patch );
+    }
+
+    for( const auto &i : link_lines ) {
+        if( i < _link_pos.size() && _link_pos[ i ] != std::string::npos &&
+            std::find( checkbox_lines.cbegin(), checkbox_lines.cend(), i ) == checkbox_lines.cend() )
+        {
+            patches.emplace_back( _link_pos[ i ], &link_patch );
+        }
+    }
+
+    std::sort( patches.begin(), patches.end() );
+    patches.erase( std::unique( patches.begin(), patches.end() ), patches.end() );
+
+    std::string::size_type pos = 0;
+
+    for( const auto &patch : patches ) {
+        out.write( _buffer.data() + pos, static_cast<std::streamsize>( patch.first - pos ) );
+        out << *patch.second;
+        pos = patch.first;
+    }
+
+    out.write( _buffer.data() + pos, static_cast<std::streamsize>( _buffer.size() - pos ) );
+}
+
+/**
+ * Gets the pre-rendered html
+ * @return HTML buffer (without any patches)
+ */
+const std::string & blogator::dto::PatchableHTML::buffer() const {
+    return _buffer;
+}
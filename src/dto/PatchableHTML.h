@@ -0,0 +1,35 @@
+#ifndef BLOGATOR_DTO_PATCHABLEHTML_H
+#define BLOGATOR_DTO_PATCHABLEHTML_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "HTML.h"
+
+namespace blogator::dto {
+    /**
+     * Pre-rendered (indented) html lines with the byte offsets of their patch points recorded
+     *
+     * Used for the html blocks shared by many pages that only differ by a few states being set
+     * (i.e.: the checkboxes to 'check' and the links to mark as the current post in a post page's
+     * index trees). Writing it out is a copy of the buffer with the patches spliced in.
+     */
+    class PatchableHTML {
+      public:
+        typedef std::vector<HTML::LineIndex_t> LineIndices_t;
+
+        PatchableHTML( const HTML &html, const std::string &indent );
+
+        void write( std::ostream &out, const LineIndices_t &checkbox_lines, const LineIndices_t &link_lines ) const;
+
+        [[nodiscard]] const std::string & buffer() const;
+
+      private:
+        std::string                         _buffer;       //indented html lines back-to-back
+        std::vector<std::string::size_type> _checkbox_pos; //offset after the first '<input type="checkbox"' of each line (npos when none)
+        std::vector<std::string::size_type> _link_pos;     //offset after the first '<a ' of each line (npos when none)
+    };
+}
+
+#endif //BLOGATOR_DTO_PATCHABLEHTML_H
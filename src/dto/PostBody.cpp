@@ -0,0 +1,53 @@
+#include "PostBody.h"
+
+#include "Templates.h"
+
+/**
+ * Constructor
+ * @param html          Source lines of the post (relative paths are removed from them when extracted)
+ * @param extract_paths Flag to extract the relative paths found in the lines
+ */
+blogator::dto::PostBody::PostBody( HTML &html, bool extract_paths ) {
+    if( extract_paths )
+        path_write_pos = Templates::extractRelativePaths( html );
+
+    std::string::size_type size = 0;
+    for( const auto &l : html._lines )
+        size += l.size();
+
+    buffer.reserve( size );
+    line_ends.reserve( html._lines.size() );
+
+    for( const auto &l : html._lines )
+        appendLine( l );
+}
+
+/**
+ * Appends a line to the end of the body
+ * @param line Line (without line break)
+ */
+void blogator::dto::PostBody::appendLine( std::string_view line ) {
+    buffer.append( line );
+    line_ends.emplace_back( buffer.size() );
+}
+
+/**
+ * Gets the number of lines in the body
+ * @return Line count
+ */
+size_t blogator::dto::PostBody::lineCount() const {
+    return line_ends.size();
+}
+
+/**
+ * Gets a line of the body
+ * @param i Line index
+ * @return View of the line in the buffer
+ * @throws std::out_of_range when the index is out of range
+ */
+std::string_view blogator::dto::PostBody::line( size_t i ) const {
+    const auto begin = ( i == 0 ? 0 : line_ends.at( i - 1 ) );
+    const auto end   = line_ends.at( i );
+
+    return std::string_view( buffer ).substr( begin, end - begin );
+}
@@ -0,0 +1,31 @@
+#ifndef BLOGATOR_DTO_POSTBODY_H
+#define BLOGATOR_DTO_POSTBODY_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "HTML.h"
+#include "InsertPosition.h"
+
+namespace blogator::dto {
+    /**
+     * Compact form of a post's source lines kept from indexing for the post page writer
+     * (lines stored back-to-back in a single buffer with any relative paths already extracted)
+     */
+    struct PostBody {
+        PostBody() = default;
+        PostBody( HTML &html, bool extract_paths );
+
+        void appendLine( std::string_view line );
+
+        [[nodiscard]] size_t lineCount() const;
+        [[nodiscard]] std::string_view line( size_t i ) const;
+
+        std::string                         buffer;         //Line characters (without line breaks)
+        std::vector<std::string::size_type> line_ends;      //Buffer offset of the end of each line
+        ConsecutivePathPositions_t          path_write_pos; //Relative paths extracted from the lines
+    };
+}
+
+#endif //BLOGATOR_DTO_POSTBODY_H
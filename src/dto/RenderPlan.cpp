@@ -0,0 +1,77 @@
+#include "RenderPlan.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "Template.h"
+
+/**
+ * Constructor (compiles the template's html and insertion points into a plan)
+ * @param source Template with its insertion points already located
+ */
+blogator::dto::RenderPlan::RenderPlan( const Template &source ) :
+    src( source.src )
+{
+    if( !source.html )
+        return;
+
+    const auto &html     = *source.html;
+    auto        block_it = source.block_write_pos.cbegin();
+    auto        path_it  = source.path_write_pos.cbegin();
+
+    std::string::size_type size = 0;
+    for( const auto &l : html._lines )
+        size += l.size();
+
+    text.reserve( size );
+    lines.reserve( html._lines.size() );
+
+    for( size_t line_i = 0; line_i < html._lines.size(); ++line_i ) {
+        const auto &str    = html._lines[ line_i ];
+        const auto  offset = text.size();
+        auto       &line   = lines.emplace_back( Line( { segments.size(), 0, "", "" } ) );
+
+        auto hasBlock = [&]() { return ( block_it != source.block_write_pos.cend() && block_it->first.line == line_i ); };
+        auto hasPath  = [&]() { return ( path_it  != source.path_write_pos.cend()  && path_it->first.line  == line_i ); };
+
+        text.append( str );
+
+        std::string::size_type col = 0;
+
+        while( hasBlock() || hasPath() ) {
+            const bool block_first = hasBlock() && ( !hasPath() || block_it->first.col < path_it->first.col );
+            const auto slot_col    = std::min( std::max( col, ( block_first ? block_it->first.col : path_it->first.col ) ), str.size() );
+
+            if( block_first ) {
+                segments.emplace_back( Segment( { offset + col, slot_col - col, SlotType::BLOCK, blocks.size() } ) );
+                blocks.emplace_back( block_it->second );
+                ++block_it;
+            } else {
+                segments.emplace_back( Segment( { offset + col, slot_col - col, SlotType::PATH, paths.size() } ) );
+                paths.emplace_back( path_it->second );
+                ++path_it;
+            }
+
+            col = slot_col;
+        }
+
+        segments.emplace_back( Segment( { offset + col, str.size() - col, SlotType::NONE, 0 } ) );
+        line.end = segments.size();
+
+        if( line.hasSlots() ) {
+            const auto char_it = std::find_if( str.cbegin(), str.cend(), []( char c ) { return !isspace( c ); } );
+
+            line.indent       = std::string( str.cbegin(), char_it );
+            line.block_indent = line.indent + "\t";
+        }
+    }
+}
+
+/**
+ * Gets the literal span of a segment
+ * @param segment Segment of the plan
+ * @return Literal characters
+ */
+std::string_view blogator::dto::RenderPlan::literal( const Segment &segment ) const {
+    return std::string_view( text ).substr( segment.begin, segment.length );
+}
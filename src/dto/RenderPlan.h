@@ -0,0 +1,53 @@
+#ifndef BLOGATOR_DTO_RENDERPLAN_H
+#define BLOGATOR_DTO_RENDERPLAN_H
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace blogator::dto {
+    struct Template;
+
+    /**
+     * Flat render plan of a Template
+     *
+     * The template lines are compiled once into literal byte spans each followed by an optional
+     * insertion slot (relative path or html block) so that writing a page from the template is a
+     * straight walk through the segments with no per-line look-ups.
+     */
+    struct RenderPlan {
+        enum class SlotType {
+            NONE, PATH, BLOCK
+        };
+
+        struct Segment {
+            std::string::size_type begin;  //offset of the literal span in the text buffer
+            std::string::size_type length; //length of the literal span
+            SlotType               slot;   //insertion slot following the literal span
+            size_t                 slot_i; //index of the slot's value in the paths/blocks collection
+        };
+
+        struct Line {
+            size_t      begin;        //index of the line's first segment
+            size_t      end;          //index after the line's last segment
+            std::string indent;       //indentation of the line (only set when the line has slots)
+            std::string block_indent; //indentation of the blocks inserted on the line (indent + '\t')
+
+            [[nodiscard]] bool hasSlots() const { return end - begin > 1; };
+        };
+
+        explicit RenderPlan( const Template &source );
+
+        [[nodiscard]] std::string_view literal( const Segment &segment ) const;
+
+        std::filesystem::path              src;      //template source path (for adapting the relative paths)
+        std::string                        text;     //literal spans (back-to-back)
+        std::vector<Segment>               segments; //segments of all the lines
+        std::vector<Line>                  lines;    //lines of the template
+        std::vector<std::filesystem::path> paths;    //relative path slot values
+        std::vector<std::string>           blocks;   //html block slot values (block class names)
+    };
+}
+
+#endif //BLOGATOR_DTO_RENDERPLAN_H
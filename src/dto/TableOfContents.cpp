@@ -1,7 +1,10 @@
 #include "TableOfContents.h"
 
-#include <regex>
+#include <sstream>
 #include <stack>
+#include <string_view>
+
+#include "../html/reader/markup.h"
 
 /**
  * Constructor
@@ -136,45 +139,66 @@ blogator::dto::TableOfContents::TableOfContents( int max_levels, int offset ) :
 
 /**
  * Find a single qualifying heading on a given line and add it to the Table of Contents
+ * (scans for the first '<hN>' of the line whose last matching '</hN>' closes it - same
+ *  results as the previous `^(.*?<\s*h([1|2|3|4|5|6]){1})\s*>(.*)(?:</h\2){1}>` regex)
  * @param line_number Line number from the HTML source
  * @param line        Line of HTML from source
+ * @throws std::invalid_argument when the heading level found cannot be converted to an integer
  */
 void blogator::dto::TableOfContents::findHeading( const size_t &line_number, const std::string &line )
 {
-    auto s = R"(^(.*?<\s*h([1|2|3|4|5|6]){1})\s*>(.*)(?:</h\2){1}>)"; //grp#2: heading level, grp#3: heading str
-    auto rx = std::regex( s );
-    auto it = std::sregex_iterator( line.begin(), line.end(), rx );
+    static const std::string_view levels = "123456|"; //('|' is in the regex's character class)
+
+    const auto terminator = line.find_first_of( "\r\n" ); //regex's '.' does not go past these
+
+    for( auto open = line.find( '<' ); open < terminator; open = line.find( '<', open + 1 ) ) {
+        auto i = html::reader::markup::skipSpaces( line, open + 1 );
+
+        if( i >= line.size() || line[ i ] != 'h' )
+            continue;
 
-    while( it != std::sregex_iterator() ) {
-        try {
-            auto level_i = stoi( it->str( 2 ) );
+        const auto level_pos = i + 1;
 
-            if( level_i >= _min_level && level_i <= _max_level ) {
-                if( level_i < _root_level )
-                    _root_level = level_i;
-                if( level_i > _leaf_level )
-                    _leaf_level = level_i;
+        if( level_pos >= line.size() || levels.find( line[ level_pos ] ) == std::string_view::npos )
+            continue;
 
-                auto level_e = static_cast<TableOfContents::HeadingLevel>( level_i );
+        i = html::reader::markup::skipSpaces( line, level_pos + 1 );
 
-                _heading_insert_pos.insert({
-                    dto::InsertPosition( line_number, it->str( 1 ).length() ),
-                    Heading( level_e, it->str( 3 ), dto::InsertPosition( line_number, it->position( 3 ) ) )
-                } );
-            }
+        if( i >= line.size() || line[ i ] != '>' )
+            continue;
 
-        } catch( std::invalid_argument &e ) {
+        const auto str_begin = i + 1;
+        const auto str_end   = line.find_first_of( "\r\n", str_begin );
+        const auto close_tag = std::string( "</h" ) + line[ level_pos ] + ">";
+        const auto close     = line.rfind( close_tag, str_end );
+
+        if( close == std::string::npos || close < str_begin )
+            continue;
+
+        if( line[ level_pos ] == '|' ) {
             std::stringstream ss;
             ss << "[blogator::dto::TableOfContents::findHeading( " << line_number << ", \"" << line << "\" )] "
-               << "Could not convert heading level '" << it->str( 2 ) << "' to an integer.";
+               << "Could not convert heading level '" << line[ level_pos ] << "' to an integer.";
             throw std::invalid_argument( ss.str() );
         }
-        ++it;
+
+        const auto level_i = line[ level_pos ] - '0';
+
+        if( level_i >= _min_level && level_i <= _max_level ) {
+            auto level_e = static_cast<TableOfContents::HeadingLevel>( level_i );
+
+            addHeading( dto::InsertPosition( line_number, level_pos + 1 ),
+                        Heading( level_e, line.substr( str_begin, close - str_begin ), dto::InsertPosition( line_number, str_begin ) ) );
+        }
+
+        return; //only the first qualifying heading of a line is used
     }
 }
 
 /**
  * Finds a qualifying ToC insert block on a given line and add it to the list of insertion points for ToC blocks
+ * (scans for the last empty element on the line with the css class in a leading 'class' attribute and uses the
+ *  position of its closing tag - same results as the previous `^(.*<\s*[a-zA-Z\d]+\s*class\s*=\s*"[a-zA-Z-_\s]*)css_class((?:\s[a-zA-Z-_\s]*"|")>\s*)(?:</[a-zA-Z\d]+>)` regex)
  * @param line_number Line number from the HTML source
  * @param line        Line of HTML from source
  * @param css_class   CSS class used to denote a ToC insertion block in the HTML source
@@ -183,16 +207,45 @@ void blogator::dto::TableOfContents::findTocBlock( const size_t &line_number,
                                                    const std::string &line,
                                                    const std::string &css_class )
 {
-    auto s  = R"(^(.*<\s*[a-zA-Z\d]+\s*class\s*=\s*"[a-zA-Z-_\s]*)" + css_class + R"((?:\s[a-zA-Z-_\s]*"|")>\s*)(?:</[a-zA-Z\d]+>))";
-    auto rx = std::regex( s );
-    auto it = std::sregex_iterator( line.begin(), line.end(), rx );
+    const auto terminator = line.find_first_of( "\r\n" ); //regex's '.' does not go past these
+    auto       open       = line.rfind( '<', terminator );
+
+    while( open != std::string::npos ) {
+        const auto col = html::reader::markup::matchClassBlock( line, open, css_class );
 
-    while( it != std::sregex_iterator() ) {
-        _toc_insert_pos.emplace_back( dto::InsertPosition( line_number, it->str( 1 ).length() ) );
-        ++it;
+        if( col != std::string::npos ) {
+            addTocBlock( dto::InsertPosition( line_number, col ) );
+            return; //only the last qualifying block of a line is used
+        }
+
+        open = ( open > 0 ? line.rfind( '<', open - 1 ) : std::string::npos );
     }
 }
 
+/**
+ * Adds a heading to the Table of Contents
+ * @param insert_pos Insert position of the heading's ID in the HTML source
+ * @param heading    Heading
+ */
+void blogator::dto::TableOfContents::addHeading( const InsertPosition &insert_pos, const Heading &heading ) {
+    auto level_i = static_cast<int>( heading.level );
+
+    if( level_i < _root_level )
+        _root_level = level_i;
+    if( level_i > _leaf_level )
+        _leaf_level = level_i;
+
+    _heading_insert_pos.insert( { insert_pos, heading } );
+}
+
+/**
+ * Adds a ToC block insertion point
+ * @param insert_pos Insert position of the ToC block in the HTML source
+ */
+void blogator::dto::TableOfContents::addTocBlock( const InsertPosition &insert_pos ) {
+    _toc_insert_pos.emplace_back( insert_pos );
+}
+
 /**
  * Generates all the numbering and level information for all the headings
  */
@@ -281,4 +334,4 @@ void blogator::dto::TableOfContents::generateNumbering( std::map<InsertPosition,
 
         last_depth = depth;
     }
-}
\ No newline at end of file
+}
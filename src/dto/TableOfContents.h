@@ -44,6 +44,8 @@ namespace blogator::dto {
 
         void findHeading( const size_t &line_number, const std::string &line );
         void findTocBlock( const size_t &line_number, const std::string &line, const std::string &css_class );
+        void addHeading( const InsertPosition &insert_pos, const Heading &heading );
+        void addTocBlock( const InsertPosition &insert_pos );
         void finaliseToC();
 
         [[nodiscard]] HeadingLevel minHeadingLevel() const;
@@ -57,4 +57,11 @@ blogator::dto::Template::Template( Template::Type template_type ) :
             } );
             break;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * Compiles the template into its render plan (to be done once the insertion points are located)
+ */
+void blogator::dto::Template::compile() {
+    plan = std::make_shared<const RenderPlan>( *this );
+}
@@ -7,6 +7,7 @@
 
 #include "HTML.h"
 #include "InsertPosition.h"
+#include "RenderPlan.h"
 
 namespace blogator::dto {
     struct Template {
@@ -16,6 +17,8 @@ namespace blogator::dto {
 
         explicit Template( Type template_type );
 
+        void compile();
+
         typedef std::map<std::string, bool> BlockInsertClasses_t;
 
         struct WritePosIterators {
@@ -23,12 +26,13 @@ namespace blogator::dto {
             ConsecutivePathPositions_t::const_iterator  path;
         };
 
-        Type                        type;
-        std::filesystem::path       src;
-        std::unique_ptr<HTML>       html;
-        ConsecutivePathPositions_t  path_write_pos;
-        ConsecutiveWritePositions_t block_write_pos;
-        BlockInsertClasses_t        block_classes;
+        Type                              type;
+        std::filesystem::path             src;
+        std::unique_ptr<HTML>             html;
+        ConsecutivePathPositions_t        path_write_pos;
+        ConsecutiveWritePositions_t       block_write_pos;
+        BlockInsertClasses_t              block_classes;
+        std::shared_ptr<const RenderPlan> plan; //compiled once the insertion points are located
     };
 }
 
@@ -1,5 +1,8 @@
 #include "Templates.h"
 
+#include <algorithm>
+#include <cstring>
+
 /**
  * Constructor
  */
@@ -13,40 +16,121 @@ blogator::dto::Templates::Templates() :
 
 /**
  * Extracts any relative paths found in an HTML text
+ * (paths are removed from the lines and their positions are where they were in the edited lines)
  * @param source Source HTML DTO to extract any relative paths from
  * @return Consecutive positions and extracted paths in the HTML
  */
 blogator::dto::ConsecutivePathPositions_t blogator::dto::Templates::extractRelativePaths( dto::HTML &source )  {
-    const auto path_rx = std::regex( R"((.*?<.*?(?:src|href)=")(?!www|http)([^/]{1}[a-zA-Z\%\.\-_\d/\s]+\.[a-zA-Z\d_]{2,4})("))" );
-    auto       pos     = ConsecutivePathPositions_t();
-    size_t     line_i  = 0;
+    auto              pos    = ConsecutivePathPositions_t();
+    HTML::LineIndex_t line_i = 0;
+
+    for( auto &line : source._lines )
+        extractRelativePaths( line_i++, line, pos );
+
+    return pos;
+}
+
+/**
+ * Extracts any relative paths found in the `src="..."`/`href="..."` attributes of a line
+ * (the line is edited in place by moving the text following each path over it)
+ * @param line_i    Line index
+ * @param line      Line of HTML
+ * @param positions Container for the positions and paths extracted
+ */
+void blogator::dto::Templates::extractRelativePaths( const HTML::LineIndex_t &line_i,
+                                                     std::string &line,
+                                                     ConsecutivePathPositions_t &positions )
+{
+    char * const data  = line.data();
+    const auto   size  = line.size();
+    size_t       write = 0; //end of the edited part of the line
+    size_t       read  = 0; //start of the rest of the line still to move into place
+    size_t       from  = 0; //search start
 
-    std::string::size_type last_size = 0;
+    while( from < size ) {
+        const auto * tag = static_cast<const char *>( std::memchr( data + from, '<', size - from ) );
 
-    for( auto &line : source._lines ) {
-        std::stringstream ss;
-        auto it = std::sregex_iterator( line.begin(), line.end(), path_rx );
-        auto substr_start = 0;
-        auto stream_size  = 0;
+        if( tag == nullptr )
+            break;
 
-        while( it != std::sregex_iterator() ) {
-            auto col = substr_start + it->str( 1 ).length() - last_size;
+        const auto   tag_pos   = static_cast<size_t>( tag - data );
+        auto         value     = std::string::npos;
+        auto         value_end = std::string::npos;
+        const char * eq        = tag + 1;
 
-            pos.insert( std::make_pair( InsertPosition( line_i, col ), it->str( 2 ) ) );
-            ss << it->str( 1 ) << it->str( 3 );
+        //first 'src="' or 'href="' after the '<' with a relative path value
+        while( eq < data + size && ( eq = static_cast<const char *>( std::memchr( eq, '=', ( data + size ) - eq ) ) ) != nullptr ) {
+            const auto eq_pos  = static_cast<size_t>( eq - data );
+            const bool is_attr = ( eq_pos + 1 < size && data[ eq_pos + 1 ] == '"' ) &&
+                                 ( ( eq_pos >= tag_pos + 4 && line.compare( eq_pos - 3, 3, "src" ) == 0 ) ||
+                                   ( eq_pos >= tag_pos + 5 && line.compare( eq_pos - 4, 4, "href" ) == 0 ) );
 
-            stream_size  += it->str( 1 ).size() + it->str( 3 ).size();
-            substr_start += it->str( 0 ).length();
-            last_size     = it->str( 2 ).length();
+            if( is_attr && ( value_end = matchRelativePath( line, eq_pos + 2 ) ) != std::string::npos ) {
+                value = eq_pos + 2;
+                break;
+            }
 
-            ++it;
+            ++eq;
         }
 
-        ss << line.substr( substr_start );
-        line = ss.str();
-        last_size = 0;
-        ++line_i;
+        if( value == std::string::npos ) //(any later '<' would only have the same attributes left after it)
+            break;
+
+        auto path = line.substr( value, value_end - value );
+
+        std::memmove( data + write, data + read, value - read );
+        write += value - read;
+        read   = value_end; //(the closing quote is kept)
+        from   = value_end + 1;
+
+        positions.insert( std::make_pair( InsertPosition( line_i, write ), std::move( path ) ) );
     }
 
-    return pos;
-}
\ No newline at end of file
+    if( read > write ) {
+        std::memmove( data + write, data + read, size - read );
+        line.resize( write + ( size - read ) );
+    }
+}
+
+/**
+ * Matches a relative path attribute value (a file name with an extension not starting with '/', 'www' or 'http')
+ * @param line  Line of HTML
+ * @param value Position of the start of the attribute value
+ * @return Position of the attribute value's closing quote (npos when the value is not a relative path)
+ */
+std::string::size_type blogator::dto::Templates::matchRelativePath( const std::string &line, std::string::size_type value ) {
+    auto isPathChar = []( char c ) {
+        return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) || ( c >= '0' && c <= '9' ) ||
+               c == '%' || c == '.' || c == '-' || c == '_' || c == '/' || c == ' ' || ( c >= '\t' && c <= '\r' );
+    };
+
+    auto isExtensionChar = []( char c ) {
+        return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) || ( c >= '0' && c <= '9' ) || c == '_';
+    };
+
+    if( value >= line.size() || line[ value ] == '/' )
+        return std::string::npos;
+
+    if( line.compare( value, 3, "www" ) == 0 || line.compare( value, 4, "http" ) == 0 )
+        return std::string::npos;
+
+    auto quote = value + 1;
+
+    while( quote < line.size() && isPathChar( line[ quote ] ) )
+        ++quote;
+
+    if( quote >= line.size() || line[ quote ] != '"' )
+        return std::string::npos;
+
+    for( size_t ext_length = 2; ext_length <= 4; ++ext_length ) { //i.e.: '.' + 2-4 character extension
+        if( quote < value + ext_length + 3 ) //(file name must be at least 2 characters)
+            break;
+
+        const auto dot = quote - ext_length - 1;
+
+        if( line[ dot ] == '.' && std::all_of( line.cbegin() + dot + 1, line.cbegin() + quote, isExtensionChar ) )
+            return quote;
+    }
+
+    return std::string::npos;
+}
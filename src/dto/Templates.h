@@ -26,6 +26,10 @@ namespace blogator::dto {
         std::unique_ptr<Template> _landing;       //Blog landing page (start) template
 
         static ConsecutivePathPositions_t extractRelativePaths( HTML &source );
+        static void extractRelativePaths( const HTML::LineIndex_t &line_i, std::string &line, ConsecutivePathPositions_t &positions );
+
+      private:
+        static std::string::size_type matchRelativePath( const std::string &line, std::string::size_type value );
     };
 }
 
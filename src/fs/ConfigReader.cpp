@@ -101,10 +101,14 @@ void blogator::fs::ConfigReader::generateBlankConfigFile( const std::filesystem:
        << "build-future       = false;\n"
        << "safe-purge         = true;\n"
        << "posts-change-paths = false;\n"
+       << "posts-cache        = true;\n"
+       << "post-file-names    = \"number\";\n"
        << "toc-auto-generate  = 0;\n"
        << "toc-level-offset   = 1;\n"
        << "toc-auto-numerate  = true;\n"
        << "toc-heading        = \"<h2>Table of Contents</h2>\";\n"
+       << "ssi-index-panes    = false;\n"
+       << "ssi-current-post   = \"font-weight: bold;\";\n"
        << "\n"
        << "//Index settings\n"
        << "show-post-numbers  = true;\n"
@@ -112,6 +116,7 @@ void blogator::fs::ConfigReader::generateBlankConfigFile( const std::filesystem:
        << "post-summary-pads  = [\"<p>\", \"</p>\"];\n"
        << "featured-css-class = \"featured\";\n"
        << "items-per-page     = 10;\n"
+       << "stable-pagination  = false;\n"
        << "index-by-year      = false;\n"
        << "index-by-tag       = true;\n"
        << "index-by-author    = false;\n"
@@ -246,18 +251,26 @@ void blogator::fs::ConfigReader::processPostsOptions( std::unordered_map<std::st
     static const std::string build_future    = "build-future";
     static const std::string safe_purge      = "safe-purge";
     static const std::string adapt_rel_paths = "posts-change-paths";
+    static const std::string cache           = "posts-cache";
+    static const std::string file_names      = "post-file-names";
     static const std::string generate_toc    = "toc-auto-generate";
     static const std::string offset_toc      = "toc-level-offset";
     static const std::string numerate_toc    = "toc-auto-numerate";
     static const std::string toc_heading     = "toc-heading";
+    static const std::string ssi_panes       = "ssi-index-panes";
+    static const std::string ssi_current     = "ssi-current-post";
 
     auto build_future_it    = map.find( build_future );
     auto safe_purge_it      = map.find( safe_purge );
     auto adapt_rel_paths_it = map.find( adapt_rel_paths );
+    auto cache_it           = map.find( cache );
+    auto file_names_it      = map.find( file_names );
     auto generate_toc_it    = map.find( generate_toc );
     auto offset_toc_it      = map.find( offset_toc );
     auto numerate_toc_it    = map.find( numerate_toc );
     auto toc_heading_it     = map.find( toc_heading );
+    auto ssi_panes_it       = map.find( ssi_panes );
+    auto ssi_current_it     = map.find( ssi_current );
 
     if( build_future_it != map.end() ) {
         if( build_future_it->second.type == Type::BOOLEAN ) {
@@ -295,6 +308,38 @@ void blogator::fs::ConfigReader::processPostsOptions( std::unordered_map<std::st
         }
     }
 
+    if( cache_it != map.end() ) {
+        if( cache_it->second.type == Type::BOOLEAN ) {
+            options._posts.cache = ( cache_it->second.value == "true" );
+            cache_it->second.validated = true;
+        } else {
+            throw exception::file_parsing_failure(
+                "Error converting '" + cache + "' value to boolean "
+                "(line #" + std::to_string( cache_it->second.line ) + "): " + cache_it->second.value
+            );
+        }
+    }
+
+    if( file_names_it != map.end() ) {
+        static const auto modes = std::unordered_map<std::string, dto::Options::Posts::FileNames>( {
+            { "number",      dto::Options::Posts::FileNames::NUMBER },
+            { "source-path", dto::Options::Posts::FileNames::SOURCE_PATH },
+            { "title",       dto::Options::Posts::FileNames::TITLE }
+        } );
+
+        auto mode_it = modes.find( file_names_it->second.value );
+
+        if( file_names_it->second.type == Type::STRING && mode_it != modes.end() ) {
+            options._posts.file_names = mode_it->second;
+            file_names_it->second.validated = true;
+        } else {
+            throw exception::file_parsing_failure(
+                "Error converting '" + file_names + "' value to a naming mode (\"number\", \"source-path\" or \"title\") "
+                "(line #" + std::to_string( file_names_it->second.line ) + "): " + file_names_it->second.value
+            );
+        }
+    }
+
     if( generate_toc_it != map.end() ) {
         try {
             auto levels = std::stoi( generate_toc_it->second.value );
@@ -341,10 +386,33 @@ void blogator::fs::ConfigReader::processPostsOptions( std::unordered_map<std::st
         }
     }
 
+    if( ssi_panes_it != map.end() ) {
+        if( ssi_panes_it->second.type == Type::BOOLEAN ) {
+            options._posts.ssi.index_panes = ( ssi_panes_it->second.value == "true" );
+            ssi_panes_it->second.validated = true;
+        } else {
+            throw exception::file_parsing_failure(
+                "Error converting '" + ssi_panes + "' value to boolean "
+                "(line #" + std::to_string( ssi_panes_it->second.line ) + "): " + ssi_panes_it->second.value
+            );
+        }
+    }
+
+    if( ssi_current_it != map.end() ) {
+        if( ssi_current_it->second.type == Type::STRING ) {
+            options._posts.ssi.current_post_css = ssi_current_it->second.value;
+            ssi_current_it->second.validated = true;
+            _display.debug( "SSI current post style ..........: \"" + ssi_current_it->second.value + "\"" );
+        }
+    }
+
     _display.msg( "Build future-dated posts ........: ", options._posts.build_future, "TRUE", "FALSE" );
     _display.msg( "Safe purge post output dir.......: ", options._posts.safe_purge, "TRUE", "FALSE" );
     _display.msg( "Relative paths adapt (posts) ....: ", options._posts.adapt_rel_paths, "TRUE", "FALSE" );
+    _display.msg( "Cache indexed posts .............: ", options._posts.cache, "TRUE", "FALSE" );
+    _display.msg( "Post output file names ..........: ", ( options._posts.file_names == dto::Options::Posts::FileNames::NUMBER ), "NUMBER", ( options._posts.file_names == dto::Options::Posts::FileNames::TITLE ? "TITLE SLUG" : "SOURCE PATH SLUG" ) );
     _display.msg( "Auto-generate tables of contents : ", ( options._posts.toc.generate_toc > 0 ), "TRUE (depth: " + std::to_string( options._posts.toc.generate_toc ) + ", offset: " + std::to_string( options._posts.toc.level_offset ) + ")", "FALSE" );
+    _display.msg( "Index panes as SSI fragments ....: ", options._posts.ssi.index_panes, "TRUE", "FALSE" );
 }
 
 /**
@@ -394,6 +462,7 @@ void blogator::fs::ConfigReader::processIndexOptions( std::unordered_map<std::st
                                                       dto::Options &options ) const
 {
     static const std::string items_per_page     = "items-per-page";
+    static const std::string stable_pagination  = "stable-pagination";
     static const std::string show_post_summary  = "show-post-summary";
     static const std::string post_summary_pads  = "post-summary-pads";
     static const std::string featured_css_class = "featured-css-class";
@@ -402,6 +471,7 @@ void blogator::fs::ConfigReader::processIndexOptions( std::unordered_map<std::st
     static const std::string index_by_author    = "index-by-author";
 
     auto items_per_page_it     = map.find( items_per_page );
+    auto stable_pagination_it  = map.find( stable_pagination );
     auto show_post_summary_it  = map.find( show_post_summary );
     auto post_summary_pads_it  = map.find( post_summary_pads );
     auto featured_css_class_it = map.find( featured_css_class );
@@ -421,6 +491,18 @@ void blogator::fs::ConfigReader::processIndexOptions( std::unordered_map<std::st
         }
     }
 
+    if( stable_pagination_it != map.end() ) {
+        if( stable_pagination_it->second.type == Type::BOOLEAN ) {
+            options._index.stable_pagination = ( stable_pagination_it->second.value == "true" );
+            stable_pagination_it->second.validated = true;
+        } else {
+            throw exception::file_parsing_failure(
+                "Error converting '" + stable_pagination + "' value to boolean "
+                "(line #" + std::to_string( stable_pagination_it->second.line ) + "): " + stable_pagination_it->second.value
+            );
+        }
+    }
+
     if( show_post_summary_it != map.end() ) {
         if( show_post_summary_it->second.type == Type::BOOLEAN ) {
             options._index.show_summary = ( show_post_summary_it->second.value == "true" );
@@ -519,6 +601,7 @@ void blogator::fs::ConfigReader::processIndexOptions( std::unordered_map<std::st
 
     _display.msg( "Insert summary in index entries .: ", options._index.show_summary, "TRUE", "FALSE" );
     _display.msg( "Insert 'featured' CSS class .....: ", !options._index.featured_css_class.empty(), "\"" + options._index.featured_css_class + "\"", "N/A" );
+    _display.msg( "Stable index pagination .........: ", options._index.stable_pagination, "TRUE", "FALSE" );
     _display.msg( "Build index 'by-year' ...........: ", options._index.index_by_year, "TRUE", "FALSE" );
     _display.msg( "Build index 'by-tag' ............: ", options._index.index_by_tag, "TRUE", "FALSE" );
     _display.msg( "Build index 'by-author'..........: ", options._index.index_by_author, "TRUE", "FALSE" );
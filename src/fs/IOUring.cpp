@@ -0,0 +1,295 @@
+#include "IOUring.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef BLOGATOR_IO_URING
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <linux/io_uring.h>
+
+/**
+ * Constructor (sets up the ring and its registered file slots)
+ * @param file_slots Number of files that can be written in a single batch
+ * @throws std::system_error when io_uring (or a required feature of it) is not available (kernel < 5.15)
+ */
+blogator::fs::IOUring::IOUring( unsigned file_slots ) :
+    _fd( -1 ),
+    _slots( file_slots ),
+    _rings( MAP_FAILED ),
+    _rings_size( 0 ),
+    _sqes( MAP_FAILED ),
+    _sqes_size( 0 ),
+    _sq_tail( nullptr ),
+    _sq_mask( nullptr ),
+    _sq_array( nullptr ),
+    _cq_head( nullptr ),
+    _cq_tail( nullptr ),
+    _cq_mask( nullptr ),
+    _cqes( nullptr )
+{
+    if( file_slots == 0 )
+        throw std::invalid_argument( "[fs::IOUring::IOUring(..)] Number of file slots must be > 0." );
+
+    auto params = io_uring_params();
+    std::memset( &params, 0, sizeof( params ) );
+
+    _fd = static_cast<int>( ::syscall( __NR_io_uring_setup, file_slots * 3, &params ) );
+
+    if( _fd < 0 )
+        throw std::system_error( errno, std::generic_category(), "io_uring_setup" );
+
+    try {
+        if( !( params.features & IORING_FEAT_SINGLE_MMAP ) || !( params.features & IORING_FEAT_NODROP ) )
+            throw std::system_error( ENOTSUP, std::generic_category(), "io_uring features" );
+
+        const auto sq_size = params.sq_off.array + params.sq_entries * sizeof( unsigned );
+        const auto cq_size = params.cq_off.cqes + params.cq_entries * sizeof( io_uring_cqe );
+
+        _rings_size = std::max( sq_size, cq_size );
+        _rings      = ::mmap( nullptr, _rings_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQ_RING );
+
+        if( _rings == MAP_FAILED )
+            throw std::system_error( errno, std::generic_category(), "io_uring rings mmap" );
+
+        _sqes_size = params.sq_entries * sizeof( io_uring_sqe );
+        _sqes      = ::mmap( nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQES );
+
+        if( _sqes == MAP_FAILED )
+            throw std::system_error( errno, std::generic_category(), "io_uring sqes mmap" );
+
+        auto *base = static_cast<char *>( _rings );
+
+        _sq_tail  = reinterpret_cast<unsigned *>( base + params.sq_off.tail );
+        _sq_mask  = reinterpret_cast<unsigned *>( base + params.sq_off.ring_mask );
+        _sq_array = reinterpret_cast<unsigned *>( base + params.sq_off.array );
+        _cq_head  = reinterpret_cast<unsigned *>( base + params.cq_off.head );
+        _cq_tail  = reinterpret_cast<unsigned *>( base + params.cq_off.tail );
+        _cq_mask  = reinterpret_cast<unsigned *>( base + params.cq_off.ring_mask );
+        _cqes     = base + params.cq_off.cqes;
+
+        auto sparse_slots = std::vector<int>( file_slots, -1 );
+
+        if( ::syscall( __NR_io_uring_register, _fd, IORING_REGISTER_FILES, sparse_slots.data(), file_slots ) < 0 )
+            throw std::system_error( errno, std::generic_category(), "io_uring file slots registration" );
+
+        checkDirectFiles();
+
+    } catch( ... ) {
+        release();
+        throw;
+    }
+}
+
+/**
+ * Destructor
+ */
+blogator::fs::IOUring::~IOUring() {
+    release();
+}
+
+/**
+ * Gets the maximum number of files per batch
+ * @return File slot count
+ */
+unsigned blogator::fs::IOUring::slots() const {
+    return _slots;
+}
+
+/**
+ * Writes a batch of files (created/truncated)
+ * Note: a file with an error set may have been partially written.
+ * @param files Files to write (the error of each is set on return)
+ * @throws std::invalid_argument when there are more files than file slots
+ * @throws std::system_error when the submission fails (the files' errors are set)
+ */
+void blogator::fs::IOUring::writeFiles( std::vector<FileWrite> &files ) {
+    if( files.size() > _slots )
+        throw std::invalid_argument( "[fs::IOUring::writeFiles(..)] Batch has more files than slots." );
+
+    auto *sqes = static_cast<io_uring_sqe *>( _sqes );
+    auto *cqes = static_cast<io_uring_cqe *>( _cqes );
+
+    const unsigned sq_mask = *_sq_mask;
+    const unsigned cq_mask = *_cq_mask;
+    unsigned       sq_tail = *_sq_tail; //only written by this side
+
+    const auto nextSQE = [&]() {
+        const auto i = sq_tail++ & sq_mask;
+        _sq_array[ i ] = i;
+        std::memset( &sqes[ i ], 0, sizeof( io_uring_sqe ) );
+        return &sqes[ i ];
+    };
+
+    for( unsigned slot = 0; slot < files.size(); ++slot ) {
+        auto &file = files[ slot ];
+        file.error = 0;
+
+        auto *open_op = nextSQE();
+        open_op->opcode     = IORING_OP_OPENAT;
+        open_op->fd         = AT_FDCWD;
+        open_op->addr       = reinterpret_cast<__u64>( file.path );
+        open_op->len        = 0666;
+        open_op->open_flags = O_WRONLY | O_CREAT | O_TRUNC; //O_CLOEXEC is refused with a file slot (no fd)
+        open_op->file_index = slot + 1;
+        open_op->flags      = IOSQE_IO_LINK;
+        open_op->user_data  = slot * 3;
+
+        auto *write_op = nextSQE();
+        write_op->opcode    = IORING_OP_WRITE;
+        write_op->fd        = static_cast<__s32>( slot );
+        write_op->addr      = reinterpret_cast<__u64>( file.content.data() );
+        write_op->len       = static_cast<__u32>( file.content.size() );
+        write_op->off       = 0;
+        write_op->flags     = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK; //slot closed even when the write fails
+        write_op->user_data = slot * 3 + 1;
+
+        auto *close_op = nextSQE();
+        close_op->opcode     = IORING_OP_CLOSE;
+        close_op->file_index = slot + 1;
+        close_op->user_data  = slot * 3 + 2;
+    }
+
+    __atomic_store_n( _sq_tail, sq_tail, __ATOMIC_RELEASE );
+
+    const auto total     = static_cast<unsigned>( files.size() * 3 );
+    unsigned   submitted = 0;
+    unsigned   completed = 0;
+
+    while( completed < total ) {
+        const auto n = ::syscall( __NR_io_uring_enter, _fd, total - submitted, total - completed, IORING_ENTER_GETEVENTS, nullptr, 0 );
+
+        if( n < 0 ) {
+            if( errno == EINTR )
+                continue;
+
+            const auto error = errno;
+            for( auto &file : files )
+                file.error = ( file.error ? file.error : error );
+
+            throw std::system_error( error, std::generic_category(), "io_uring_enter" );
+        }
+
+        submitted += static_cast<unsigned>( n );
+
+        unsigned       head = *_cq_head;
+        const unsigned tail = __atomic_load_n( _cq_tail, __ATOMIC_ACQUIRE );
+
+        for( ; head != tail; ++head, ++completed ) {
+            const auto &cqe  = cqes[ head & cq_mask ];
+            auto       &file = files[ cqe.user_data / 3 ];
+
+            if( cqe.user_data % 3 == 0 && cqe.res > 0 ) { //plain fd: the slot was ignored by the kernel
+                ::close( cqe.res );
+                file.error = ( file.error ? file.error : ENOTSUP );
+            }
+
+            if( file.error != 0 )
+                continue;
+
+            if( cqe.res < 0 )
+                file.error = -cqe.res;
+            else if( cqe.user_data % 3 == 1 && static_cast<size_t>( cqe.res ) != file.content.size() )
+                file.error = EIO; //short write
+        }
+
+        __atomic_store_n( _cq_head, head, __ATOMIC_RELEASE );
+    }
+}
+
+/**
+ * Checks the kernel opens/closes files directly into the registered slots (Linux 5.15+)
+ * (older kernels ignore the slot on open and return a plain file descriptor that would leak)
+ * @throws std::system_error when direct file slots are not supported
+ */
+void blogator::fs::IOUring::checkDirectFiles() {
+    constexpr unsigned probe_ops = 256;
+
+    auto buffer = std::vector<char>( sizeof( io_uring_probe ) + probe_ops * sizeof( io_uring_probe_op ), 0 );
+    auto *probe = reinterpret_cast<io_uring_probe *>( buffer.data() );
+
+    if( ::syscall( __NR_io_uring_register, _fd, IORING_REGISTER_PROBE, probe, probe_ops ) < 0 )
+        throw std::system_error( errno, std::generic_category(), "io_uring probe" );
+
+    const auto supported = [&]( unsigned op ) {
+        return op <= probe->last_op && op < probe->ops_len && ( probe->ops[ op ].flags & IO_URING_OP_SUPPORTED );
+    };
+
+    //IORING_OP_LINKAT shipped in the same release (5.15) as the direct open/close
+    for( const auto op : { IORING_OP_OPENAT, IORING_OP_WRITE, IORING_OP_CLOSE, IORING_OP_LINKAT } ) {
+        if( !supported( op ) )
+            throw std::system_error( ENOTSUP, std::generic_category(), "io_uring direct file slots" );
+    }
+
+    auto test = std::vector<FileWrite>( { FileWrite( { "/dev/null", std::string_view() } ) } );
+
+    writeFiles( test );
+
+    if( test[ 0 ].error != 0 )
+        throw std::system_error( test[ 0 ].error, std::generic_category(), "io_uring direct file slots" );
+}
+
+/**
+ * Unmaps the rings and closes the ring's file descriptor
+ */
+void blogator::fs::IOUring::release() {
+    if( _sqes != MAP_FAILED )
+        ::munmap( _sqes, _sqes_size );
+    if( _rings != MAP_FAILED )
+        ::munmap( _rings, _rings_size );
+    if( _fd >= 0 )
+        ::close( _fd );
+
+    _sqes  = MAP_FAILED;
+    _rings = MAP_FAILED;
+    _fd    = -1;
+}
+
+#else //no io_uring kernel header at build time
+
+/**
+ * Constructor
+ * @param file_slots Number of files that can be written in a single batch
+ * @throws std::system_error as io_uring support was not compiled in
+ */
+blogator::fs::IOUring::IOUring( unsigned file_slots ) :
+    _fd( -1 ), _slots( file_slots ), _rings( nullptr ), _rings_size( 0 ), _sqes( nullptr ), _sqes_size( 0 ),
+    _sq_tail( nullptr ), _sq_mask( nullptr ), _sq_array( nullptr ),
+    _cq_head( nullptr ), _cq_tail( nullptr ), _cq_mask( nullptr ), _cqes( nullptr )
+{
+    throw std::system_error( ENOSYS, std::generic_category(), "io_uring support not compiled in" );
+}
+
+/**
+ * Destructor
+ */
+blogator::fs::IOUring::~IOUring() = default;
+
+/**
+ * Gets the maximum number of files per batch
+ * @return File slot count
+ */
+unsigned blogator::fs::IOUring::slots() const {
+    return _slots;
+}
+
+/**
+ * Writes a batch of files
+ * @param files Files to write
+ * @throws std::system_error as io_uring support was not compiled in
+ */
+void blogator::fs::IOUring::writeFiles( [[maybe_unused]] std::vector<FileWrite> &files ) {
+    throw std::system_error( ENOSYS, std::generic_category(), "io_uring support not compiled in" );
+}
+
+/**
+ * Releases the ring's resources (none)
+ */
+void blogator::fs::IOUring::release() {}
+
+#endif //BLOGATOR_IO_URING
@@ -0,0 +1,420 @@
+#include "OutputQueue.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "../cli/MsgInterface.h"
+
+/**
+ * Gets the instance of the output queue
+ * @return OutputQueue instance
+ */
+blogator::fs::OutputQueue & blogator::fs::OutputQueue::getInstance() {
+    static OutputQueue instance;
+    return instance;
+}
+
+/**
+ * Sets the backend to use for the page files and clears the registry of output names
+ * (anything still queued is flushed beforehand)
+ * @param backend          Backend to use
+ * @param batch_size       Number of pages per io_uring batch
+ * @param write_if_changed Flag to leave the files already holding the same content untouched
+ * @return Backend in use (falls back to DIRECT when io_uring is not available)
+ */
+blogator::fs::OutputQueue::Backend blogator::fs::OutputQueue::configure( Backend backend,
+                                                                         unsigned batch_size,
+                                                                         bool write_if_changed )
+{
+    flush();
+
+    {
+        std::lock_guard<std::mutex> lock( _registry_mutex );
+        _registry.clear();
+    }
+
+    std::lock_guard<std::mutex> lock( _ring_mutex );
+
+    _ring.reset();
+    _batched          = false;
+    _batch_size       = ( batch_size > 0 ? batch_size : 1 );
+    _write_if_changed = write_if_changed;
+    _unchanged_count  = 0;
+    _staged           = false;
+    _linked_count     = 0;
+
+    if( backend == Backend::IO_URING ) {
+        try {
+            _ring    = std::make_unique<IOUring>( _batch_size );
+            _batched = true;
+
+        } catch( std::exception &e ) {
+            cli::MsgInterface::getInstance().warning(
+                "io_uring output backend not available (" + std::string( e.what() ) + "). Using direct writes."
+            );
+        }
+    }
+
+    return ( _batched ? Backend::IO_URING : Backend::DIRECT );
+}
+
+/**
+ * Gets the batched state
+ * @return Pages are queued when closed
+ */
+bool blogator::fs::OutputQueue::batched() const {
+    return _batched;
+}
+
+/**
+ * Gets the deferred state
+ * @return Pages are handed to the queue when closed instead of being written by their stream
+ */
+bool blogator::fs::OutputQueue::deferred() const {
+    return _batched || _write_if_changed || _staged;
+}
+
+/**
+ * Gets the number of files left untouched as their content on disk was already the same
+ * @return Unchanged file count since the queue was configured
+ */
+size_t blogator::fs::OutputQueue::unchangedCount() const {
+    std::lock_guard<std::mutex> lock( _ring_mutex );
+    return _unchanged_count;
+}
+
+/**
+ * Redirects the files written under the live root to the same relative paths under a staging root
+ * (cleared by the next call to `configure(..)`)
+ * @param live_root  Live root directory
+ * @param stage_root Staging root directory
+ */
+void blogator::fs::OutputQueue::setStaging( const std::filesystem::path &live_root, const std::filesystem::path &stage_root ) {
+    flush();
+
+    std::lock_guard<std::mutex> lock( _ring_mutex );
+
+    _live_root  = live_root.lexically_normal();
+    _stage_root = stage_root.lexically_normal();
+
+    if( !_live_root.has_filename() )
+        _live_root = _live_root.parent_path();
+
+    _staged = true;
+}
+
+/**
+ * Gets the staged state
+ * @return Files under the live root are written to the staging tree
+ */
+bool blogator::fs::OutputQueue::staged() const {
+    return _staged;
+}
+
+/**
+ * Gets the path a file is actually written to
+ * @param path Live file path
+ * @return Matching path in the staging tree (or the path as-is when not staged or outside the live root)
+ */
+std::filesystem::path blogator::fs::OutputQueue::stagedPath( const std::filesystem::path &path ) const {
+    if( !_staged )
+        return path;
+
+    const auto rel = path.lexically_normal().lexically_relative( _live_root );
+
+    if( rel.empty() || *rel.begin() == ".." )
+        return path;
+
+    return _stage_root / rel;
+}
+
+/**
+ * Hard-links the registered files that were not written in the staging tree from their live
+ * counterpart (i.e.: outputs skipped by an incremental run as unchanged)
+ * @return Number of files linked
+ */
+size_t blogator::fs::OutputQueue::linkUnwritten() {
+    auto paths = std::vector<std::filesystem::path>();
+    auto count = size_t( 0 );
+
+    if( !_staged )
+        return count;
+
+    {
+        std::lock_guard<std::mutex> lock( _registry_mutex );
+        paths.assign( _registry.cbegin(), _registry.cend() );
+    }
+
+    for( const auto &live : paths ) {
+        const auto staged = stagedPath( live );
+        auto       ec     = std::error_code();
+
+        if( staged == live || std::filesystem::exists( std::filesystem::symlink_status( staged, ec ) ) )
+            continue;
+
+        if( !std::filesystem::is_regular_file( live, ec ) )
+            continue;
+
+        std::filesystem::create_directories( staged.parent_path(), ec );
+
+        if( linkFile( live, staged ) )
+            ++count;
+    }
+
+    std::lock_guard<std::mutex> lock( _ring_mutex );
+    _linked_count += count;
+
+    return count;
+}
+
+/**
+ * Gets the number of staged files hard-linked to their live counterpart
+ * @return Linked file count since the queue was configured
+ */
+size_t blogator::fs::OutputQueue::linkedCount() const {
+    std::lock_guard<std::mutex> lock( _ring_mutex );
+    return _linked_count;
+}
+
+/**
+ * Claims an output file path for the run
+ * @param path Output file path
+ * @return Success (false when already claimed)
+ */
+bool blogator::fs::OutputQueue::claim( const std::filesystem::path &path ) {
+    std::lock_guard<std::mutex> lock( _registry_mutex );
+    return _registry.emplace( path.lexically_normal().string() ).second;
+}
+
+/**
+ * Checks if an output file path was claimed
+ * @param path Output file path
+ * @return Claimed state
+ */
+bool blogator::fs::OutputQueue::contains( const std::filesystem::path &path ) const {
+    std::lock_guard<std::mutex> lock( _registry_mutex );
+    return _registry.find( path.lexically_normal().string() ) != _registry.cend();
+}
+
+/**
+ * Queues a finished page file (written straight away when not batched)
+ * Note: the path is added to the registry so that it is known as part of the run's output
+ * @param path    File path
+ * @param content File content
+ */
+void blogator::fs::OutputQueue::push( std::filesystem::path path, std::string content ) {
+    auto batch = Batch_t();
+
+    {
+        std::lock_guard<std::mutex> lock( _registry_mutex );
+        _registry.emplace( path.lexically_normal().string() );
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( _queue_mutex );
+        _queue.emplace_back( QueuedFile( { std::move( path ), std::move( content ) } ) );
+
+        if( !_batched || _queue.size() >= _batch_size )
+            batch.swap( _queue );
+    }
+
+    if( !batch.empty() )
+        write( batch );
+}
+
+/**
+ * Writes everything queued and reports the files that could not be written
+ * @return Number of files that could not be written since the last flush
+ */
+size_t blogator::fs::OutputQueue::flush() {
+    auto batch = Batch_t();
+
+    {
+        std::lock_guard<std::mutex> lock( _queue_mutex );
+        batch.swap( _queue );
+    }
+
+    if( !batch.empty() )
+        write( batch );
+
+    std::lock_guard<std::mutex> lock( _ring_mutex );
+
+    for( const auto &failure : _failures )
+        cli::MsgInterface::getInstance().error(
+            "File '" + failure.first.string() + "' could not be written: " + strerror( failure.second )
+        );
+
+    const auto count = _failures.size();
+    _failures.clear();
+    return count;
+}
+
+/**
+ * Writes a batch of files through the ring
+ * (the files the ring failed to write are re-written directly and, beforehand, the files already
+ * up to date on disk are dropped from the batch in write-if-changed mode or, when staged, hard-linked
+ * from the live tree whilst the others are redirected to the staging tree)
+ * @param batch Files to write
+ */
+void blogator::fs::OutputQueue::write( Batch_t &batch ) {
+    size_t unchanged_count = 0;
+    size_t linked_count    = 0;
+
+    if( _staged || _write_if_changed ) {
+        auto pending = Batch_t();
+        pending.reserve( batch.size() );
+
+        for( auto &file : batch ) {
+            if( _staged ) {
+                auto staged_path = stagedPath( file.path );
+
+                if( unchanged( file.path, file.content ) && linkFile( file.path, staged_path ) ) {
+                    ++linked_count;
+                    continue;
+                }
+
+                ::unlink( staged_path.c_str() ); //never write through a link to a live file
+                file.path = std::move( staged_path );
+
+            } else if( unchanged( file.path, file.content ) ) {
+                ++unchanged_count;
+                continue;
+            }
+
+            pending.emplace_back( std::move( file ) );
+        }
+
+        batch.swap( pending );
+    }
+
+    std::lock_guard<std::mutex> lock( _ring_mutex );
+
+    _unchanged_count += unchanged_count;
+    _linked_count    += linked_count;
+
+    if( batch.empty() )
+        return;
+
+    auto files = std::vector<IOUring::FileWrite>();
+
+    if( _ring ) {
+        files.reserve( batch.size() );
+
+        for( const auto &file : batch )
+            files.emplace_back( IOUring::FileWrite( { file.path.c_str(), file.content } ) );
+
+        try {
+            _ring->writeFiles( files );
+
+        } catch( std::exception &e ) {
+            cli::MsgInterface::getInstance().warning(
+                "io_uring output backend failed (" + std::string( e.what() ) + "). Using direct writes."
+            );
+
+            _ring.reset();
+            _batched = false;
+        }
+    }
+
+    for( size_t i = 0; i < batch.size(); ++i ) {
+        if( i < files.size() && files[ i ].error == 0 )
+            continue;
+
+        const auto error = writeFile( batch[ i ].path, batch[ i ].content );
+
+        if( error != 0 )
+            _failures.emplace_back( batch[ i ].path, error );
+    }
+}
+
+/**
+ * Writes a file directly (created/truncated)
+ * @param path    File path
+ * @param content File content
+ * @return 0 on success or the errno of the failed call
+ */
+int blogator::fs::OutputQueue::writeFile( const std::filesystem::path &path, std::string_view content ) {
+    const int fd = ::open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666 );
+
+    if( fd < 0 )
+        return errno;
+
+    while( !content.empty() ) {
+        const auto n = ::write( fd, content.data(), content.size() );
+
+        if( n < 0 ) {
+            if( errno == EINTR )
+                continue;
+
+            const auto error = errno;
+            ::close( fd );
+            return error;
+        }
+
+        content.remove_prefix( static_cast<size_t>( n ) );
+    }
+
+    return ( ::close( fd ) == 0 ? 0 : errno );
+}
+
+/**
+ * Checks if a file already holds some given content
+ * (sizes are compared first so that the file is only read when it could be the same)
+ * @param path    File path
+ * @param content Content
+ * @return Content of the file is the same (false when it does not exist or cannot be read)
+ */
+bool blogator::fs::OutputQueue::unchanged( const std::filesystem::path &path, std::string_view content ) {
+    const int fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+
+    if( fd < 0 )
+        return false;
+
+    struct stat file_stat {};
+
+    if( ::fstat( fd, &file_stat ) != 0 || !S_ISREG( file_stat.st_mode ) ||
+        static_cast<size_t>( file_stat.st_size ) != content.size() )
+    {
+        ::close( fd );
+        return false;
+    }
+
+    auto buffer = std::vector<char>( std::min<size_t>( content.size(), 64 * 1024 ) );
+    bool same   = true;
+
+    while( same && !content.empty() ) {
+        const auto n = ::read( fd, buffer.data(), std::min( buffer.size(), content.size() ) );
+
+        if( n < 0 && errno == EINTR )
+            continue;
+
+        if( n <= 0 || std::memcmp( buffer.data(), content.data(), static_cast<size_t>( n ) ) != 0 ) {
+            same = false;
+        } else {
+            content.remove_prefix( static_cast<size_t>( n ) );
+        }
+    }
+
+    ::close( fd );
+    return same;
+}
+
+/**
+ * Creates a hard link to a file (replacing whatever is already at the link's path)
+ * @param target Existing file path
+ * @param link   Link path
+ * @return Success
+ */
+bool blogator::fs::OutputQueue::linkFile( const std::filesystem::path &target, const std::filesystem::path &link ) {
+    if( ::link( target.c_str(), link.c_str() ) == 0 )
+        return true;
+
+    if( errno != EEXIST || ::unlink( link.c_str() ) != 0 )
+        return false;
+
+    return ::link( target.c_str(), link.c_str() ) == 0;
+}
@@ -0,0 +1,90 @@
+#ifndef BLOGATOR_FS_OUTPUTQUEUE_H
+#define BLOGATOR_FS_OUTPUTQUEUE_H
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "IOUring.h"
+
+namespace blogator::fs {
+    /**
+     * Process-wide output of the generated files
+     *
+     * Keeps the registry of the output file names claimed during a run (in place of checking the
+     * file system for files already there) and, with the io_uring backend, queues the finished
+     * pages to write them in batches. The queued pages are only guaranteed to be on disk once
+     * flushed. In write-if-changed mode every page is handed to the queue and a file whose content
+     * on disk is already the same is left untouched (keeps its mtime). When staged, the files are
+     * written to a staging tree mirroring the live root instead and the ones whose content is the
+     * same as their live counterpart are hard-linked to it.
+     */
+    class OutputQueue {
+      public:
+        enum class Backend {
+            DIRECT,  //pages are written by their stream when closed
+            IO_URING //pages are queued and written in batches of io_uring submissions
+        };
+
+        static OutputQueue & getInstance();
+
+        OutputQueue( const OutputQueue & ) = delete;
+        OutputQueue & operator =( const OutputQueue & ) = delete;
+
+        Backend configure( Backend backend, unsigned batch_size = 64, bool write_if_changed = false );
+        [[nodiscard]] bool batched() const;
+        [[nodiscard]] bool deferred() const;
+        [[nodiscard]] size_t unchangedCount() const;
+
+        void setStaging( const std::filesystem::path &live_root, const std::filesystem::path &stage_root );
+        [[nodiscard]] bool staged() const;
+        [[nodiscard]] std::filesystem::path stagedPath( const std::filesystem::path &path ) const;
+        size_t linkUnwritten();
+        [[nodiscard]] size_t linkedCount() const;
+
+        bool claim( const std::filesystem::path &path );
+        [[nodiscard]] bool contains( const std::filesystem::path &path ) const;
+
+        void push( std::filesystem::path path, std::string content );
+        size_t flush();
+
+      private:
+        struct QueuedFile {
+            std::filesystem::path path;
+            std::string           content;
+        };
+
+        typedef std::vector<QueuedFile> Batch_t;
+
+        mutable std::mutex              _registry_mutex;
+        std::unordered_set<std::string> _registry;        //claimed output file paths
+        std::atomic<bool>               _batched { false };
+        bool                            _write_if_changed { false };
+        size_t                          _unchanged_count  { 0 }; //files not written as already up to date
+        bool                            _staged           { false };
+        std::filesystem::path           _live_root;
+        std::filesystem::path           _stage_root;
+        size_t                          _linked_count     { 0 }; //staged files hard-linked to their live counterpart
+        std::mutex                      _queue_mutex;
+        Batch_t                         _queue;
+        unsigned                        _batch_size { 64 };
+        mutable std::mutex              _ring_mutex;
+        std::unique_ptr<IOUring>        _ring;
+        std::vector<std::pair<std::filesystem::path, int>> _failures; //{ path, errno }
+
+        OutputQueue() = default;
+
+        void write( Batch_t &batch );
+        static int writeFile( const std::filesystem::path &path, std::string_view content );
+        static bool unchanged( const std::filesystem::path &path, std::string_view content );
+        static bool linkFile( const std::filesystem::path &target, const std::filesystem::path &link );
+    };
+}
+
+#endif //BLOGATOR_FS_OUTPUTQUEUE_H
@@ -0,0 +1,59 @@
+#include "RelPathCache.h"
+
+#include <mutex>
+
+#include "fs.h"
+#include "../html/html.h"
+
+/**
+ * Gets a relative path adapted to a target file's location
+ * @param source_file Source file where the path was lifted from
+ * @param target_file Target file where the path will be written to
+ * @param rel_path    Relative path
+ * @return URL encoded adapted relative path (reference stays valid for the lifetime of the cache)
+ */
+const std::string & blogator::fs::RelPathCache::get( const std::filesystem::path &source_file,
+                                                     const std::filesystem::path &target_file,
+                                                     const std::filesystem::path &rel_path )
+{
+    thread_local auto key = std::string();
+
+    key.clear();
+    key.append( directoryOf( source_file ) ).append( 1, '\0' )
+       .append( directoryOf( target_file ) ).append( 1, '\0' )
+       .append( rel_path.native() );
+
+    {
+        std::shared_lock<std::shared_mutex> lock( _mutex );
+
+        auto it = _urls.find( key );
+        if( it != _urls.cend() )
+            return it->second;
+    }
+
+    auto url = html::encodePathToURL( fs::adaptRelPath( source_file, target_file, rel_path ) );
+
+    std::unique_lock<std::shared_mutex> lock( _mutex );
+    return _urls.emplace( key, std::move( url ) ).first->second; //keeps the first one in when raced
+}
+
+/**
+ * Gets the number of cached paths
+ * @return Cache size
+ */
+size_t blogator::fs::RelPathCache::size() const {
+    std::shared_lock<std::shared_mutex> lock( _mutex );
+    return _urls.size();
+}
+
+/**
+ * Gets the directory part of a file path without creating a new path
+ * @param file File path
+ * @return Everything before the last separator (empty when there are none)
+ */
+std::string_view blogator::fs::RelPathCache::directoryOf( const std::filesystem::path &file ) {
+    const auto &str = file.native();
+    const auto  pos = str.rfind( std::filesystem::path::preferred_separator );
+
+    return ( pos == std::string::npos ? std::string_view() : std::string_view( str.data(), pos ) );
+}
@@ -0,0 +1,34 @@
+#ifndef BLOGATOR_FS_RELPATHCACHE_H
+#define BLOGATOR_FS_RELPATHCACHE_H
+
+#include <filesystem>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace blogator::fs {
+    /**
+     * Thread-safe memo cache of the relative paths adapted to the location of the files they are
+     * written to (URL encoded and ready to write)
+     *
+     * An adapted path only depends on the source file's directory, the target file's directory and
+     * the raw relative path so the costly path operations are only done once per combination.
+     */
+    class RelPathCache {
+      public:
+        const std::string & get( const std::filesystem::path &source_file,
+                                 const std::filesystem::path &target_file,
+                                 const std::filesystem::path &rel_path );
+
+        [[nodiscard]] size_t size() const;
+
+      private:
+        mutable std::shared_mutex                    _mutex;
+        std::unordered_map<std::string, std::string> _urls; //K=source dir + target dir + relative path, V=adapted URL path
+
+        static std::string_view directoryOf( const std::filesystem::path &file );
+    };
+}
+
+#endif //BLOGATOR_FS_RELPATHCACHE_H
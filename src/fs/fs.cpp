@@ -2,10 +2,16 @@
 #include <iostream>
 #include <fstream>
 #include <regex>
+#include <set>
+#include <functional>
+#include <cstdio>
+#include <fcntl.h>
 
 #include <eadlib/cli/colour.h>
 
 #include "ConfigReader.h"
+#include "RelPathCache.h"
+#include "OutputQueue.h"
 #include "../cli/MsgInterface.h"
 #include "../html/reader/reader.h"
 #include "../exception/file_access_failure.h"
@@ -22,43 +28,76 @@ std::shared_ptr<blogator::dto::Options> blogator::fs::importOptions( const std::
 }
 
 /**
- * Sets-up the base directories for generating the posts/index
+ * Sets-up the base directories for generating the posts/index (in the staging tree for a staged run)
  * @param global_options Global blogator options
  * @throws std::runtime_error when a filesystem call has thrown an exception
  */
 void blogator::fs::setupEnvironment( const std::shared_ptr<dto::Options> &global_options ) {
     auto &display = cli::MsgInterface::getInstance();
+    auto &queue   = OutputQueue::getInstance();
 
     try {
-        auto purged_count = purge( *global_options );
-        std::cout << " (" << purged_count << " file(s)/folder(s) purged)" << std::endl;
+        if( global_options->_output.staged ) { //the live files are swapped with the staged ones once generated
+            std::filesystem::remove_all( global_options->_paths.stage_dir );
+            std::cout << " (staged publish: no purge)" << std::endl;
+        } else if( global_options->_output.incremental ) { //stale outputs are removed once the run's outputs are known
+            std::cout << " (incremental build: no purge)" << std::endl;
+        } else if( global_options->_output.write_if_changed ) {
+            std::cout << " (write if changed: no purge)" << std::endl;
+        } else {
+            auto purged_count = purge( *global_options );
+            std::cout << " (" << purged_count << " file(s)/folder(s) purged)" << std::endl;
+        }
+
+        queue.configure( global_options->_output.io_uring ? OutputQueue::Backend::IO_URING
+                                                          : OutputQueue::Backend::DIRECT,
+                         global_options->_output.batch_size,
+                         global_options->_output.write_if_changed );
+
+        if( global_options->_output.staged )
+            queue.setStaging( global_options->_paths.root_dir, global_options->_paths.stage_dir );
+
+        const auto posts_dir        = queue.stagedPath( global_options->_paths.posts_dir );
+        const auto index_dir        = queue.stagedPath( global_options->_paths.index_dir );
+        const auto index_date_dir   = queue.stagedPath( global_options->_paths.index_date_dir );
+        const auto index_year_dir   = queue.stagedPath( global_options->_paths.index_year_dir );
+        const auto index_tag_dir    = queue.stagedPath( global_options->_paths.index_tag_dir );
+        const auto index_author_dir = queue.stagedPath( global_options->_paths.index_author_dir );
 
         if( !std::filesystem::exists( global_options->_paths.template_dir ) ) {
             std::filesystem::create_directories( global_options->_paths.template_dir );
         }
-        if( !std::filesystem::exists( global_options->_paths.posts_dir ) ) {
-            if( !std::filesystem::create_directories( global_options->_paths.posts_dir ) ) {
-                display.error( "Could not create directories: " + global_options->_paths.posts_dir.string() );
+        if( !std::filesystem::exists( posts_dir ) ) {
+            if( !std::filesystem::create_directories( posts_dir ) ) {
+                display.error( "Could not create directories: " + posts_dir.string() );
             }
         }
-        if( !std::filesystem::create_directories( global_options->_paths.index_dir ) ) {
-            display.error( "Could not create directories: " + global_options->_paths.index_dir.string() );
+        if( !std::filesystem::exists( index_dir ) &&
+            !std::filesystem::create_directories( index_dir ) )
+        {
+            display.error( "Could not create directories: " + index_dir.string() );
         }
-        if( !std::filesystem::create_directories( global_options->_paths.index_date_dir ) ) {
-            display.error( "Could not create index sub-directory: " + global_options->_paths.index_date_dir.string() );
+        if( !std::filesystem::exists( index_date_dir ) &&
+            !std::filesystem::create_directories( index_date_dir ) )
+        {
+            display.error( "Could not create index sub-directory: " + index_date_dir.string() );
         }
         if( global_options->_index.index_by_year ) {
-            if( !std::filesystem::create_directories( global_options->_paths.index_year_dir ) )
-                display.error( "Could not create index sub-directory: " + global_options->_paths.index_year_dir.string() );
+            if( !std::filesystem::exists( index_year_dir ) &&
+                !std::filesystem::create_directories( index_year_dir ) )
+                display.error( "Could not create index sub-directory: " + index_year_dir.string() );
         }
         if( global_options->_index.index_by_tag ) {
-            if( !std::filesystem::create_directories( global_options->_paths.index_tag_dir ) )
-                display.error( "Could not create index sub-directory: " + global_options->_paths.index_tag_dir.string() );
+            if( !std::filesystem::exists( index_tag_dir ) &&
+                !std::filesystem::create_directories( index_tag_dir ) )
+                display.error( "Could not create index sub-directory: " + index_tag_dir.string() );
         }
         if( global_options->_index.index_by_author ) {
-            if( !std::filesystem::create_directories( global_options->_paths.index_author_dir ) )
-                display.error( "Could not create index sub-directory: " + global_options->_paths.index_tag_dir.string() );
+            if( !std::filesystem::exists( index_author_dir ) &&
+                !std::filesystem::create_directories( index_author_dir ) )
+                display.error( "Could not create index sub-directory: " + index_tag_dir.string() );
         }
+
     } catch( std::exception &e ) {
         std::stringstream ss;
         ss << "Environment setup failed: " << e.what();
@@ -101,6 +140,189 @@ uintmax_t blogator::fs::purge( const blogator::dto::Options &options ) {
     return purge_count;
 }
 
+/**
+ * Removes the files left in the generated folders that were not part of the run's output
+ * (i.e.: what a purge would have removed minus the files claimed/written during the run)
+ * @param options Global Options DTO
+ * @return Number of file/folders removed
+ */
+uintmax_t blogator::fs::removeStaleOutputs( const dto::Options &options ) {
+    auto &display     = cli::MsgInterface::getInstance();
+    auto &queue       = OutputQueue::getInstance();
+    auto  stale_files = std::list<std::filesystem::path>();
+    auto  dirs        = std::list<std::filesystem::path>();
+    auto  kept_dirs   = std::set<std::filesystem::path>( { options._paths.index_dir,
+                                                          options._paths.index_date_dir,
+                                                          options._paths.index_year_dir,
+                                                          options._paths.index_tag_dir,
+                                                          options._paths.index_author_dir,
+                                                          options._paths.posts_dir } );
+
+    const auto collect = [&]( const std::filesystem::path &root, bool safe ) {
+        if( !std::filesystem::exists( root ) )
+            return;
+
+        for( auto &p: std::filesystem::recursive_directory_iterator( root ) ) {
+            if( p.is_directory() ) {
+                if( !safe )
+                    dirs.emplace_front( p.path() ); //children are checked before their parent
+
+            } else if( !queue.contains( p.path() ) ) {
+                if( !safe || p.path().extension().string() == ".html" ||
+                             p.path().extension().string() == ".htm"  ||
+                             p.path().extension().string() == ".css" )
+                {
+                    stale_files.emplace_back( p.path() );
+                }
+            }
+        }
+    };
+
+    collect( options._paths.index_dir, false );
+    collect( options._paths.posts_dir, options._posts.safe_purge );
+
+    const auto rss_path = options._paths.root_dir / options._rss.file_name;
+
+    if( std::filesystem::exists( rss_path ) && !queue.contains( rss_path ) )
+        stale_files.emplace_back( rss_path );
+
+    std::uintmax_t removed_count = 0;
+
+    for( const auto &p : stale_files ) {
+        if( std::filesystem::remove( p ) ) {
+            display.debug( "Removed stale output: " + p.string() );
+            ++removed_count;
+        }
+    }
+
+    for( const auto &dir : dirs ) {
+        if( kept_dirs.find( dir ) == kept_dirs.cend() && std::filesystem::is_empty( dir ) )
+            removed_count += std::filesystem::remove( dir ) ? 1 : 0;
+    }
+
+    return removed_count;
+}
+
+/**
+ * Publishes the staging tree of a staged run in place of the live generated files/folders
+ * (the posts/index folders, landing page and RSS feed are each swapped with their live counterpart
+ * in a single atomic rename and the previous generation, left in the staging tree, is then removed)
+ * @param options Global Options DTO
+ * @throws exception::file_access_failure when a live file/folder cannot be replaced (the entries already
+ *         swapped are swapped back and the message lists any that could not be restored)
+ */
+void blogator::fs::publishStagedOutput( const dto::Options &options ) {
+    auto &display = cli::MsgInterface::getInstance();
+    auto &queue   = OutputQueue::getInstance();
+
+    queue.linkUnwritten();
+
+    if( options._posts.safe_purge && std::filesystem::exists( options._paths.posts_dir ) ) { //carries over what a purge leaves
+        for( auto &p: std::filesystem::recursive_directory_iterator( options._paths.posts_dir ) ) {
+            if( p.is_regular_file() &&
+                p.path().extension().string() != ".html" &&
+                p.path().extension().string() != ".htm"  &&
+                p.path().extension().string() != ".css" )
+            {
+                const auto staged = queue.stagedPath( p.path() );
+
+                if( !std::filesystem::exists( staged ) ) {
+                    std::filesystem::create_directories( staged.parent_path() );
+                    std::filesystem::create_hard_link( p.path(), staged );
+                }
+            }
+        }
+    }
+
+    auto undo_steps = std::vector<std::pair<std::filesystem::path, std::function<void()>>>(); //{live path, reverting swap}
+
+    const auto swap = [&]( const std::filesystem::path &live ) {
+        const auto staged        = queue.stagedPath( live );
+        const bool staged_exists = std::filesystem::exists( std::filesystem::symlink_status( staged ) );
+        const bool live_exists   = std::filesystem::exists( std::filesystem::symlink_status( live ) );
+
+        if( staged_exists && live_exists ) {
+            if( ::renameat2( AT_FDCWD, staged.c_str(), AT_FDCWD, live.c_str(), RENAME_EXCHANGE ) == 0 ) {
+                undo_steps.emplace_back( live, [staged, live]() {
+                    if( ::renameat2( AT_FDCWD, staged.c_str(), AT_FDCWD, live.c_str(), RENAME_EXCHANGE ) != 0 )
+                        throw std::filesystem::filesystem_error( "renameat2", staged, live, std::error_code( errno, std::generic_category() ) );
+                } );
+                return; //EARLY-RETURN
+            }
+
+            if( errno != EINVAL && errno != ENOSYS && errno != EOPNOTSUPP )
+                throw exception::file_access_failure(
+                    "Could not swap '" + staged.string() + "' with '" + live.string() + "': " + strerror( errno )
+                );
+
+            display.warning( "Atomic exchange not supported, replacing in 2 steps: " + live.string() );
+
+            auto previous = staged;
+            previous += ".previous";
+            std::filesystem::rename( live, previous );
+
+            try {
+                std::filesystem::rename( staged, live );
+            } catch( std::filesystem::filesystem_error &e ) {
+                std::filesystem::rename( previous, live );
+                throw;
+            }
+
+            undo_steps.emplace_back( live, [staged, live, previous]() {
+                std::filesystem::rename( live, staged );
+                std::filesystem::rename( previous, live );
+            } );
+
+        } else if( staged_exists ) {
+            std::filesystem::rename( staged, live );
+            undo_steps.emplace_back( live, [staged, live]() { std::filesystem::rename( live, staged ); } );
+
+        } else if( live_exists ) { //not generated anymore
+            std::filesystem::create_directories( staged.parent_path() );
+            std::filesystem::rename( live, staged );
+            undo_steps.emplace_back( live, [staged, live]() { std::filesystem::rename( staged, live ); } );
+        }
+    };
+
+    const auto rollback = [&]() { //swaps back the entries published so far (most recent first)
+        auto published = std::string();
+
+        while( !undo_steps.empty() ) {
+            try {
+                undo_steps.back().second();
+            } catch( std::exception &e ) {
+                display.error( "Could not restore the previous '" + undo_steps.back().first.string() + "': " + e.what() );
+                published += ( published.empty() ? "" : ", " ) + undo_steps.back().first.string();
+            }
+
+            undo_steps.pop_back();
+        }
+
+        return ( published.empty() ? std::string( " (previous generation restored)" )
+                                   : " (still published: " + published + ")" );
+    };
+
+    try {
+        swap( options._paths.posts_dir );
+        swap( options._paths.index_dir );
+        swap( options._paths.root_dir / options._filenames.landing );
+        swap( options._paths.root_dir / options._rss.file_name );
+
+    } catch( std::filesystem::filesystem_error &e ) {
+        const auto rolled_back = rollback();
+        throw exception::file_access_failure( "Could not publish the staged output: " + std::string( e.what() ) + rolled_back );
+    } catch( exception::file_access_failure &e ) {
+        const auto rolled_back = rollback();
+        throw exception::file_access_failure( e.what() + rolled_back );
+    }
+
+    try {
+        std::filesystem::remove_all( options._paths.stage_dir );
+    } catch( std::filesystem::filesystem_error &e ) {
+        throw exception::file_access_failure( "Could not remove the previous generation: " + std::string( e.what() ) );
+    }
+}
+
 /**
  * Imports the HTML templates to use
  * @param master_index Master Index DTO (with the paths to the html template files)
@@ -119,6 +341,7 @@ std::shared_ptr<blogator::dto::Templates> blogator::fs::importTemplates( const d
         extractTemplateRelPaths( master_index, *templates );
 
     getConsecutiveWritePositions( master_index, *templates );
+    compileTemplates( *templates );
 
     return std::move( templates );
 }
@@ -329,6 +552,29 @@ void blogator::fs::getConsecutiveWritePositions( const dto::Index &master_index,
     display.progress( "DONE" );
 }
 
+/**
+ * Compiles the render plans of all the Templates (templates shared between page types are compiled once)
+ * @param templates Templates DTO
+ */
+void blogator::fs::compileTemplates( dto::Templates &templates ) {
+    auto compile = []( dto::Template &t ) {
+        if( !t.plan )
+            t.compile();
+    };
+
+    compile( *templates._landing );
+    compile( *templates._post );
+    compile( *templates._index );
+    compile( *templates._index_list );
+    compile( *templates._year_list );
+    compile( *templates._year_index );
+    compile( *templates._tag_list );
+    compile( *templates._tag_index );
+    compile( *templates._author_list );
+    compile( *templates._author_index );
+    compile( *templates._index_entry );
+}
+
 /**
  * Reads in the content of a file into a string
  * @param path Path of file to read
@@ -463,6 +709,22 @@ std::filesystem::path blogator::fs::adaptRelPath( const std::filesystem::path &
     }
 }
 
+/**
+ * Adapts a relative path based on a new location and encodes it for a URL
+ * (memoized for all threads as the result only depends on the source/target directories and the path)
+ * @param source_file Source file where the path was lifted from
+ * @param target_file Target file where the path will be written to
+ * @param rel_path    Relative path
+ * @return URL encoded modified relative path (or original if an error has occurred)
+ */
+const std::string & blogator::fs::adaptRelPathURL( const std::filesystem::path &source_file,
+                                                   const std::filesystem::path &target_file,
+                                                   const std::filesystem::path &rel_path )
+{
+    static auto cache = RelPathCache();
+    return cache.get( source_file, target_file, rel_path );
+}
+
 /**
  * Checks all relative paths found in the template files
  * @param templates    Master templates DTO
@@ -14,15 +14,19 @@ namespace blogator::fs {
     void setupEnvironment( const std::shared_ptr<dto::Options>& global_options );
 
     uintmax_t purge( const dto::Options &options );
+    uintmax_t removeStaleOutputs( const dto::Options &options );
+    void publishStagedOutput( const dto::Options &options );
     std::shared_ptr<dto::Templates> importTemplates( const dto::Index &master_index, const dto::Options &options );
     void importTemplateHTML( const dto::Index &master_index, dto::Templates &templates );
     void extractTemplateRelPaths( const dto::Index &master_index, dto::Templates &templates );
     void getConsecutiveWritePositions( const dto::Index &master_index, dto::Templates &templates );
+    void compileTemplates( dto::Templates &templates );
 
     std::string readFileContent( const std::filesystem::path &path );
     std::unique_ptr<dto::HTML> importHTML( const std::filesystem::path &file_path );
     dto::HTML importHTML( const std::filesystem::path &file_path, const std::list<dto::SeekRange> &positions );
     std::filesystem::path adaptRelPath( const std::filesystem::path &source_file, const std::filesystem::path &target_file, const std::filesystem::path &rel_path );
+    const std::string & adaptRelPathURL( const std::filesystem::path &source_file, const std::filesystem::path &target_file, const std::filesystem::path &rel_path );
     void   checkTemplateRelPaths( const dto::Index &master_index, const dto::Templates &templates, const dto::Options &options );
     size_t checkTemplateRelPaths( const dto::Template &src_template );
     size_t checkRelPaths( const std::filesystem::path &root, const std::filesystem::path &parent, const dto::ConsecutivePathPositions_t &path_pos );
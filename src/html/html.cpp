@@ -212,7 +212,9 @@ std::unique_ptr<blogator::dto::IndexTagTree>
     html::writer::openTree( *tree );
 
     for( const auto &tag : master_index._indices.byTag.cats ) {
-        html::writer::openTagNode( tag.first, *tree );
+        const auto &tag_name = master_index._indices.byTag.name( tag.first );
+
+        html::writer::openTagNode( tag.first, tag_name, *tree );
 
         for( auto article_i : tag.second.article_indices ) {
             try {
@@ -223,7 +225,7 @@ std::unique_ptr<blogator::dto::IndexTagTree>
             } catch( std::out_of_range &e ) {
                 std::stringstream ss;
                 ss << "Could not find article in i=" << article_i
-                   << " referenced in tag '" << tag.first << "'. Skipping.";
+                   << " referenced in tag '" << tag_name << "'. Skipping.";
                 display.error( ss.str() );
             }
         }
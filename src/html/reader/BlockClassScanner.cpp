@@ -0,0 +1,104 @@
+#include "BlockClassScanner.h"
+
+#include <algorithm>
+
+#include "markup.h"
+
+/**
+ * Constructor
+ * @param blocks Block classes to look for (usage flags are set as classes are found)
+ */
+blogator::html::reader::BlockClassScanner::BlockClassScanner( dto::Template::BlockInsertClasses_t &blocks ) :
+    _min_length( std::string::npos ),
+    _max_length( 0 )
+{
+    for( auto it = blocks.begin(); it != blocks.end(); ++it ) {
+        const auto &name = it->first;
+
+        if( !name.empty() && std::all_of( name.cbegin(), name.cend(), []( char c ) { return markup::isClassChar( c ) && !markup::isSpace( c ); } ) ) {
+            _lookup.emplace( std::string_view( name ), _classes.size() );
+            _min_length = std::min( _min_length, name.size() );
+            _max_length = std::max( _max_length, name.size() );
+        } else {
+            _literals.emplace_back( _classes.size() );
+        }
+
+        _classes.emplace_back( it );
+    }
+
+    _found.resize( _classes.size() );
+}
+
+/**
+ * Scans a line for the insertion points of all the block classes
+ * @param line        Line of html
+ * @param line_number Line number
+ * @param write_pos   Insertion points container to add the positions found to
+ */
+void blogator::html::reader::BlockClassScanner::scan( const std::string &line,
+                                                      size_t line_number,
+                                                      dto::ConsecutiveWritePositions_t &write_pos )
+{
+    const auto terminator = line.find_first_of( "\r\n" ); //elements must start before any line terminator
+    const auto line_view  = std::string_view( line );
+
+    std::fill( _found.begin(), _found.end(), std::string::npos );
+
+    if( !_lookup.empty() ) {
+        for( auto open = line.find( '<' ); open < terminator; open = line.find( '<', open + 1 ) ) {
+            const auto value_begin = markup::matchClassAttribute( line, open );
+
+            if( value_begin == std::string::npos )
+                continue;
+
+            const auto value_end = markup::skipClassChars( line, value_begin );
+            const auto close     = markup::matchBlockEnd( line, value_end );
+
+            if( close == std::string::npos )
+                continue;
+
+            auto token_begin = markup::skipSpaces( line, value_begin );
+
+            while( token_begin < value_end ) {
+                auto token_end = token_begin;
+
+                while( token_end < value_end && !markup::isSpace( line[ token_end ] ) )
+                    ++token_end;
+
+                //any of the token's suffixes can be a class (e.g.: "page-nav" in "top-page-nav")
+                auto i = ( token_end - token_begin > _max_length ? token_end - _max_length : token_begin );
+
+                for( ; i + _min_length <= token_end; ++i ) {
+                    auto it = _lookup.find( line_view.substr( i, token_end - i ) );
+
+                    if( it != _lookup.end() )
+                        _found[ it->second ] = close; //later elements take precedence
+                }
+
+                token_begin = markup::skipSpaces( line, token_end );
+            }
+        }
+    }
+
+    for( const auto &i : _literals ) {
+        auto open = line.rfind( '<', terminator );
+
+        while( open != std::string::npos ) {
+            const auto close = markup::matchClassBlock( line, open, _classes[ i ]->first );
+
+            if( close != std::string::npos ) {
+                _found[ i ] = close;
+                break;
+            }
+
+            open = ( open > 0 ? line.rfind( '<', open - 1 ) : std::string::npos );
+        }
+    }
+
+    for( size_t i = 0; i < _classes.size(); ++i ) {
+        if( _found[ i ] != std::string::npos ) {
+            _classes[ i ]->second = true; //class is used
+            write_pos.insert( std::make_pair( dto::InsertPosition( line_number, _found[ i ] ), _classes[ i ]->first ) );
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef BLOGATOR_HTML_READER_BLOCKCLASSSCANNER_H
+#define BLOGATOR_HTML_READER_BLOCKCLASSSCANNER_H
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../../dto/Template.h"
+
+namespace blogator::html::reader {
+    /**
+     * Single pass finder for the insertion points of all the block classes of a template
+     *
+     * An insertion point is the closing tag of an empty element (i.e.: `<div class="a b"></div>`)
+     * whose leading 'class' attribute has a token ending with the block class. When more than one
+     * element qualifies for a class on a line, the last one is used. The class attribute tokens of
+     * every element are looked up in a hash map of the block classes so all the classes are matched
+     * in the same walk through the line. Classes with characters outside of [a-zA-Z-_] are matched
+     * literally element by element instead.
+     */
+    class BlockClassScanner {
+      public:
+        explicit BlockClassScanner( dto::Template::BlockInsertClasses_t &blocks );
+
+        void scan( const std::string &line, size_t line_number, dto::ConsecutiveWritePositions_t &write_pos );
+
+      private:
+        typedef dto::Template::BlockInsertClasses_t::iterator ClassIterator_t;
+
+        std::vector<ClassIterator_t>                 _classes;   //block classes (in map order)
+        std::unordered_map<std::string_view, size_t> _lookup;    //{K=class name, V=index in _classes}
+        std::vector<size_t>                          _literals;  //indices of classes matched literally
+        std::vector<std::string::size_type>          _found;     //insertion column of each class on the current line
+        size_t                                       _min_length;
+        size_t                                       _max_length;
+    };
+}
+
+#endif //BLOGATOR_HTML_READER_BLOCKCLASSSCANNER_H
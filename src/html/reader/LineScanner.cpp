@@ -0,0 +1,264 @@
+#include "LineScanner.h"
+
+#include <cstring>
+#include <algorithm>
+
+namespace blogator::html::reader {
+    /**
+     * Marker strings (indexed by LineScanner::Marker, partial for the candidate markers)
+     */
+    static const std::array<std::string_view, static_cast<size_t>( LineScanner::Marker::COUNT )> MARKER_STR = {
+        "<span class=\"title\">",
+        "<span class=\"author\">",
+        "<span class=\"tag\">",
+        "<span class=\"summary\">",
+        "</span>",
+        "<time datetime=\"",
+        "<h",
+        "<"
+    };
+}
+
+/**
+ * Scans a line for all the markers
+ * @param line Line of html (must outlive the scanner's queries)
+ */
+void blogator::html::reader::LineScanner::scan( const std::string &line ) {
+    for( auto &h : _hits )
+        h.clear();
+
+    _line = std::string_view( line );
+
+    const char * begin = _line.data();
+    const char * end   = _line.data() + _line.size();
+    const char * curr  = begin;
+
+    while( curr < end && ( curr = static_cast<const char *>( std::memchr( curr, '<', end - curr ) ) ) != nullptr ) {
+        scanTag( curr - begin );
+        ++curr;
+    }
+}
+
+/**
+ * Gets all the hit positions of a marker on the current line
+ * @param marker Marker
+ * @return Positions (ascending)
+ */
+const std::vector<size_t> & blogator::html::reader::LineScanner::hits( Marker marker ) const {
+    return _hits[ static_cast<size_t>( marker ) ];
+}
+
+/**
+ * Checks if a marker was found on the current line
+ * @param marker Marker
+ * @return Found state
+ */
+bool blogator::html::reader::LineScanner::found( Marker marker ) const {
+    return !hits( marker ).empty();
+}
+
+/**
+ * Gets the position of the first hit of a marker at or after a position (equivalent of std::string::find)
+ * @param marker Marker
+ * @param from   Position to search from
+ * @return Position of the hit or std::string::npos if none
+ */
+size_t blogator::html::reader::LineScanner::next( Marker marker, size_t from ) const {
+    const auto &h  = hits( marker );
+    auto        it = std::lower_bound( h.cbegin(), h.cend(), from );
+    return ( it != h.cend() ? *it : std::string::npos );
+}
+
+/**
+ * Gets the content between the first 'from' marker and the first 'to' marker after it
+ * (equivalent of html::reader::getContentBetween)
+ * @param from Starting marker
+ * @param to   Finishing marker
+ * @return Content found
+ */
+std::string blogator::html::reader::LineScanner::contentBetween( Marker from, Marker to ) const {
+    auto i_begin = next( from, 0 );
+
+    if( i_begin != std::string::npos ) {
+        auto range_begin = i_begin + length( from );
+        auto i_end       = next( to, range_begin );
+
+        if( i_end != std::string::npos )
+            return std::string( _line.substr( range_begin, i_end - range_begin ) );
+    }
+
+    return std::string();
+}
+
+/**
+ * Gets the content between the first 'from' marker and the first 'to' character after it
+ * (equivalent of html::reader::getContentBetween)
+ * @param from Starting marker
+ * @param to   Finishing character
+ * @return Content found
+ */
+std::string blogator::html::reader::LineScanner::contentBetween( Marker from, char to ) const {
+    auto i_begin = next( from, 0 );
+
+    if( i_begin != std::string::npos ) {
+        auto range_begin = i_begin + length( from );
+        auto i_end       = _line.find( to, range_begin );
+
+        if( i_end != std::string::npos )
+            return std::string( _line.substr( range_begin, i_end - range_begin ) );
+    }
+
+    return std::string();
+}
+
+/**
+ * Gets all the content between any repeating marker range
+ * (equivalent of html::reader::getContentsBetween)
+ * @param from Starting marker
+ * @param to   Finishing marker
+ * @return Contents found
+ */
+std::vector<std::string> blogator::html::reader::LineScanner::contentsBetween( Marker from, Marker to ) const {
+    auto content = std::vector<std::string>();
+    auto i_begin = next( from, 0 );
+
+    while( i_begin != std::string::npos ) {
+        auto range_begin = i_begin + length( from );
+        auto i_end       = next( to, range_begin );
+
+        if( i_end == std::string::npos )
+            break;
+
+        content.emplace_back( _line.substr( range_begin, i_end - range_begin ) );
+        i_begin = next( from, i_end );
+    }
+
+    return content;
+}
+
+/**
+ * Gets the positions of the start and finish of a summary or summaries on the current line
+ * (equivalent of html::reader::getSummaryPositions)
+ * @param line_number Current line number
+ * @param positions   Container for all positions found
+ */
+void blogator::html::reader::LineScanner::summaryPositions( const size_t &line_number,
+                                                            std::deque<dto::InsertPosition> &positions ) const
+{
+    if( !found( Marker::SUMMARY ) && ( positions.size() % 2 == 0 || !found( Marker::SPAN_CLOSE ) ) )
+        return; //nothing to find
+
+    while( true ) {
+        const size_t from = ( positions.empty() || positions.back().line != line_number )
+                            ? 0
+                            : positions.back().col;
+
+        if( positions.size() % 2 == 0 ) { //need to find opening tag
+            auto summary_begin = next( Marker::SUMMARY, from );
+
+            if( summary_begin == std::string::npos )
+                return;
+
+            positions.emplace_back( dto::InsertPosition( line_number, summary_begin + length( Marker::SUMMARY ) ) );
+
+        } else { //need to find a closing tag
+            auto summary_end = next( Marker::SPAN_CLOSE, from );
+
+            if( summary_end == std::string::npos )
+                return;
+
+            positions.emplace_back( dto::InsertPosition( line_number, summary_end ) );
+        }
+    }
+}
+
+/**
+ * Gets the character length of a marker
+ * @param marker Marker
+ * @return Length
+ */
+size_t blogator::html::reader::LineScanner::length( Marker marker ) {
+    return MARKER_STR[ static_cast<size_t>( marker ) ].length();
+}
+
+/**
+ * Adds a marker hit
+ * @param marker Marker
+ * @param pos    Position in the line
+ */
+void blogator::html::reader::LineScanner::addHit( Marker marker, size_t pos ) {
+    _hits[ static_cast<size_t>( marker ) ].emplace_back( pos );
+}
+
+/**
+ * Identifies the marker(s) starting at a '<' character
+ * @param pos Position of the '<' in the line
+ */
+void blogator::html::reader::LineScanner::scanTag( size_t pos ) {
+    static const std::string_view span_open  = "<span class=\"";
+    static const std::string_view span_close = "\">";
+
+    auto startsWith = [&]( size_t i, std::string_view str ) {
+        return _line.compare( i, str.size(), str ) == 0;
+    };
+
+    auto isAlnum = []( char c ) {
+        return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) || ( c >= '0' && c <= '9' );
+    };
+
+    auto skipSpaces = [&]( size_t i ) { //same set as the regex '\s' in the classic locale: ' ', '\t', '\n', '\v', '\f', '\r'
+        while( i < _line.size() && ( _line[ i ] == ' ' || ( _line[ i ] >= '\t' && _line[ i ] <= '\r' ) ) )
+            ++i;
+        return i;
+    };
+
+    const size_t after = pos + 1;
+
+    if( after >= _line.size() )
+        return;
+
+    //Exact markers
+    if( _line[ after ] == 's' && startsWith( pos, span_open ) ) {
+        const size_t cls = pos + span_open.size();
+
+        for( auto m : { Marker::TITLE, Marker::AUTHOR, Marker::TAG, Marker::SUMMARY } ) {
+            const auto &str  = MARKER_STR[ static_cast<size_t>( m ) ];
+            const auto  name = str.substr( span_open.size(), str.size() - span_open.size() - span_close.size() );
+
+            if( startsWith( cls, name ) && startsWith( cls + name.size(), span_close ) ) {
+                addHit( m, pos );
+                break;
+            }
+        }
+
+    } else if( _line[ after ] == '/' && startsWith( pos, MARKER_STR[ static_cast<size_t>( Marker::SPAN_CLOSE ) ] ) ) {
+        addHit( Marker::SPAN_CLOSE, pos );
+        return;
+
+    } else if( _line[ after ] == 't' && startsWith( pos, MARKER_STR[ static_cast<size_t>( Marker::DATE ) ] ) ) {
+        addHit( Marker::DATE, pos );
+    }
+
+    //Candidate markers: '<\s*h' (heading) and '<\s*[a-zA-Z\d]+\s*class' (ToC block)
+    auto i = skipSpaces( after );
+
+    if( i < _line.size() && _line[ i ] == 'h' )
+        addHit( Marker::HEADING, pos );
+
+    const auto name_begin = i;
+
+    while( i < _line.size() && isAlnum( _line[ i ] ) )
+        ++i;
+
+    if( i > name_begin ) {
+        static const std::string_view class_str = "class";
+
+        const auto name_len = i - name_begin;
+
+        if( startsWith( skipSpaces( i ), class_str ) ||
+            ( name_len > class_str.size() && _line.compare( i - class_str.size(), class_str.size(), class_str ) == 0 ) )
+        {
+            addHit( Marker::CLASS_ATTR, pos );
+        }
+    }
+}
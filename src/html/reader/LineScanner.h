@@ -0,0 +1,59 @@
+#ifndef BLOGATOR_HTML_READER_LINESCANNER_H
+#define BLOGATOR_HTML_READER_LINESCANNER_H
+
+#include <array>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../dto/InsertPosition.h"
+
+namespace blogator::html::reader {
+    /**
+     * Single pass scanner for all the markup markers looked for in a post's source line
+     *
+     * Every marker starts with a '<' so the line is only ever inspected at the positions
+     * returned by memchr. All the hits are recorded in one pass and the queries then
+     * replicate the semantics of the find-based reader functions (getContentBetween,
+     * getContentsBetween and getSummaryPositions) using those hits.
+     */
+    class LineScanner {
+      public:
+        enum class Marker {
+            TITLE = 0,  //<span class="title">
+            AUTHOR,     //<span class="author">
+            TAG,        //<span class="tag">
+            SUMMARY,    //<span class="summary">
+            SPAN_CLOSE, //</span>
+            DATE,       //<time datetime="
+            HEADING,    //'<' followed by optional whitespace and 'h' (heading candidate)
+            CLASS_ATTR, //element whose first attribute is 'class' (ToC block candidate)
+            COUNT
+        };
+
+        void scan( const std::string &line );
+
+        [[nodiscard]] const std::vector<size_t> & hits( Marker marker ) const;
+        [[nodiscard]] bool found( Marker marker ) const;
+        [[nodiscard]] size_t next( Marker marker, size_t from ) const;
+
+        [[nodiscard]] std::string contentBetween( Marker from, Marker to ) const;
+        [[nodiscard]] std::string contentBetween( Marker from, char to ) const;
+        [[nodiscard]] std::vector<std::string> contentsBetween( Marker from, Marker to ) const;
+        void summaryPositions( const size_t &line_number, std::deque<dto::InsertPosition> &positions ) const;
+
+        static size_t length( Marker marker );
+
+      private:
+        typedef std::array<std::vector<size_t>, static_cast<size_t>( Marker::COUNT )> Hits_t;
+
+        std::string_view _line;
+        Hits_t           _hits;
+
+        void addHit( Marker marker, size_t pos );
+        void scanTag( size_t pos );
+    };
+}
+
+#endif //BLOGATOR_HTML_READER_LINESCANNER_H
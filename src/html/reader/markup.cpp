@@ -0,0 +1,158 @@
+#include "markup.h"
+
+/**
+ * Matches the start of an element with a leading class attribute (i.e.: `<tag class="`)
+ * @param line Line of html
+ * @param open Position of the element's '<'
+ * @return Position of the start of the class attribute's value (npos when not matched)
+ */
+std::string::size_type blogator::html::reader::markup::matchClassAttribute( const std::string &line,
+                                                                            std::string::size_type open )
+{
+    static const std::string attribute = "class";
+
+    const auto tag_begin = skipSpaces( line, open + 1 );
+    const auto tag_end   = skipAlnum( line, tag_begin );
+
+    if( tag_end == tag_begin )
+        return std::string::npos;
+
+    auto i = skipSpaces( line, tag_end );
+
+    if( line.compare( i, attribute.size(), attribute ) == 0 ) { //i.e.: "<tag class="
+        i = skipSpaces( line, i + attribute.size() );
+    } else if( tag_end - tag_begin <= attribute.size() || line.compare( tag_end - attribute.size(), attribute.size(), attribute ) != 0 ) {
+        return std::string::npos; //(tag names ending in 'class' can act as the attribute too, i.e.: "<tagclass=")
+    }
+
+    if( i >= line.size() || line[ i ] != '=' )
+        return std::string::npos;
+
+    i = skipSpaces( line, i + 1 );
+
+    if( i >= line.size() || line[ i ] != '"' )
+        return std::string::npos;
+
+    return i + 1;
+}
+
+/**
+ * Matches the end of an empty block element (i.e.: `">  </tag>`)
+ * @param line  Line of html
+ * @param quote Position of the class attribute value's closing quote
+ * @return Position of the closing tag (npos when not matched)
+ */
+std::string::size_type blogator::html::reader::markup::matchBlockEnd( const std::string &line,
+                                                                      std::string::size_type quote )
+{
+    if( quote >= line.size() || line[ quote ] != '"' )
+        return std::string::npos;
+    if( quote + 1 >= line.size() || line[ quote + 1 ] != '>' )
+        return std::string::npos;
+
+    const auto close = skipSpaces( line, quote + 2 );
+
+    if( line.compare( close, 2, "</" ) != 0 )
+        return std::string::npos;
+
+    const auto close_end = skipAlnum( line, close + 2 );
+
+    return ( close_end > close + 2 && close_end < line.size() && line[ close_end ] == '>' )
+           ? close
+           : std::string::npos;
+}
+
+/**
+ * Matches an empty block element with a css class in its leading class attribute (i.e.: `<tag class="a css_class b"></tag>`)
+ * (the last possible position of the css class in the attribute value is tried first)
+ * @param line      Line of html
+ * @param open      Position of the element's '<'
+ * @param css_class CSS class
+ * @return Position of the closing tag (npos when not matched)
+ */
+std::string::size_type blogator::html::reader::markup::matchClassBlock( const std::string &line,
+                                                                        std::string::size_type open,
+                                                                        const std::string &css_class )
+{
+    const auto value_begin = matchClassAttribute( line, open );
+
+    if( value_begin == std::string::npos )
+        return std::string::npos;
+
+    const auto value_end = skipClassChars( line, value_begin );
+
+    for( auto col = value_end + 1; col-- > value_begin; ) { //last possible css class position first
+        if( line.compare( col, css_class.size(), css_class ) != 0 )
+            continue;
+
+        auto quote = col + css_class.size();
+
+        if( quote < line.size() && isSpace( line[ quote ] ) ) //rest of the class attribute's value
+            quote = skipClassChars( line, quote + 1 );
+
+        const auto close = matchBlockEnd( line, quote );
+
+        if( close != std::string::npos )
+            return close;
+    }
+
+    return std::string::npos;
+}
+
+/**
+ * Checks if a character is a whitespace (' ', '\t', '\n', '\v', '\f', '\r')
+ * @param c Character
+ * @return Whitespace state
+ */
+bool blogator::html::reader::markup::isSpace( char c ) {
+    return c == ' ' || ( c >= '\t' && c <= '\r' );
+}
+
+/**
+ * Checks if a character can be part of a class attribute value ([a-zA-Z-_] or whitespace)
+ * @param c Character
+ * @return Class character state
+ */
+bool blogator::html::reader::markup::isClassChar( char c ) {
+    return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) || c == '-' || c == '_' || isSpace( c );
+}
+
+/**
+ * Gets the position of the first non-whitespace character from a position
+ * @param str String
+ * @param pos Starting position
+ * @return Position after the whitespace
+ */
+std::string::size_type blogator::html::reader::markup::skipSpaces( const std::string &str, std::string::size_type pos ) {
+    while( pos < str.size() && isSpace( str[ pos ] ) )
+        ++pos;
+    return pos;
+}
+
+/**
+ * Gets the position of the first non-alphanumeric ([a-zA-Z0-9]) character from a position
+ * @param str String
+ * @param pos Starting position
+ * @return Position after the alphanumeric characters
+ */
+std::string::size_type blogator::html::reader::markup::skipAlnum( const std::string &str, std::string::size_type pos ) {
+    while( pos < str.size() && ( ( str[ pos ] >= 'a' && str[ pos ] <= 'z' ) ||
+                                 ( str[ pos ] >= 'A' && str[ pos ] <= 'Z' ) ||
+                                 ( str[ pos ] >= '0' && str[ pos ] <= '9' ) ) )
+    {
+        ++pos;
+    }
+    return pos;
+}
+
+/**
+ * Gets the position of the first character from a position that cannot be part of a class attribute value
+ * @param str String
+ * @param pos Starting position
+ * @return Position after the class attribute value characters
+ */
+std::string::size_type blogator::html::reader::markup::skipClassChars( const std::string &str, std::string::size_type pos ) {
+    while( pos < str.size() && isClassChar( str[ pos ] ) )
+        ++pos;
+    return pos;
+}
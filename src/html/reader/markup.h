@@ -0,0 +1,22 @@
+#ifndef BLOGATOR_HTML_READER_MARKUP_H
+#define BLOGATOR_HTML_READER_MARKUP_H
+
+#include <string>
+
+/**
+ * Character level matchers for the markup looked for in templates and posts
+ * (shared by the template block class scanner and the Table of Contents' block finder)
+ */
+namespace blogator::html::reader::markup {
+    std::string::size_type matchClassAttribute( const std::string &line, std::string::size_type open );
+    std::string::size_type matchBlockEnd( const std::string &line, std::string::size_type quote );
+    std::string::size_type matchClassBlock( const std::string &line, std::string::size_type open, const std::string &css_class );
+
+    bool isSpace( char c );
+    bool isClassChar( char c );
+    std::string::size_type skipSpaces( const std::string &str, std::string::size_type pos );
+    std::string::size_type skipAlnum( const std::string &str, std::string::size_type pos );
+    std::string::size_type skipClassChars( const std::string &str, std::string::size_type pos );
+}
+
+#endif //BLOGATOR_HTML_READER_MARKUP_H
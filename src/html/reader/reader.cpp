@@ -1,7 +1,8 @@
 #include "reader.h"
+#include "BlockClassScanner.h"
 #include <iostream>
+#include <algorithm>
 #include <fstream>
-#include <regex>
 
 /**
  * Gets any content between 2 strings in a string
@@ -141,6 +142,41 @@ void blogator::html::reader::getSummaryPositions( const size_t & line_number,
     }
 }
 
+/**
+ * Gets the summary content on a line based on the summary positions found up to and including that line
+ * (each complete summary range is added as a single line to the summary HTML, as fs::importHTML(..) does)
+ * @param line      Line
+ * @param positions Summary positions (open/close pairs as found by getSummaryPositions(..))
+ * @param consumed  Number of positions already processed from previous lines (updated)
+ * @param buffer    Content of the summary range still open from previous lines (updated)
+ * @param summary   Summary HTML DTO to add the completed ranges to
+ */
+void blogator::html::reader::getSummaryContent( const std::string &line,
+                                                const std::deque<dto::InsertPosition> &positions,
+                                                size_t &consumed,
+                                                std::string &buffer,
+                                                dto::HTML &summary )
+{
+    bool   is_open = ( consumed % 2 > 0 );
+    size_t col     = 0;
+
+    for( ; consumed < positions.size(); ++consumed ) { //any unprocessed positions are on the current line
+        if( consumed % 2 == 0 ) { //opening
+            col     = positions[ consumed ].col;
+            is_open = true;
+
+        } else { //closing
+            buffer.append( line, col, positions[ consumed ].col - col );
+            summary._lines.emplace_back( buffer );
+            buffer.clear();
+            is_open = false;
+        }
+    }
+
+    if( is_open )
+        buffer.append( line, col, std::string::npos );
+}
+
 /**
  * Gets the first set of tags found in a string
  * @param str Html text
@@ -187,25 +223,11 @@ blogator::dto::ConsecutiveWritePositions_t
                                                           blogator::dto::Template::BlockInsertClasses_t &blocks )
 {
     auto   write_pos   = dto::ConsecutiveWritePositions_t();
+    auto   scanner     = BlockClassScanner( blocks );
     size_t line_number = 0;
 
     for( const auto &line : html._lines ) {
-        for( auto &css_class : blocks ) {
-            auto s  = R"(^(.*<\s*[a-zA-Z\d]+\s*class\s*=\s*"[a-zA-Z-_\s]*)" + css_class.first + R"((?:\s[a-zA-Z-_\s]*"|")>\s*)(?:</[a-zA-Z\d]+>))";
-            auto rx = std::regex( s );
-            auto it = std::sregex_iterator( line.begin(), line.end(), rx );
-
-            if( it != std::sregex_iterator() )
-                css_class.second = true; //class is used
-
-            while( it != std::sregex_iterator() ) {
-                write_pos.insert(
-                    std::make_pair( dto::InsertPosition( line_number, it->str( 1 ).length() ), css_class.first )
-                );
-                ++it;
-            }
-        }
-
+        scanner.scan( line, line_number, write_pos ); //all the block classes in one pass
         ++line_number;
     }
 
@@ -217,13 +239,13 @@ blogator::dto::ConsecutiveWritePositions_t
  * @param line String line
  * @return Indent string
  */
-std::string blogator::html::reader::getIndent( const std::string &line ) {
+std::string blogator::html::reader::getIndent( std::string_view line ) {
     if( line.empty() )
         return "";
 
-    const auto char_it = find_if( line.begin(),
-                                  line.end(),
-                                  []( char c ) { return !isspace( c ); } );
+    const auto char_it = std::find_if( line.begin(),
+                                       line.end(),
+                                       []( char c ) { return !isspace( c ); } );
 
-    return line.substr( 0, char_it - line.begin() );
+    return std::string( line.substr( 0, char_it - line.begin() ) );
 }
\ No newline at end of file
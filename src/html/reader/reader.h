@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <deque>
 #include <string>
+#include <string_view>
 
 #include "../../dto/Article.h"
 #include "../../dto/HTML.h"
@@ -15,9 +16,10 @@ namespace blogator::html::reader {
     dto::HTML   getContentBetween( const std::string &from, const std::string &to, const dto::HTML &html ); //TODO remove? not currently used
     std::vector<std::string> getContentsBetween( const std::string &from, const std::string &to, const std::string &str );
     void getSummaryPositions( const size_t &line_number, const std::string &line, std::deque<dto::InsertPosition> &positions );
+    void getSummaryContent( const std::string &line, const std::deque<dto::InsertPosition> &positions, size_t &consumed, std::string &buffer, dto::HTML &summary );
     std::vector<std::string> getTags( const std::string &str );
     dto::ConsecutiveWritePositions_t getConsecutiveWritePositions( const dto::HTML &html, dto::Template::BlockInsertClasses_t &blocks );
-    std::string getIndent( const std::string &line );
+    std::string getIndent( std::string_view line );
 }
 
 #endif //BLOGATOR_HTML_READER_H
\ No newline at end of file
@@ -170,13 +170,15 @@ void blogator::html::writer::closeTree( blogator::dto::IndexTagTree &tag_tree )
 
 /**
  * Opens a new tag node on a HTML ordered list (<ol>)
+ * @param tag_id   Tag ID
  * @param tag      Tag string
  * @param tag_tree IndexPane::TagTree container
  */
-void blogator::html::writer::openTagNode( const std::string & tag,
+void blogator::html::writer::openTagNode( blogator::dto::Dictionary::ID_t tag_id,
+                                          const std::string & tag,
                                           blogator::dto::IndexTagTree &tag_tree )
 {
-    tag_tree.tag_line_map.emplace( std::make_pair( tag, tag_tree.html._lines.size() ) );
+    tag_tree.tag_line_map.emplace( std::make_pair( tag_id, tag_tree.html._lines.size() ) );
 
     auto id_number = std::to_string( tag_tree.tag_line_map.size() );
 
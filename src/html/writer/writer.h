@@ -26,7 +26,7 @@ namespace blogator::html::writer {
 
     void openTree( dto::IndexTagTree &tag_tree );
     void closeTree( dto::IndexTagTree &tag_tree );
-    void openTagNode( const std::string &tag, dto::IndexTagTree &tag_tree );
+    void openTagNode( dto::Dictionary::ID_t tag_id, const std::string &tag, dto::IndexTagTree &tag_tree );
     void closeTagNode( dto::IndexTagTree &tag_tree );
     void addArticleLeaf( const dto::Article &article, const size_t &article_pos, dto::IndexTagTree &tag_tree );
 
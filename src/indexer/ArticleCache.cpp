@@ -0,0 +1,412 @@
+#include "ArticleCache.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "../exception/file_parsing_failure.h"
+
+/**
+ * Constructor
+ * @param global_options Global blogator options
+ */
+blogator::indexer::ArticleCache::ArticleCache( const dto::Options &global_options ) :
+    _options( global_options )
+{
+    auto root_hash = std::hash<std::string>()( _options._paths.root_dir.lexically_normal().string() );
+
+    std::stringstream ss;
+    ss << "articles_" << std::hex << root_hash << ".cache";
+
+    _cache_path  = _options._paths.temp_dir / ss.str();
+    _fingerprint = createFingerprint();
+}
+
+/**
+ * Gets the modification stamp of a file
+ * @param path File path
+ * @return Stamp (empty if the file could not be stat-ed)
+ */
+std::optional<blogator::indexer::ArticleCache::Stamp> blogator::indexer::ArticleCache::stamp( const std::filesystem::path &path ) {
+    std::error_code ec;
+
+    auto mtime = std::filesystem::last_write_time( path, ec );
+    if( ec )
+        return std::nullopt;
+
+    auto size = std::filesystem::file_size( path, ec );
+    if( ec )
+        return std::nullopt;
+
+    return Stamp { static_cast<int64_t>( mtime.time_since_epoch().count() ), static_cast<uint64_t>( size ) };
+}
+
+/**
+ * Loads the cache file
+ * @return Success (false if there is no cache file or it was made with different parsing options)
+ */
+bool blogator::indexer::ArticleCache::load() {
+    auto &display = cli::MsgInterface::getInstance();
+
+    std::ifstream in( _cache_path, std::ios::binary );
+
+    if( !in.is_open() )
+        return false;
+
+    try {
+        if( read<uint32_t>( in ) != FORMAT_VERSION || readString( in ) != _fingerprint ) {
+            display.debug( "Article cache is out of date: " + _cache_path.string() );
+            return false;
+        }
+
+        auto count = read<uint64_t>( in );
+
+        for( uint64_t i = 0; i < count; ++i ) {
+            auto key   = readString( in );
+            auto entry = Entry();
+            readEntry( in, entry );
+            _cached.insert_or_assign( key, std::move( entry ) );
+        }
+
+    } catch( exception::file_parsing_failure &e ) {
+        _cached.clear();
+        display.debug( "Article cache could not be read (" + std::string( e.what() ) + "): " + _cache_path.string() );
+        return false;
+    }
+
+    display.debug( "Article cache loaded (" + std::to_string( _cached.size() ) + " entries): " + _cache_path.string() );
+    return true;
+}
+
+/**
+ * Saves the entries of the current run to the cache file
+ */
+void blogator::indexer::ArticleCache::save() const {
+    auto &display = cli::MsgInterface::getInstance();
+    auto  tmp     = _cache_path;
+
+    tmp += ".tmp";
+
+    try {
+        std::filesystem::create_directories( _cache_path.parent_path() );
+
+        {
+            std::ofstream out( tmp, std::ios::binary | std::ios::trunc );
+
+            if( !out.is_open() ) {
+                display.warning( "Could not write article cache: " + tmp.string() );
+                return;
+            }
+
+            write( out, FORMAT_VERSION );
+            write( out, _fingerprint );
+            write( out, static_cast<uint64_t>( _indexed.size() ) );
+
+            for( const auto &e : _indexed )
+                writeEntry( out, e.first, e.second );
+        }
+
+        std::filesystem::rename( tmp, _cache_path );
+
+    } catch( std::filesystem::filesystem_error &e ) {
+        display.warning( "Could not write article cache: " + std::string( e.what() ) );
+    }
+}
+
+/**
+ * Fetches a cached article
+ * @param path     Source path of the article
+ * @param stamp    Current modification stamp of the source file
+ * @param article  Article DTO to populate with the cached properties
+ * @param messages Buffer to populate with the messages emitted when the article was parsed
+ * @return Success (false if no up-to-date entry exists for the path)
+ */
+bool blogator::indexer::ArticleCache::fetch( const std::filesystem::path &path,
+                                             const Stamp &stamp,
+                                             dto::Article &article,
+                                             cli::MsgInterface::MsgBuffer_t &messages ) const
+{
+    auto it = _cached.find( path.string() );
+
+    if( it == _cached.end() || it->second.stamp != stamp )
+        return false;
+
+    article  = it->second.article;
+    messages = it->second.messages;
+    return true;
+}
+
+/**
+ * Stores an article's properties to be saved in the cache file
+ * @param article  Article DTO (freshly indexed)
+ * @param stamp    Modification stamp of the article's source file at the time it was read
+ * @param messages Messages emitted when parsing the article
+ */
+void blogator::indexer::ArticleCache::store( const dto::Article &article,
+                                             const Stamp &stamp,
+                                             const cli::MsgInterface::MsgBuffer_t &messages )
+{
+    _indexed.insert_or_assign( article._paths.src_html.string(), Entry { stamp, article, messages } );
+}
+
+/**
+ * Gets the cache file's path
+ * @return Cache file path
+ */
+std::filesystem::path blogator::indexer::ArticleCache::path() const {
+    return _cache_path;
+}
+
+/**
+ * Creates a fingerprint string of all the options affecting the parsing of posts
+ * @return Fingerprint
+ */
+std::string blogator::indexer::ArticleCache::createFingerprint() const {
+    std::stringstream ss;
+    ss << _options.getSoftwareVersionStr() << "|"
+       << _options._paths.root_dir.string() << "|"
+       << _options._paths.source_dir.string() << "|"
+       << _options._index.show_summary << "|"
+       << _options._posts.toc.generate_toc << "|"
+       << _options._posts.toc.level_offset << "|"
+       << _options._posts.block_classes.toc << "|"
+       << _options._posts.adapt_rel_paths;
+    return ss.str();
+}
+
+/**
+ * Reads a cache entry
+ * @param in    Input stream
+ * @param entry Entry to populate
+ * @throws exception::file_parsing_failure when the entry could not be read
+ */
+void blogator::indexer::ArticleCache::readEntry( std::istream &in, Entry &entry ) const {
+    auto &article = entry.article;
+
+    entry.stamp.mtime = read<int64_t>( in );
+    entry.stamp.size  = read<uint64_t>( in );
+
+    article._paths.src_html   = readString( in );
+    article._heading          = readString( in );
+    article._datestamp._year  = read<uint32_t>( in );
+    article._datestamp._month = read<uint32_t>( in );
+    article._datestamp._day   = read<uint32_t>( in );
+
+    for( auto n = read<uint64_t>( in ); n > 0; --n )
+        article._names.authors.emplace_back( readString( in ) );
+
+    for( auto n = read<uint64_t>( in ); n > 0; --n )
+        article._names.tags.emplace_back( readString( in ) );
+
+    for( auto n = read<uint64_t>( in ); n > 0; --n )
+        article._summary.html._lines.emplace_back( readString( in ) );
+
+    for( auto n = read<uint64_t>( in ); n > 0; --n ) {
+        auto line = read<uint64_t>( in );
+        auto col  = read<uint64_t>( in );
+        article._summary.path_write_pos.emplace( dto::InsertPosition( line, col ), readString( in ) );
+    }
+
+    if( read<uint8_t>( in ) ) { //ToC
+        auto toc = std::make_shared<dto::TableOfContents>( _options._posts.toc.generate_toc, _options._posts.toc.level_offset );
+
+        for( auto n = read<uint64_t>( in ); n > 0; --n ) {
+            auto line     = read<uint64_t>( in );
+            auto col      = read<uint64_t>( in );
+            auto level    = read<uint8_t>( in );
+            auto str      = readString( in );
+            auto str_line = read<uint64_t>( in );
+            auto str_col  = read<uint64_t>( in );
+
+            if( level < 1 || level > 6 )
+                throw exception::file_parsing_failure( "Invalid heading level." );
+
+            toc->addHeading( dto::InsertPosition( line, col ),
+                             dto::TableOfContents::Heading( static_cast<dto::TableOfContents::HeadingLevel>( level ),
+                                                            str,
+                                                            dto::InsertPosition( str_line, str_col ) ) );
+        }
+
+        for( auto n = read<uint64_t>( in ); n > 0; --n ) {
+            auto line = read<uint64_t>( in );
+            auto col  = read<uint64_t>( in );
+            toc->addTocBlock( dto::InsertPosition( line, col ) );
+        }
+
+        article._toc = toc;
+    }
+
+    if( read<uint8_t>( in ) ) { //Post body
+        auto body = std::make_shared<dto::PostBody>();
+
+        body->buffer = readString( in );
+
+        for( auto n = read<uint64_t>( in ); n > 0; --n ) {
+            auto end = read<uint64_t>( in );
+
+            if( end > body->buffer.size() || ( !body->line_ends.empty() && end < body->line_ends.back() ) )
+                throw exception::file_parsing_failure( "Invalid post body line offset." );
+
+            body->line_ends.emplace_back( end );
+        }
+
+        for( auto n = read<uint64_t>( in ); n > 0; --n ) {
+            auto line = read<uint64_t>( in );
+            auto col  = read<uint64_t>( in );
+            body->path_write_pos.emplace( dto::InsertPosition( line, col ), readString( in ) );
+        }
+
+        article._body = body;
+    }
+
+    for( auto n = read<uint64_t>( in ); n > 0; --n ) {
+        auto type = read<uint8_t>( in );
+
+        if( type > static_cast<uint8_t>( cli::MsgInterface::BufferedMsg::Type::ERROR ) )
+            throw exception::file_parsing_failure( "Invalid message type." );
+
+        entry.messages.emplace_back(
+            cli::MsgInterface::BufferedMsg { static_cast<cli::MsgInterface::BufferedMsg::Type>( type ), readString( in ) }
+        );
+    }
+}
+
+/**
+ * Writes a cache entry
+ * @param out   Output stream
+ * @param key   Entry key
+ * @param entry Entry
+ */
+void blogator::indexer::ArticleCache::writeEntry( std::ostream &out, const std::string &key, const Entry &entry ) const {
+    const auto &article = entry.article;
+
+    write( out, key );
+    write( out, entry.stamp.mtime );
+    write( out, entry.stamp.size );
+
+    write( out, article._paths.src_html.string() );
+    write( out, article._heading );
+    write( out, static_cast<uint32_t>( article._datestamp._year ) );
+    write( out, static_cast<uint32_t>( article._datestamp._month ) );
+    write( out, static_cast<uint32_t>( article._datestamp._day ) );
+
+    write( out, static_cast<uint64_t>( article._names.authors.size() ) );
+    for( const auto &author : article._names.authors )
+        write( out, author );
+
+    write( out, static_cast<uint64_t>( article._names.tags.size() ) );
+    for( const auto &tag : article._names.tags )
+        write( out, tag );
+
+    write( out, static_cast<uint64_t>( article._summary.html._lines.size() ) );
+    for( const auto &line : article._summary.html._lines )
+        write( out, line );
+
+    write( out, static_cast<uint64_t>( article._summary.path_write_pos.size() ) );
+    for( const auto &p : article._summary.path_write_pos ) {
+        write( out, static_cast<uint64_t>( p.first.line ) );
+        write( out, static_cast<uint64_t>( p.first.col ) );
+        write( out, p.second.string() );
+    }
+
+    write( out, static_cast<uint8_t>( article._toc != nullptr ) );
+    if( article._toc ) {
+        write( out, static_cast<uint64_t>( article._toc->headings().size() ) );
+        for( const auto &h : article._toc->headings() ) {
+            write( out, static_cast<uint64_t>( h.first.line ) );
+            write( out, static_cast<uint64_t>( h.first.col ) );
+            write( out, static_cast<uint8_t>( h.second.level ) );
+            write( out, h.second.str );
+            write( out, static_cast<uint64_t>( h.second.str_pos.line ) );
+            write( out, static_cast<uint64_t>( h.second.str_pos.col ) );
+        }
+
+        write( out, static_cast<uint64_t>( article._toc->tocPositions().size() ) );
+        for( const auto &pos : article._toc->tocPositions() ) {
+            write( out, static_cast<uint64_t>( pos.line ) );
+            write( out, static_cast<uint64_t>( pos.col ) );
+        }
+    }
+
+    write( out, static_cast<uint8_t>( article._body != nullptr ) );
+    if( article._body ) {
+        write( out, article._body->buffer );
+
+        write( out, static_cast<uint64_t>( article._body->line_ends.size() ) );
+        for( const auto &end : article._body->line_ends )
+            write( out, static_cast<uint64_t>( end ) );
+
+        write( out, static_cast<uint64_t>( article._body->path_write_pos.size() ) );
+        for( const auto &p : article._body->path_write_pos ) {
+            write( out, static_cast<uint64_t>( p.first.line ) );
+            write( out, static_cast<uint64_t>( p.first.col ) );
+            write( out, p.second.string() );
+        }
+    }
+
+    write( out, static_cast<uint64_t>( entry.messages.size() ) );
+    for( const auto &m : entry.messages ) {
+        write( out, static_cast<uint8_t>( m.type ) );
+        write( out, m.str );
+    }
+}
+
+/**
+ * Writes a fixed-size value to a binary stream
+ * @tparam T  Value type
+ * @param out Output stream
+ * @param val Value
+ */
+template<typename T> void blogator::indexer::ArticleCache::write( std::ostream &out, const T &val ) {
+    out.write( reinterpret_cast<const char *>( &val ), sizeof( T ) );
+}
+
+/**
+ * Writes a length-prefixed string to a binary stream
+ * @param out Output stream
+ * @param str String
+ */
+void blogator::indexer::ArticleCache::write( std::ostream &out, const std::string &str ) {
+    write( out, static_cast<uint64_t>( str.size() ) );
+    out.write( str.data(), str.size() );
+}
+
+/**
+ * Reads a fixed-size value from a binary stream
+ * @tparam T Value type
+ * @param in Input stream
+ * @return Value
+ * @throws exception::file_parsing_failure when the stream ended prematurely
+ */
+template<typename T> T blogator::indexer::ArticleCache::read( std::istream &in ) {
+    T val;
+    in.read( reinterpret_cast<char *>( &val ), sizeof( T ) );
+
+    if( !in )
+        throw exception::file_parsing_failure( "Unexpected end of file." );
+
+    return val;
+}
+
+/**
+ * Reads a length-prefixed string from a binary stream
+ * @param in Input stream
+ * @return String
+ * @throws exception::file_parsing_failure when the stream ended prematurely
+ */
+std::string blogator::indexer::ArticleCache::readString( std::istream &in ) {
+    auto size = read<uint64_t>( in );
+    auto str  = std::string();
+
+    while( size > 0 && in ) { //reading in chunks so that a corrupted size does not trigger a huge allocation
+        char   buffer[ 4096 ];
+        auto   chunk = std::min<uint64_t>( size, sizeof( buffer ) );
+        in.read( buffer, chunk );
+        str.append( buffer, in.gcount() );
+        size -= chunk;
+    }
+
+    if( !in )
+        throw exception::file_parsing_failure( "Unexpected end of file." );
+
+    return str;
+}
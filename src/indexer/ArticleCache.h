@@ -0,0 +1,65 @@
+#ifndef BLOGATOR_INDEXER_ARTICLECACHE_H
+#define BLOGATOR_INDEXER_ARTICLECACHE_H
+
+#include <filesystem>
+#include <unordered_map>
+#include <optional>
+
+#include "../dto/Article.h"
+#include "../dto/Options.h"
+#include "../cli/MsgInterface.h"
+
+namespace blogator::indexer {
+    /**
+     * Persistent cache of the properties extracted from the source posts during indexing
+     */
+    class ArticleCache {
+      public:
+        struct Stamp {
+            int64_t  mtime { 0 };
+            uint64_t size  { 0 };
+
+            bool operator ==( const Stamp &rhs ) const { return mtime == rhs.mtime && size == rhs.size; };
+            bool operator !=( const Stamp &rhs ) const { return !( *this == rhs ); };
+        };
+
+        explicit ArticleCache( const dto::Options &global_options );
+
+        static std::optional<Stamp> stamp( const std::filesystem::path &path );
+
+        bool load();
+        void save() const;
+        bool fetch( const std::filesystem::path &path, const Stamp &stamp, dto::Article &article, cli::MsgInterface::MsgBuffer_t &messages ) const;
+        void store( const dto::Article &article, const Stamp &stamp, const cli::MsgInterface::MsgBuffer_t &messages );
+
+        [[nodiscard]] std::filesystem::path path() const;
+
+      private:
+        static constexpr uint32_t FORMAT_VERSION { 5 };
+
+        struct Entry {
+            Stamp                          stamp;
+            dto::Article                   article;
+            cli::MsgInterface::MsgBuffer_t messages;
+        };
+
+        typedef std::unordered_map<std::string, Entry> Entries_t; //{K=source path, V=cached entry}
+
+        const dto::Options    &_options;
+        std::filesystem::path  _cache_path;
+        std::string            _fingerprint;
+        Entries_t              _cached;  //entries loaded from the cache file
+        Entries_t              _indexed; //entries of the current run (what gets saved)
+
+        std::string createFingerprint() const;
+        void readEntry( std::istream &in, Entry &entry ) const;
+        void writeEntry( std::ostream &out, const std::string &key, const Entry &entry ) const;
+
+        template<typename T> static void write( std::ostream &out, const T &val );
+        static void write( std::ostream &out, const std::string &str );
+        template<typename T> static T read( std::istream &in );
+        static std::string readString( std::istream &in );
+    };
+}
+
+#endif //BLOGATOR_INDEXER_ARTICLECACHE_H
@@ -14,16 +14,16 @@ blogator::indexer::FeatAggregator::FeatAggregator( std::shared_ptr<const blogato
 /**
  * Adds an article to the aggregator if it is featured in the options for the landing page
  * @param article   Article DTO
- * @param order_pos Featured position
+ * @param article_i Index of the article in the master index's articles
  * @return is featured
  */
-bool blogator::indexer::FeatAggregator::addArticleIfFeatured( const blogator::dto::Article &article )
+bool blogator::indexer::FeatAggregator::addArticleIfFeatured( const blogator::dto::Article &article, size_t article_i )
 {
     const auto rel_path = article._paths.src_html.lexically_relative( _options->_paths.source_dir );
     const auto it = _options->_landing_page.featured.find( rel_path );
 
     if( it != _options->_landing_page.featured.cend() ) {
-        _max_heap.push( std::make_pair( it->second, article ) );
+        _max_heap.push( std::make_pair( it->second, article_i ) );
         _display.debug( "Added to 'featured' list: " + rel_path.string() );
         return true;
     }
@@ -33,10 +33,10 @@ bool blogator::indexer::FeatAggregator::addArticleIfFeatured( const blogator::dt
 
 /**
  * Gets the ordered list of Articles to be featured on the landing page
- * @return Order list of Article DTOs
+ * @return Ordered list of indices to the master index's articles
  */
-std::vector<blogator::dto::Article> blogator::indexer::FeatAggregator::getFeaturedArticles() {
-    auto v = std::vector<blogator::dto::Article>();
+std::vector<size_t> blogator::indexer::FeatAggregator::getFeaturedArticles() {
+    auto v = std::vector<size_t>();
 
     while( !_max_heap.empty() ) {
         v.emplace_back( _max_heap.top().second );
@@ -13,14 +13,14 @@ namespace blogator::indexer {
       public:
         explicit FeatAggregator( std::shared_ptr<const dto::Options> global_options );
 
-        bool addArticleIfFeatured( const dto::Article &article );
-        std::vector<dto::Article> getFeaturedArticles();
+        bool addArticleIfFeatured( const dto::Article &article, size_t article_i );
+        std::vector<size_t> getFeaturedArticles();
 
       private:
         cli::MsgInterface                   &_display;
         std::shared_ptr<const dto::Options> _options;
 
-        typedef std::pair<size_t, dto::Article> HeapNode_t;
+        typedef std::pair<size_t, size_t> HeapNode_t; //(featured position, article index)
 
         struct Comparator {
             bool operator()( const HeapNode_t &a, const HeapNode_t &b ) const {
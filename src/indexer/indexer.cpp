@@ -10,9 +10,14 @@
 #include <list>
 #include <unordered_map>
 #include <numeric>
+#include <optional>
+#include <set>
+#include <cctype>
 
 #include "FeatAggregator.h"
+#include "ArticleCache.h"
 #include "../html/html.h"
+#include "../html/reader/LineScanner.h"
 #include "../dto/DateStamp.h"
 #include "../dto/Line.h"
 #include "../cli/MsgInterface.h"
@@ -21,6 +26,7 @@
 #include "../exception/failed_expectation.h"
 #include "../fs/fs.h"
 #include "../html/editor/editor.h"
+#include "../concurrency/concurrency.h"
 
 /**
  * Initialise the index
@@ -205,6 +211,7 @@ void blogator::indexer::indexPosts( const dto::Options &global_options, dto::Ind
 
     auto index_entry_files = std::unordered_map<std::string, std::filesystem::path>();
     auto custom_css_files  = std::unordered_map<std::string, std::filesystem::path>();
+    auto post_files        = std::vector<std::filesystem::path>(); //in directory iteration order
     auto removal_queue     = std::deque<std::filesystem::path>(); //removed article paths
     auto index_entry_match = std::smatch();
     auto custom_css_match  = std::smatch();
@@ -223,36 +230,114 @@ void blogator::indexer::indexPosts( const dto::Options &global_options, dto::Ind
                         std::make_pair( custom_css_match[ 1 ].str(), p.path() )
                     );
             } else if( std::regex_match( path, html_rx ) ) {
-                try {
-                    auto &article = index._articles.emplace_back( readFileProperties( global_options, p.path() ) );
-
-                    if( !global_options._posts.build_future &&
-                        article._datestamp > global_options.getRuntimeDateStamp() )
-                    {
-                        std::stringstream ss;
-                        ss << "Skipping future post (" << article._datestamp << " > " << global_options.getRuntimeDateStamp() << "): "
-                           << article._paths.src_html.lexically_relative( global_options._paths.root_dir );
-                        display.debug( ss.str() );
-
-                        removal_queue.emplace_back( article._paths.src_html );
-                        index._articles.erase( std::prev( index._articles.end() ) );
-
-                    } else {
-                        addYear( global_options, article, index );
-                        addTags( global_options, article, index );
-                        addAuthors( global_options, article, index );
-
-                        if( global_options._index.show_summary && article._summary.html._lines.empty() )
-                            display.debug(
-                                "No summary found in: " + article._paths.src_html.lexically_relative( global_options._paths.root_dir ).string()
-                            );
-                    }
+                post_files.emplace_back( p.path() );
+            }
+        }
+    }
+
+    { //Parsing the posts (concurrently when more than 1 job is set)
+        struct ParsedPost {
+            std::optional<dto::Article>        article;
+            std::optional<ArticleCache::Stamp> stamp;
+            std::string                        error;
+            cli::MsgInterface::MsgBuffer_t     messages;
+            bool                               from_cache { false };
+        };
+
+        auto cache  = ArticleCache( global_options );
+        auto parsed = std::vector<ParsedPost>( post_files.size() );
+
+        if( global_options._posts.cache )
+            cache.load();
+
+        concurrency::forEach( global_options._concurrency.jobs, post_files.size(), [&]( size_t i ) {
+            auto &post = parsed[ i ];
+
+            if( global_options._posts.cache )
+                post.stamp = ArticleCache::stamp( post_files[ i ] );
+
+            if( post.stamp ) {
+                auto article = dto::Article();
+
+                if( cache.fetch( post_files[ i ], *post.stamp, article, post.messages ) ) {
+                    post.article.emplace( std::move( article ) );
+                    post.from_cache = true;
+                    return;
+                }
+            }
+
+            display.setThreadBuffer( &post.messages );
+
+            try {
+                post.article.emplace( readFileProperties( global_options, post_files[ i ] ) );
+            } catch( std::exception &e ) {
+                post.error = e.what();
+            }
+
+            display.setThreadBuffer( nullptr );
+        } );
+
+        //Merging results in the original iteration order so the index matches a serial run
+        size_t cache_hits = 0;
+
+        for( auto &post : parsed ) {
+            display.flush( post.messages );
+
+            if( !post.article ) {
+                display.error( post.error );
+
+            } else {
+                if( post.stamp )
+                    cache.store( *post.article, *post.stamp, post.messages );
+                if( post.from_cache )
+                    ++cache_hits;
+
+                auto &article = index._articles.emplace_back( std::move( *post.article ) );
+
+                if( !global_options._posts.build_future &&
+                    article._datestamp > global_options.getRuntimeDateStamp() )
+                {
+                    std::stringstream ss;
+                    ss << "Skipping future post (" << article._datestamp << " > " << global_options.getRuntimeDateStamp() << "): "
+                       << article._paths.src_html.lexically_relative( global_options._paths.root_dir );
+                    display.debug( ss.str() );
+
+                    removal_queue.emplace_back( article._paths.src_html );
+                    index._articles.erase( std::prev( index._articles.end() ) );
+
+                } else { //names are interned in merge order so that the display names do not depend on the cache or the jobs
+                    for( const auto &author : article._names.authors )
+                        dto::Dictionary::add( article._authors, dto::Dictionary::authors().intern( author ) );
+
+                    for( const auto &tag : article._names.tags )
+                        dto::Dictionary::add( article._tags, dto::Dictionary::tags().intern( tag ) );
+
+                    dto::Dictionary::authors().sort( article._authors );
+                    dto::Dictionary::tags().sort( article._tags );
+
+                    article._names.authors.clear(); //the IDs are used from here on (the cache entry already has the strings)
+                    article._names.authors.shrink_to_fit();
+                    article._names.tags.clear();
+                    article._names.tags.shrink_to_fit();
+
+                    addYear( global_options, article, index );
+                    addTags( global_options, article, index );
+                    addAuthors( global_options, article, index );
 
-                } catch( std::exception &e ) {
-                    display.error( e.what() );
+                    if( global_options._index.show_summary && article._summary.html._lines.empty() )
+                        display.debug(
+                            "No summary found in: " + article._paths.src_html.lexically_relative( global_options._paths.root_dir ).string()
+                        );
                 }
             }
         }
+
+        if( global_options._posts.cache ) {
+            display.debug(
+                "Article cache: " + std::to_string( cache_hits ) + "/" + std::to_string( parsed.size() ) + " posts loaded from cache."
+            );
+            cache.save();
+        }
     }
 
     while( !removal_queue.empty() ) { //Remove corresponding custom CSS (if any) of removed articles
@@ -321,15 +406,16 @@ void blogator::indexer::indexPosts( const dto::Options &global_options, dto::Ind
 }
 
 /**
- * Index featured posts for the landing page
+ * Index featured posts for the landing page (to be done after the articles are sorted)
  * @param feat_aggregator Featured aggregator
  * @param index           Index DTO
  */
 void blogator::indexer::indexFeatured( indexer::FeatAggregator &feat_aggregator,
                                        dto::Index &index )
 {
-    for( auto &article : index._articles ) {
-        article._is_featured = feat_aggregator.addArticleIfFeatured( article );
+    for( size_t i = 0; i < index._articles.size(); ++i ) {
+        auto &article = index._articles[ i ];
+        article._is_featured = feat_aggregator.addArticleIfFeatured( article, i );
     }
 
     index._featured = feat_aggregator.getFeaturedArticles();
@@ -346,7 +432,7 @@ void blogator::indexer::addYear( const dto::Options &global_options,
                                  const dto::Article &article,
                                  dto::Index &master_index )
 {
-    auto year = std::to_string( article._datestamp._year );
+    auto year = dto::Dictionary::years().intern( std::to_string( article._datestamp._year ) );
     master_index._indices.byYear.cats.insert(
         std::make_pair( year, std::to_string( master_index._indices.byYear.cats.size() ) )
     );
@@ -405,9 +491,15 @@ void blogator::indexer::sortChronologically( blogator::dto::Index::Articles_t &a
     size_t i = 0;
     for( auto &article : articles ) {
         article._number = ( articles.size() - i );
-        addOutputPath( global_options._paths, article );
+
+        if( global_options._posts.file_names == dto::Options::Posts::FileNames::NUMBER )
+            addOutputPath( global_options._paths, article, std::to_string( article._number ) );
+
         ++i;
     }
+
+    if( global_options._posts.file_names != dto::Options::Posts::FileNames::NUMBER )
+        addSlugOutputPaths( global_options, articles );
 }
 
 /**
@@ -423,11 +515,14 @@ void blogator::indexer::generateYearIndexTargets( dto::Index &master_index,
         size_t i   = 0;
 
         for( const auto & article : master_index._articles ) {
-            auto year = std::to_string( article._datestamp._year );
-            auto year_it = map.find( year );
+            auto year = dto::Dictionary::years().find( std::to_string( article._datestamp._year ) );
 
-            if( year_it != map.end() )
-                year_it->second.article_indices.emplace_back( i );
+            if( year ) {
+                auto year_it = map.find( *year );
+
+                if( year_it != map.end() )
+                    year_it->second.article_indices.emplace_back( i );
+            }
 
             ++i;
         }
@@ -440,7 +535,7 @@ void blogator::indexer::generateYearIndexTargets( dto::Index &master_index,
                                                          tag.second.article_indices.size() );
 
                 for( size_t p = 0; p < page_count; ++p )
-                    tag.second.file_names.emplace_back( makeFileName( tag.second.prefix_id, p ) );
+                    tag.second.file_names.emplace_back( makeFileName( tag.second.prefix_id, calcPageFileNumber( p, page_count, global_options ) ) );
 
                 master_index._indices.byYear.page_count += page_count;
             }
@@ -481,7 +576,7 @@ void blogator::indexer::generateTagIndexTargets( dto::Index &master_index,
                                                          tag.second.article_indices.size() );
 
                 for( size_t p = 0; p < page_count; ++p )
-                    tag.second.file_names.emplace_back( makeFileName( tag.second.prefix_id, p ) );
+                    tag.second.file_names.emplace_back( makeFileName( tag.second.prefix_id, calcPageFileNumber( p, page_count, global_options ) ) );
 
                 master_index._indices.byTag.page_count += page_count;
             }
@@ -522,7 +617,7 @@ void blogator::indexer::generateAuthorIndexTargets( dto::Index& master_index,
                                                          author.second.article_indices.size() );
 
                 for( size_t p = 0; p < page_count; ++p )
-                    author.second.file_names.emplace_back( makeFileName( author.second.prefix_id, p ) );
+                    author.second.file_names.emplace_back( makeFileName( author.second.prefix_id, calcPageFileNumber( p, page_count, global_options ) ) );
 
                 master_index._indices.byAuthor.page_count += page_count;
             }
@@ -539,8 +634,8 @@ void blogator::indexer::generateTopTags( blogator::dto::Index &master_index,
                                          const blogator::dto::Options &global_options )
 {
     auto compare  = []( auto &a, auto &b ) { return a.first < b.first; };
-    auto max_heap = std::priority_queue<std::pair<size_t, std::string>,
-                                        std::vector<std::pair<size_t, std::string>>,
+    auto max_heap = std::priority_queue<std::pair<size_t, dto::Dictionary::ID_t>,
+                                        std::vector<std::pair<size_t, dto::Dictionary::ID_t>>,
                                         decltype( compare )
                                        >( compare );
 
@@ -564,8 +659,8 @@ void blogator::indexer::generateTopAuthors( dto::Index &master_index,
                                             const dto::Options &global_options )
 {
     auto compare  = []( auto &a, auto &b ) { return a.first < b.first; };
-    auto max_heap = std::priority_queue<std::pair<size_t, std::string>,
-        std::vector<std::pair<size_t, std::string>>,
+    auto max_heap = std::priority_queue<std::pair<size_t, dto::Dictionary::ID_t>,
+        std::vector<std::pair<size_t, dto::Dictionary::ID_t>>,
         decltype( compare )
     >( compare );
 
@@ -581,7 +676,7 @@ void blogator::indexer::generateTopAuthors( dto::Index &master_index,
 }
 
 /**
- * Generates chronological index filenames
+ * Generates chronological index filenames (in the order of the pages: newest posts first)
  * @param master_index   Master index
  * @param global_options Global blogator options
  */
@@ -591,8 +686,10 @@ void blogator::indexer::generateChronologicalIndexTargets( dto::Index & master_i
     master_index._indices.chronological.page_count = calcPageCount( global_options._index.items_per_page,
                                                                     master_index._articles.size() );
 
-    for( size_t p = 0; p < master_index._indices.chronological.page_count; ++p ) {
-        master_index._indices.chronological.file_names.emplace_back( makeFileName( p ) );
+    const auto page_count = master_index._indices.chronological.page_count;
+
+    for( size_t p = 0; p < page_count; ++p ) {
+        master_index._indices.chronological.file_names.emplace_back( makeFileName( calcPageFileNumber( p, page_count, global_options ) ) );
     }
 }
 
@@ -631,87 +728,81 @@ blogator::dto::DateStamp blogator::indexer::convertDate( const std::string & dat
 blogator::dto::Article blogator::indexer::readFileProperties( const dto::Options &options, const std::filesystem::path &path ) {
     static auto &display = cli::MsgInterface::getInstance();
 
-    const static auto heading_tag = std::make_pair<std::string, std::string>( "<span class=\"title\">", "</span>" );
-    const static auto author_tag  = std::make_pair<std::string, std::string>( "<span class=\"author\">", "</span>" );
-    const static auto date_tag    = std::make_pair<std::string, std::string>( "<time datetime=\"", "\"" );
-    const static auto tag_tag     = std::make_pair<std::string, std::string>( "<span class=\"tag\">", "</span>" );
     const static auto template_kw = std::make_pair<std::string, std::string>( "{{", "}}" ); //TODO
 
     auto article           = blogator::dto::Article();
     bool title_found       = false;
     bool date_found        = false;
     auto summary_positions = std::deque<dto::InsertPosition>();
+    auto summary_consumed  = size_t( 0 );   //number of summary positions already processed
+    auto summary_buffer    = std::string(); //content of the summary range currently opened
 
     article._paths.src_html = path;
     std::shared_ptr<dto::TableOfContents> toc;
 
-    std::string   line;
-    size_t        line_count = 0;
-    std::ifstream html_file( path.string() );
+    //the post page writer modifies the content when relative paths are adapted or a ToC is generated
+    const bool keep_body = ( options._posts.adapt_rel_paths || options._posts.toc.generate_toc > 0 );
+    auto       body_html = dto::HTML();
+
+    std::string               line;
+    size_t                    line_count = 0;
+    std::ifstream             html_file( path.string() );
+    html::reader::LineScanner scanner;
 
     try {
-        using html::reader::getContentBetween;
-        using html::reader::getContentsBetween;
-        using html::reader::getSummaryPositions;
-        using html::reader::getTags;
-        using html::reader::getConsecutiveWritePositions;
+        using Marker = html::reader::LineScanner::Marker;
 
         if( options._posts.toc.generate_toc > 0 )
             toc = std::make_shared<dto::TableOfContents>( options._posts.toc.generate_toc, options._posts.toc.level_offset );
 
         if( html_file.is_open() ) {
             while( getline( html_file, line ) ) {
+                scanner.scan( line ); //single pass for all the markers on the line
 
-                if( !title_found ) {
-                    article._heading = getContentBetween( heading_tag.first, heading_tag.second, line );
+                if( !title_found && scanner.found( Marker::TITLE ) ) {
+                    article._heading = scanner.contentBetween( Marker::TITLE, Marker::SPAN_CLOSE );
                     title_found = !article._heading.empty();
                 }
 
-                if( !date_found ) {
-                    auto date = getContentBetween( date_tag.first, date_tag.second, line );
+                if( !date_found && scanner.found( Marker::DATE ) ) {
+                    auto date = scanner.contentBetween( Marker::DATE, '"' );
                     if( !date.empty() ) {
                         article._datestamp = convertDate( date );
                         date_found = true;
                     }
                 }
 
-                if( options._index.show_summary )
-                    getSummaryPositions( line_count, line, summary_positions );
-
+                if( options._index.show_summary ) {
+                    scanner.summaryPositions( line_count, summary_positions );
+                    html::reader::getSummaryContent( line, summary_positions, summary_consumed, summary_buffer, article._summary.html );
+                }
 
                 if( toc != nullptr && options._posts.toc.generate_toc > 0 ) {
-                    toc->findHeading( line_count, line );
-                    toc->findTocBlock( line_count, line, options._posts.block_classes.toc );
+                    if( scanner.found( Marker::HEADING ) )
+                        toc->findHeading( line_count, line );
+                    if( scanner.found( Marker::CLASS_ATTR ) )
+                        toc->findTocBlock( line_count, line, options._posts.block_classes.toc );
+                }
+
+                if( scanner.found( Marker::AUTHOR ) ) {
+                    for( const auto &author : scanner.contentsBetween( Marker::AUTHOR, Marker::SPAN_CLOSE ) )
+                        article._names.authors.emplace_back( author );
                 }
 
-                auto authors = getContentsBetween( author_tag.first, author_tag.second, line );
-                auto tags    = getContentsBetween( tag_tag.first, tag_tag.second, line );
+                if( scanner.found( Marker::TAG ) ) {
+                    for( const auto &tag : scanner.contentsBetween( Marker::TAG, Marker::SPAN_CLOSE ) )
+                        article._names.tags.emplace_back( tag );
+                }
 
-                std::copy( authors.begin(), authors.end(),
-                           std::inserter( article._authors, article._authors.begin() )
-                );
-                std::copy( tags.begin(), tags.end(),
-                           std::inserter( article._tags, article._tags.begin() )
-                );
+                if( keep_body )
+                    body_html._lines.emplace_back( line );
 
                 ++line_count;
             }
 
             html_file.close();
 
-            { //caching summary and extracting all relative paths found within
-                auto summary_range_pos = std::list<dto::SeekRange>();
-
-                while( summary_positions.size() >= 2 ) {
-                    auto start = summary_positions.front();
-                    summary_positions.pop_front();
-                    auto finish = summary_positions.front();
-                    summary_positions.pop_front();
-                    summary_range_pos.emplace_back( dto::SeekRange( start, finish ) );
-                }
-
-                article._summary.html = fs::importHTML( article._paths.src_html, summary_range_pos );
-
+            { //extracting all relative paths found within the summary (captured during the scan)
                 auto hrefs_count = html::editor::removeHyperlinks( article._summary.html );
 
                 if( hrefs_count > 0 )
@@ -723,6 +814,11 @@ blogator::dto::Article blogator::indexer::readFileProperties( const dto::Options
                 article._summary.path_write_pos = dto::Templates::extractRelativePaths( article._summary.html );
             }
 
+            { //keeping the post's lines + relative paths for when the post page is written
+                if( keep_body )
+                    article._body = std::make_shared<const dto::PostBody>( body_html, options._posts.adapt_rel_paths );
+            }
+
             { //caching any relevant headings+position found in the source html file if auto-generate-toc options is set
                 if( toc != nullptr && options._posts.toc.generate_toc > 0 ) {
                     if( toc->tocBlockExists() )
@@ -753,8 +849,8 @@ blogator::dto::Article blogator::indexer::readFileProperties( const dto::Options
             "Missing open/close 'summary' tag detected in: " + path.lexically_relative( options._paths.root_dir ).string()
         );
 
-    if( article._tags.empty() )
-        article._tags.emplace( "N/A" );
+    if( article._names.tags.empty() )
+        article._names.tags.emplace_back( "N/A" );
 
     return article;
 }
@@ -783,6 +879,7 @@ void blogator::indexer::cacheCustomIndexEntry( const dto::Options & options, dto
         entry->path_write_pos  = dto::Templates::extractRelativePaths( *entry->html );
 
         fs::checkTemplateRelPaths( *entry );
+        entry->compile();
 
         article._cust_index_entry = entry;
 
@@ -795,15 +892,60 @@ void blogator::indexer::cacheCustomIndexEntry( const dto::Options & options, dto
  * Creates the absolute output path of the post
  * @param global_paths Global paths set in dto::Options
  * @param article      Article to create an output path for
+ * @param file_stem    Output file name (without the extension)
  */
 void blogator::indexer::addOutputPath( const dto::Options::AbsPaths &global_paths,
-                                       blogator::dto::Article &article )
+                                       blogator::dto::Article &article,
+                                       const std::string &file_stem )
 {
-    auto file_name = std::to_string( article._number ) + article._paths.src_html.filename().extension().string();
+    auto file_name = file_stem + article._paths.src_html.filename().extension().string();
     auto abs_path  = global_paths.posts_dir / file_name;
     article._paths.out_html = abs_path.lexically_relative( global_paths.posts_dir );
 }
 
+/**
+ * Creates the output paths of the posts from the slug of their source path or title
+ * (the names only depend on the post itself so that they never change when other posts are added,
+ * removed or back-dated: title slugs are suffixed with a short hash of the source path and titles
+ * without ASCII letters or digits use the source path slug)
+ * @param global_options Global blogator options
+ * @param articles       Collection of articles
+ */
+void blogator::indexer::addSlugOutputPaths( const dto::Options &global_options,
+                                            dto::Index::Articles_t &articles )
+{
+    static auto &display = cli::MsgInterface::getInstance();
+
+    auto by_source = std::vector<std::pair<std::string, dto::Article *>>(); //{relative source path, article}
+    auto taken     = std::set<std::string>();
+
+    by_source.reserve( articles.size() );
+
+    for( auto &article : articles )
+        by_source.emplace_back( article._paths.src_html.lexically_relative( global_options._paths.source_dir ).generic_string(), &article );
+
+    std::sort( by_source.begin(), by_source.end() ); //name collision fallback independent of the dates
+
+    for( auto &[src_path, article] : by_source ) {
+        auto slug = ( global_options._posts.file_names == dto::Options::Posts::FileNames::TITLE )
+                    ? makeSlug( article->_heading )
+                    : std::string();
+
+        auto file_stem = ( slug.empty() ? makePathSlug( src_path ) : slug + "-" + makeHashSuffix( src_path, 6 ) );
+
+        if( !taken.insert( file_stem ).second ) { //hash collision
+            display.warning( "Output name '" + file_stem + "' of post '" + src_path + "' already taken." );
+
+            const auto base = file_stem;
+
+            for( size_t n = 2; !taken.insert( file_stem ).second; ++n )
+                file_stem = base + "-" + std::to_string( n );
+        }
+
+        addOutputPath( global_options._paths, *article, file_stem );
+    }
+}
+
 /**
  * Checks the Option's landing page featured article list has valid paths
  * @param options Global Options DTO
@@ -851,4 +993,108 @@ std::filesystem::path blogator::indexer::makeFileName( const std::string &prefix
  */
 size_t blogator::indexer::calcPageCount( const size_t &items_per_page, const size_t & item_count ) {
     return ( item_count / items_per_page ) + ( ( item_count % items_per_page ) > 0 );
+}
+
+/**
+ * Makes a URL friendly slug from a string (lowercase ASCII letters and digits separated by '-')
+ * @param str String (HTML tags and character references are skipped)
+ * @return Slug (empty when the string has no ASCII letter or digit)
+ */
+std::string blogator::indexer::makeSlug( const std::string &str ) {
+    auto slug      = std::string();
+    bool separator = false;
+
+    for( size_t i = 0; i < str.size(); ++i ) {
+        const auto c = static_cast<unsigned char>( str[i] );
+
+        if( c == '<' || c == '&' ) {
+            const auto end = str.find( ( c == '<' ? '>' : ';' ), i );
+
+            if( end != std::string::npos && ( c == '<' || ( end - i ) <= 10 ) ) {
+                i         = end;
+                separator = true;
+                continue;
+            }
+        }
+
+        if( std::isalnum( c ) ) {
+            if( separator && !slug.empty() )
+                slug += '-';
+
+            slug     += static_cast<char>( std::tolower( c ) );
+            separator = false;
+
+        } else {
+            separator = true;
+        }
+    }
+
+    return slug;
+}
+
+/**
+ * Makes a flat file name slug from a source path relative to the source folder
+ * (folders are joined with '--' which a slug never contains and the folder/file names that
+ * are not already a slug are suffixed with a short hash of the name so that two paths never
+ * give the same slug: e.g. "news/My post.html" -> "news--my-post-1a2b3c")
+ * @param rel_path Relative source path
+ * @return Slug (empty when the path is empty)
+ */
+std::string blogator::indexer::makePathSlug( const std::filesystem::path &rel_path ) {
+    auto slug = std::string();
+    auto stem = rel_path;
+
+    for( const auto &part : stem.replace_extension() ) {
+        const auto name      = part.string();
+        auto       name_slug = makeSlug( name );
+
+        if( name_slug.empty() )
+            name_slug = makeHashSuffix( name, 6 );
+        else if( name_slug != name )
+            name_slug += "-" + makeHashSuffix( name, 6 );
+
+        slug += ( slug.empty() ? "" : "--" ) + name_slug;
+    }
+
+    return slug;
+}
+
+/**
+ * Makes a hexadecimal suffix from the 64bit FNV-1a hash of a string
+ * @param str    String
+ * @param length Number of hex digits to keep (16 max)
+ * @return Hash suffix
+ */
+std::string blogator::indexer::makeHashSuffix( const std::string &str, size_t length ) {
+    static const char * const hex_digits = "0123456789abcdef";
+
+    uint64_t hash = 0xcbf29ce484222325;
+
+    for( const auto c : str ) {
+        hash ^= static_cast<unsigned char>( c );
+        hash *= 0x100000001b3;
+    }
+
+    auto suffix = std::string();
+
+    for( size_t i = 0; i < std::min<size_t>( length, 16 ); ++i )
+        suffix += hex_digits[ ( hash >> ( 60 - i * 4 ) ) & 0xf ];
+
+    return suffix;
+}
+
+/**
+ * Calculates the number used in the file name of an index page
+ * (with stable pagination the newest page stays '0' and the others are numbered from the oldest
+ * post starting at 1 so that they keep their name as newer posts are added)
+ * @param page_i         Position of the page in the index (0: page with the newest posts)
+ * @param page_count     Number of pages in the index
+ * @param global_options Global blogator options
+ * @return File name number
+ */
+size_t blogator::indexer::calcPageFileNumber( const size_t &page_i, const size_t &page_count, const dto::Options &global_options ) {
+    if( global_options._index.stable_pagination && page_i > 0 )
+        return page_count - page_i;
+
+    return page_i;
 }
\ No newline at end of file
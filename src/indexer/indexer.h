@@ -21,7 +21,8 @@ namespace blogator::indexer {
     void addYear( const dto::Options &global_options, const dto::Article &article, dto::Index &master_index );
     void addTags( const dto::Options &global_options, const dto::Article &article, dto::Index &master_index );
     void addAuthors( const dto::Options &global_options, const dto::Article &article, dto::Index &master_index );
-    void addOutputPath( const dto::Options::AbsPaths &global_paths, dto::Article &article );
+    void addOutputPath( const dto::Options::AbsPaths &global_paths, dto::Article &article, const std::string &file_stem );
+    void addSlugOutputPaths( const dto::Options &global_options, dto::Index::Articles_t &articles );
 
     void sortChronologically( dto::Index::Articles_t &articles, const dto::Options &global_options );
     void generateYearIndexTargets( dto::Index &master_index, const dto::Options &global_options );
@@ -36,9 +37,13 @@ namespace blogator::indexer {
     void cacheCustomIndexEntry( const dto::Options &options, dto::Article &article );
 
     void checkFeaturedExist( const dto::Options &options );
+    std::string makeSlug( const std::string &str );
+    std::string makePathSlug( const std::filesystem::path &rel_path );
+    std::string makeHashSuffix( const std::string &str, size_t length );
     std::filesystem::path makeFileName( const size_t &n );
     std::filesystem::path makeFileName( const std::string &prefix, const size_t &n );
     size_t calcPageCount ( const size_t &items_per_page, const size_t &item_count );
+    size_t calcPageFileNumber( const size_t &page_i, const size_t &page_count, const dto::Options &global_options );
 }
 
 #endif //BLOGATOR_INDEXER_H
\ No newline at end of file
@@ -33,6 +33,19 @@ int main( int argc, char **argv ) {
         auto options = fs::importOptions( parser.getWorkingDirectory() / "blogator.cfg" );
         options->setupAbsolutePaths( parser.getWorkingDirectory() );
         options->setTempPath( parser.getTempDirectory() );
+        options->setJobCount( parser.getJobCount() );
+        options->setIOUring( parser.useIOUring() );
+        options->setWriteIfChanged( parser.useWriteIfChanged() );
+        options->setStagedPublish( parser.useStagedPublish() );
+
+        auto build_graph = std::make_shared<output::BuildGraph>( *options );
+
+        if( parser.useIncrementalBuild() ) {
+            options->setIncrementalBuild( build_graph->load() );
+
+            if( !options->_output.incremental )
+                std::cout << "> No build graph from a previous run: full build\n";
+        }
 
         std::cout << "> Setting up environment";
         fs::setupEnvironment( options );
@@ -40,7 +53,7 @@ int main( int argc, char **argv ) {
         auto index     = indexer::index( options );
         auto templates = fs::importTemplates( *index, *options );
 
-        output::generate( index, templates, options );
+        output::generate( index, templates, options, build_graph );
 
         fs::checkTemplateRelPaths( *index, *templates, *options );
 
@@ -0,0 +1,605 @@
+#include "BuildGraph.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "../exception/file_parsing_failure.h"
+#include "../cli/MsgInterface.h"
+#include "../fs/OutputQueue.h"
+
+/**
+ * Adds a string to the digest
+ * @param str String
+ * @return Digest
+ */
+blogator::output::BuildGraph::Digest & blogator::output::BuildGraph::Digest::add( std::string_view str ) {
+    add( static_cast<uint64_t>( str.size() ) ); //so that consecutive strings cannot be confused
+    append( str.data(), str.size() );
+    return *this;
+}
+
+/**
+ * Adds a value to the digest
+ * @param val Value
+ * @return Digest
+ */
+blogator::output::BuildGraph::Digest & blogator::output::BuildGraph::Digest::add( uint64_t val ) {
+    append( reinterpret_cast<const char *>( &val ), sizeof( val ) );
+    return *this;
+}
+
+/**
+ * Adds the lines of some HTML to the digest
+ * @param html HTML
+ * @return Digest
+ */
+blogator::output::BuildGraph::Digest & blogator::output::BuildGraph::Digest::add( const dto::HTML &html ) {
+    add( static_cast<uint64_t>( html._lines.size() ) );
+
+    for( const auto &line : html._lines )
+        add( line );
+
+    return *this;
+}
+
+/**
+ * Adds the content of a file to the digest
+ * @param path File path
+ * @return Digest
+ */
+blogator::output::BuildGraph::Digest & blogator::output::BuildGraph::Digest::addFile( const std::filesystem::path &path ) {
+    std::ifstream in( path, std::ios::binary );
+
+    if( !in.is_open() ) {
+        add( "<unreadable>" );
+        return *this;
+    }
+
+    char buffer[ 4096 ];
+
+    while( in.read( buffer, sizeof( buffer ) ) || in.gcount() > 0 )
+        append( buffer, static_cast<size_t>( in.gcount() ) );
+
+    return *this;
+}
+
+/**
+ * Gets the digest's value
+ * @return Fingerprint
+ */
+blogator::output::BuildGraph::Fingerprint_t blogator::output::BuildGraph::Digest::value() const {
+    return _hash;
+}
+
+/**
+ * Appends bytes to the digest
+ * @param data Bytes
+ * @param size Number of bytes
+ */
+void blogator::output::BuildGraph::Digest::append( const char *data, size_t size ) {
+    for( size_t i = 0; i < size; ++i ) {
+        _hash ^= static_cast<unsigned char>( data[ i ] );
+        _hash *= 0x100000001b3;
+    }
+}
+
+/**
+ * Constructor
+ * @param global_options Global blogator options
+ */
+blogator::output::BuildGraph::BuildGraph( const dto::Options &global_options ) :
+    _options( global_options ),
+    _loaded( false ),
+    _render_count( 0 )
+{
+    auto root_hash = std::hash<std::string>()( _options._paths.root_dir.lexically_normal().string() );
+
+    std::stringstream ss;
+    ss << "build_" << std::hex << root_hash << ".graph";
+
+    _graph_path  = _options._paths.temp_dir / ss.str();
+    _fingerprint = _options.getSoftwareVersionStr() + "|" + _options._paths.root_dir.string();
+}
+
+/**
+ * Loads the graph of the previous run
+ * @return Success (false if there is no graph file or it was made by another version)
+ */
+bool blogator::output::BuildGraph::load() {
+    auto &display = cli::MsgInterface::getInstance();
+
+    std::lock_guard<std::mutex> lock( _mutex );
+    std::ifstream in( _graph_path, std::ios::binary );
+
+    if( !in.is_open() )
+        return false;
+
+    try {
+        if( read<uint32_t>( in ) != FORMAT_VERSION || readString( in ) != _fingerprint ) {
+            display.debug( "Build graph is out of date: " + _graph_path.string() );
+            return false;
+        }
+
+        for( auto n = read<uint64_t>( in ); n > 0; --n ) {
+            auto key = readString( in );
+            _cached_inputs.insert_or_assign( key, read<Fingerprint_t>( in ) );
+        }
+
+        for( auto n = read<uint64_t>( in ); n > 0; --n ) {
+            auto output = readString( in );
+            auto inputs = Inputs_t();
+
+            for( auto i = read<uint64_t>( in ); i > 0; --i )
+                inputs.emplace_back( readString( in ) );
+
+            _cached_outputs.insert_or_assign( output, std::move( inputs ) );
+        }
+
+    } catch( exception::file_parsing_failure &e ) {
+        _cached_inputs.clear();
+        _cached_outputs.clear();
+        display.debug( "Build graph could not be read (" + std::string( e.what() ) + "): " + _graph_path.string() );
+        return false;
+    }
+
+    display.debug( "Build graph loaded (" + std::to_string( _cached_outputs.size() ) + " outputs): " + _graph_path.string() );
+    _loaded = true;
+    return true;
+}
+
+/**
+ * Saves the inputs and outputs of the current run to the graph file
+ */
+void blogator::output::BuildGraph::save() const {
+    auto &display = cli::MsgInterface::getInstance();
+    auto  tmp     = _graph_path;
+
+    tmp += ".tmp";
+
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    try {
+        std::filesystem::create_directories( _graph_path.parent_path() );
+
+        {
+            std::ofstream out( tmp, std::ios::binary | std::ios::trunc );
+
+            if( !out.is_open() ) {
+                display.warning( "Could not write build graph: " + tmp.string() );
+                return;
+            }
+
+            write( out, FORMAT_VERSION );
+            write( out, _fingerprint );
+
+            write( out, static_cast<uint64_t>( _inputs.size() ) );
+            for( const auto &input : _inputs ) {
+                write( out, input.first );
+                write( out, input.second );
+            }
+
+            write( out, static_cast<uint64_t>( _outputs.size() ) );
+            for( const auto &output : _outputs ) {
+                write( out, output.first );
+                write( out, static_cast<uint64_t>( output.second.size() ) );
+
+                for( const auto &key : output.second )
+                    write( out, key );
+            }
+        }
+
+        std::filesystem::rename( tmp, _graph_path );
+
+    } catch( std::filesystem::filesystem_error &e ) {
+        display.warning( "Could not write build graph: " + std::string( e.what() ) );
+    }
+}
+
+/**
+ * Removes the graph file so that the next incremental run falls back to a full build
+ * (used when the current run failed and left the outputs in an unknown state)
+ */
+void blogator::output::BuildGraph::discard() const {
+    auto ec = std::error_code();
+    std::filesystem::remove( _graph_path, ec );
+}
+
+/**
+ * Fingerprints the inputs known before any of the pages are generated
+ * (the configuration sections, templates, posts and index listings)
+ * @param master_index Master index
+ * @param templates    Templates
+ */
+void blogator::output::BuildGraph::fingerprintInputs( const dto::Index &master_index, const dto::Templates &templates ) {
+    fingerprintOptions();
+
+    for( const auto *t : { templates._post.get(),       templates._index.get(),      templates._index_list.get(),
+                           templates._year_list.get(),  templates._year_index.get(), templates._tag_list.get(),
+                           templates._tag_index.get(),  templates._author_list.get(), templates._author_index.get(),
+                           templates._index_entry.get(), templates._landing.get() } )
+    {
+        if( t && t->html )
+            setInput( templateKey( *t ), Digest().add( t->src.string() ).add( *t->html ).value() );
+    }
+
+    auto articles = Digest();
+
+    for( const auto &article : master_index._articles ) {
+        auto body  = Digest();
+        auto entry = Digest();
+
+        body.add( article._paths.src_html.string() ).addFile( article._paths.src_html );
+
+        if( !article._paths.css.empty() )
+            body.add( article._paths.css.string() ).addFile( article._paths.css );
+
+        entry.add( article._number )
+             .add( article._heading )
+             .add( article._datestamp._year )
+             .add( article._datestamp._month )
+             .add( article._datestamp._day )
+             .add( article._is_featured )
+             .add( article._paths.out_html.string() )
+             .add( article._summary.html );
+
+        for( const auto &p : article._summary.path_write_pos )
+            entry.add( p.first.line ).add( p.first.col ).add( p.second.string() );
+
+        entry.add( static_cast<uint64_t>( article._authors.size() ) );
+        for( const auto &author : article._authors )
+            entry.add( dto::Dictionary::authors().str( author ) );
+
+        entry.add( static_cast<uint64_t>( article._tags.size() ) );
+        for( const auto &tag : article._tags )
+            entry.add( dto::Dictionary::tags().str( tag ) );
+
+        if( !article._paths.entry_html.empty() )
+            entry.add( article._paths.entry_html.string() ).addFile( article._paths.entry_html );
+
+        setInput( bodyKey( article ), body.value() );
+        setInput( entryKey( article ), entry.value() );
+        articles.add( entry.value() );
+    }
+
+    setInput( ARTICLES, articles.value() );
+
+    fingerprintCategory( CAT_YEARS, master_index, master_index._indices.byYear );
+    fingerprintCategory( CAT_TAGS, master_index, master_index._indices.byTag );
+    fingerprintCategory( CAT_AUTHORS, master_index, master_index._indices.byAuthor );
+}
+
+/**
+ * Sets the fingerprint of an input for the current run
+ * @param key         Input key
+ * @param fingerprint Fingerprint of the input's content
+ */
+void blogator::output::BuildGraph::setInput( const std::string &key, Fingerprint_t fingerprint ) {
+    std::lock_guard<std::mutex> lock( _mutex );
+    _inputs.insert_or_assign( key, fingerprint );
+}
+
+/**
+ * Records the inputs of an output file for the current run
+ * (an output not needing rendering is registered with the output queue as part of the run's output)
+ * @param output Output file path
+ * @param inputs Keys of the inputs the output is built from
+ * @return Output needs rendering (always true on a non-incremental run)
+ */
+bool blogator::output::BuildGraph::update( const std::filesystem::path &output, Inputs_t inputs ) {
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    const bool dirty = ( !incremental() || isDirty( output, inputs ) );
+
+    _outputs.insert_or_assign( output.string(), std::move( inputs ) );
+
+    if( dirty )
+        ++_render_count;
+    else
+        fs::OutputQueue::getInstance().claim( output );
+
+    return dirty;
+}
+
+/**
+ * Removes the output files of the previous run that were not part of the current one
+ * @return Number of files removed
+ */
+size_t blogator::output::BuildGraph::removeStaleOutputs() {
+    auto  &display = cli::MsgInterface::getInstance();
+    size_t count   = 0;
+
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    for( const auto &output : _cached_outputs ) {
+        if( _outputs.find( output.first ) != _outputs.cend() )
+            continue;
+
+        auto ec = std::error_code();
+
+        if( std::filesystem::remove( output.first, ec ) ) {
+            display.debug( "Removed stale output: " + output.first );
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Gets the incremental state
+ * @return Outputs with unchanged inputs are skipped (incremental build enabled and a graph was loaded)
+ */
+bool blogator::output::BuildGraph::incremental() const {
+    return _options._output.incremental && _loaded;
+}
+
+/**
+ * Gets the number of outputs recorded in the current run
+ * @return Output count
+ */
+size_t blogator::output::BuildGraph::outputCount() const {
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _outputs.size();
+}
+
+/**
+ * Gets the number of outputs that needed rendering in the current run
+ * @return Rendered output count
+ */
+size_t blogator::output::BuildGraph::renderCount() const {
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _render_count;
+}
+
+/**
+ * Gets the graph file's path
+ * @return Graph file path
+ */
+std::filesystem::path blogator::output::BuildGraph::path() const {
+    return _graph_path;
+}
+
+/**
+ * Gets the input key of a template
+ * @param page_template Template DTO
+ * @return Input key
+ */
+std::string blogator::output::BuildGraph::templateKey( const dto::Template &page_template ) {
+    return "tmpl:" + page_template.src.string();
+}
+
+/**
+ * Gets the input key of an article's post content (source body and custom stylesheet)
+ * @param article Article DTO
+ * @return Input key
+ */
+std::string blogator::output::BuildGraph::bodyKey( const dto::Article &article ) {
+    return "body:" + article._paths.src_html.string();
+}
+
+/**
+ * Gets the input key of an article's listing properties (heading, date, tags, summary, etc.)
+ * @param article Article DTO
+ * @return Input key
+ */
+std::string blogator::output::BuildGraph::entryKey( const dto::Article &article ) {
+    return "entry:" + article._paths.src_html.string();
+}
+
+/**
+ * Gets a literal input key
+ * @param name  Value name
+ * @param value Value
+ * @return Input key
+ */
+std::string blogator::output::BuildGraph::valueKey( const std::string &name, const std::string &value ) {
+    return "val:" + name + "=" + value;
+}
+
+/**
+ * Checks if an output needs rendering against the graph of the previous run
+ * @param output Output file path
+ * @param inputs Keys of the inputs the output is built from
+ * @return Dirty state
+ */
+bool blogator::output::BuildGraph::isDirty( const std::filesystem::path &output, const Inputs_t &inputs ) const {
+    auto cached_it = _cached_outputs.find( output.string() );
+
+    if( cached_it == _cached_outputs.cend() || cached_it->second != inputs )
+        return true;
+
+    for( const auto &key : inputs ) {
+        if( key.compare( 0, 4, "val:" ) == 0 )
+            continue;
+
+        auto curr_it = _inputs.find( key );
+        auto prev_it = _cached_inputs.find( key );
+
+        if( curr_it == _inputs.cend() || prev_it == _cached_inputs.cend() || curr_it->second != prev_it->second )
+            return true;
+    }
+
+    return !std::filesystem::exists( output );
+}
+
+/**
+ * Fingerprints the configuration sections
+ */
+void blogator::output::BuildGraph::fingerprintOptions() {
+    auto common  = Digest();
+    auto posts   = Digest();
+    auto index   = Digest();
+    auto landing = Digest();
+    auto rss     = Digest();
+    auto json    = Digest();
+
+    common.add( _options.getSoftwareSignatureStr() )
+          .add( _options._templates.adapt_rel_paths );
+
+    for( unsigned m = 1; m <= 12; ++m ) {
+        auto it = _options._months.find( m );
+        common.add( it != _options._months.cend() ? it->second : "" );
+    }
+
+    common.add( _options._page_nav.separator )
+          .add( _options._page_nav.forward )
+          .add( _options._page_nav.backward )
+          .add( _options._page_nav.first )
+          .add( _options._page_nav.last )
+          .add( _options._breadcrumb.start )
+          .add( _options._breadcrumb.by_date )
+          .add( _options._breadcrumb.by_year )
+          .add( _options._breadcrumb.by_tag )
+          .add( _options._breadcrumb.by_author )
+          .add( _options._breadcrumb.page );
+
+    posts.add( _options._posts.adapt_rel_paths )
+         .add( static_cast<uint64_t>( _options._posts.toc.generate_toc ) )
+         .add( static_cast<uint64_t>( _options._posts.toc.level_offset ) )
+         .add( _options._posts.toc.numbering )
+         .add( _options._posts.toc.heading )
+         .add( _options._posts.ssi.index_panes )
+         .add( _options._posts.ssi.current_post_css )
+         .add( _options._posts.block_classes.toc );
+
+    index.add( _options._index.show_summary )
+         .add( _options._index.summary_pad_begin )
+         .add( _options._index.summary_pad_end )
+         .add( _options._index.featured_css_class )
+         .add( _options._index.items_per_page )
+         .add( _options._index.stable_pagination )
+         .add( _options._index.index_by_year )
+         .add( _options._index.index_by_tag )
+         .add( _options._index.index_by_author );
+
+    landing.add( _options._landing_page.most_recent )
+           .add( _options._landing_page.top_tags )
+           .add( _options._landing_page.top_authors )
+           .add( _options._landing_page.duplicates );
+
+    for( const auto &featured : _options._landing_page.featured )
+        landing.add( featured.first ).add( featured.second );
+
+    rss.add( _options._rss.generate )
+       .add( _options._rss.item_count )
+       .add( _options._rss.file_name )
+       .add( _options._rss.root_url )
+       .add( _options._rss.title )
+       .add( _options._rss.description )
+       .add( _options._rss.copyright )
+       .add( _options._rss.img_url )
+       .add( _options._rss.img_link )
+       .add( _options._rss.img_alt )
+       .add( _options._rss.img_width )
+       .add( _options._rss.img_height );
+
+    json.add( _options._json_index.generate )
+        .add( _options._json_index.file_name );
+
+    for( const auto &append_path : _options._json_index.append_paths )
+        json.add( append_path ).addFile( _options._paths.root_dir / append_path );
+
+    setInput( CFG_COMMON, common.value() );
+    setInput( CFG_POSTS, posts.value() );
+    setInput( CFG_INDEX, index.value() );
+    setInput( CFG_LANDING, landing.value() );
+    setInput( CFG_RSS, rss.value() );
+    setInput( CFG_JSON, json.value() );
+}
+
+/**
+ * Fingerprints a category index (names, page file names, listed posts and top categories)
+ * @param key          Input key
+ * @param master_index Master index
+ * @param category     Category index
+ */
+void blogator::output::BuildGraph::fingerprintCategory( const std::string &key,
+                                                        const dto::Index &master_index,
+                                                        const dto::Index::Category &category )
+{
+    auto digest = Digest();
+
+    for( const auto &cat : category.cats ) {
+        digest.add( category.name( cat.first ) )
+              .add( static_cast<uint64_t>( cat.second.file_names.size() ) );
+
+        for( const auto &file_name : cat.second.file_names )
+            digest.add( file_name.string() );
+
+        digest.add( static_cast<uint64_t>( cat.second.article_indices.size() ) );
+
+        for( const auto &i : cat.second.article_indices ) {
+            const auto &article = master_index._articles.at( i );
+            digest.add( article._paths.out_html.string() ).add( article._heading );
+        }
+    }
+
+    digest.add( static_cast<uint64_t>( category.top.size() ) );
+
+    for( const auto &id : category.top )
+        digest.add( category.name( id ) );
+
+    setInput( key, digest.value() );
+}
+
+/**
+ * Writes a fixed-size value to a binary stream
+ * @tparam T  Value type
+ * @param out Output stream
+ * @param val Value
+ */
+template<typename T> void blogator::output::BuildGraph::write( std::ostream &out, const T &val ) {
+    out.write( reinterpret_cast<const char *>( &val ), sizeof( T ) );
+}
+
+/**
+ * Writes a length-prefixed string to a binary stream
+ * @param out Output stream
+ * @param str String
+ */
+void blogator::output::BuildGraph::write( std::ostream &out, const std::string &str ) {
+    write( out, static_cast<uint64_t>( str.size() ) );
+    out.write( str.data(), str.size() );
+}
+
+/**
+ * Reads a fixed-size value from a binary stream
+ * @tparam T Value type
+ * @param in Input stream
+ * @return Value
+ * @throws exception::file_parsing_failure when the stream ended prematurely
+ */
+template<typename T> T blogator::output::BuildGraph::read( std::istream &in ) {
+    T val;
+    in.read( reinterpret_cast<char *>( &val ), sizeof( T ) );
+
+    if( !in )
+        throw exception::file_parsing_failure( "Unexpected end of file." );
+
+    return val;
+}
+
+/**
+ * Reads a length-prefixed string from a binary stream
+ * @param in Input stream
+ * @return String
+ * @throws exception::file_parsing_failure when the stream ended prematurely
+ */
+std::string blogator::output::BuildGraph::readString( std::istream &in ) {
+    auto size = read<uint64_t>( in );
+    auto str  = std::string();
+
+    while( size > 0 && in ) { //reading in chunks so that a corrupted size does not trigger a huge allocation
+        char   buffer[ 4096 ];
+        auto   chunk = std::min<uint64_t>( size, sizeof( buffer ) );
+        in.read( buffer, chunk );
+        str.append( buffer, in.gcount() );
+        size -= chunk;
+    }
+
+    if( !in )
+        throw exception::file_parsing_failure( "Unexpected end of file." );
+
+    return str;
+}
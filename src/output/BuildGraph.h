@@ -0,0 +1,115 @@
+#ifndef BLOGATOR_OUTPUT_BUILDGRAPH_H
+#define BLOGATOR_OUTPUT_BUILDGRAPH_H
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../dto/Index.h"
+#include "../dto/Options.h"
+#include "../dto/Templates.h"
+
+namespace blogator::output {
+    /**
+     * Persistent dependency graph of the generated files
+     *
+     * Each output file is recorded with the list of the inputs it was built from (source posts,
+     * templates, configuration sections, index listings and ordering values). Inputs are named
+     * and fingerprinted at the start of a run. On an incremental run an output whose recorded
+     * inputs are all unchanged (and whose file is still there) does not need rendering again and
+     * the outputs of the previous run that nothing claimed in the current one are stale.
+     *
+     * Input key kinds:
+     * - fingerprinted: 'cfg:..', 'tmpl:..', 'body:..', 'entry:..', 'cat:..', 'tree:..' (set with setInput(..))
+     * - literal......: 'val:<name>=<value>' (compared by value, e.g.: the position of a page in a listing)
+     * An unknown fingerprinted key always makes its output dirty.
+     */
+    class BuildGraph {
+      public:
+        typedef uint64_t                 Fingerprint_t;
+        typedef std::vector<std::string> Inputs_t;
+
+        /**
+         * 64bit FNV-1a digest
+         */
+        class Digest {
+          public:
+            Digest & add( std::string_view str );
+            Digest & add( uint64_t val );
+            Digest & add( const dto::HTML &html );
+            Digest & addFile( const std::filesystem::path &path );
+
+            [[nodiscard]] Fingerprint_t value() const;
+
+          private:
+            Fingerprint_t _hash { 0xcbf29ce484222325 };
+
+            void append( const char *data, size_t size );
+        };
+
+        static constexpr const char *CFG_COMMON   = "cfg:common";   //templates, months, page-nav, breadcrumbs
+        static constexpr const char *CFG_POSTS    = "cfg:posts";
+        static constexpr const char *CFG_INDEX    = "cfg:index";
+        static constexpr const char *CFG_LANDING  = "cfg:landing";
+        static constexpr const char *CFG_RSS      = "cfg:rss";
+        static constexpr const char *CFG_JSON     = "cfg:json";
+        static constexpr const char *ARTICLES     = "index:articles"; //all the index entries in chronological order
+        static constexpr const char *CAT_YEARS    = "cat:years";
+        static constexpr const char *CAT_TAGS     = "cat:tags";
+        static constexpr const char *CAT_AUTHORS  = "cat:authors";
+        static constexpr const char *TREE_DATES   = "tree:dates"; //set by the post page maker
+        static constexpr const char *TREE_TAGS    = "tree:tags";  //set by the post page maker
+
+        explicit BuildGraph( const dto::Options &global_options );
+
+        bool load();
+        void save() const;
+        void discard() const;
+
+        void fingerprintInputs( const dto::Index &master_index, const dto::Templates &templates );
+        void setInput( const std::string &key, Fingerprint_t fingerprint );
+        bool update( const std::filesystem::path &output, Inputs_t inputs );
+        size_t removeStaleOutputs();
+
+        [[nodiscard]] bool incremental() const;
+        [[nodiscard]] size_t outputCount() const;
+        [[nodiscard]] size_t renderCount() const;
+        [[nodiscard]] std::filesystem::path path() const;
+
+        static std::string templateKey( const dto::Template &page_template );
+        static std::string bodyKey( const dto::Article &article );
+        static std::string entryKey( const dto::Article &article );
+        static std::string valueKey( const std::string &name, const std::string &value );
+
+      private:
+        static constexpr uint32_t FORMAT_VERSION { 1 };
+
+        typedef std::unordered_map<std::string, Fingerprint_t> InputMap_t;  //{K=input key, V=fingerprint}
+        typedef std::unordered_map<std::string, Inputs_t>      OutputMap_t; //{K=output path, V=input keys}
+
+        const dto::Options    &_options;
+        std::filesystem::path  _graph_path;
+        std::string            _fingerprint;
+        bool                   _loaded;
+        mutable std::mutex     _mutex;
+        InputMap_t             _cached_inputs;  //inputs of the previous run
+        OutputMap_t            _cached_outputs; //outputs of the previous run
+        InputMap_t             _inputs;         //inputs of the current run
+        OutputMap_t            _outputs;        //outputs of the current run (what gets saved)
+        size_t                 _render_count;
+
+        bool isDirty( const std::filesystem::path &output, const Inputs_t &inputs ) const;
+        void fingerprintOptions();
+        void fingerprintCategory( const std::string &key, const dto::Index &master_index, const dto::Index::Category &category );
+
+        template<typename T> static void write( std::ostream &out, const T &val );
+        static void write( std::ostream &out, const std::string &str );
+        template<typename T> static T read( std::istream &in );
+        static std::string readString( std::istream &in );
+    };
+}
+
+#endif //BLOGATOR_OUTPUT_BUILDGRAPH_H
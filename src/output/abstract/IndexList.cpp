@@ -22,6 +22,7 @@ blogator::output::abstract::IndexList::IndexList( std::shared_ptr<const dto::Opt
     _display( cli::MsgInterface::getInstance() ),
     _options( std::move( global_options ) ),
     _template( entry_template ),
+    _renderer( entry_template, helper::TemplateRenderer::Layout::LIST ),
     _breadcrumb_parents( std::move( breadcrumb ) ),
     _breadcrumb_page_str( std::move( page_name ) )
 {}
@@ -38,86 +39,13 @@ void blogator::output::abstract::IndexList::write( dto::Page &page ) const {
 
     page._out << _options->getSoftwareSignatureStr() << "\n";
 
-    dto::Template::WritePosIterators insert_points = { _template.block_write_pos.cbegin(), _template.path_write_pos.cbegin() };
-    dto::Line                        line          = { _template.html->_lines.cbegin(), 0 };
-
-    while( line._it != _template.html->_lines.cend() ) {
-        writeTemplateLine( page, line, insert_points );
-        ++line;
-    }
+    _renderer.write( page, [&]( dto::Page &p, const std::string &indent, const std::string &block_name ) {
+        return writeHtmlBlock( p, indent, block_name );
+    } );
 
     page._out.close();
 }
 
-/**
- *
- * @param page
- * @param line
- * @param insert_it
- */
-void blogator::output::abstract::IndexList::writeTemplateLine( dto::Page       &page,
-                                                               const dto::Line &line,
-                                                               dto::Template::WritePosIterators &insert_it ) const
-{
-    auto hasBlock = [&]() { return ( insert_it.block != _template.block_write_pos.cend() && insert_it.block->first.line == line._num ); };
-    auto hasPath  = [&]() { return ( insert_it.path  != _template.path_write_pos.cend()  && insert_it.path->first.line  == line._num ); };
-
-    std::string::size_type col = 0;
-    const auto indent = html::reader::getIndent( *line._it );
-    bool carriage_return = false;
-
-    //EARLY RETURN: when there's nothing to add/edit on the line
-    if( !hasBlock() && !hasPath() ) {
-        page._out << *line._it << "\n";
-        return;
-    }
-
-    while( hasBlock() && hasPath() ) {
-        if( insert_it.block->first.col < insert_it.path->first.col ) { //do the block first
-            if( carriage_return )
-                page._out << indent;
-
-            page._out << line._it->substr( col, insert_it.block->first.col - col );
-
-            if( ( carriage_return = writeHtmlBlock( page, indent, insert_it.block->second ) ) )
-                page._out << indent;
-
-            col = insert_it.block->first.col;
-            ++insert_it.block;
-
-        } else { //do the path first
-            page._out << line._it->substr( col, insert_it.path->first.col - col )
-                      << html::encodePathToURL( fs::adaptRelPath( _template.src, page._abs_path, insert_it.path->second.string() ).string() );
-
-            col = insert_it.path->first.col;
-            ++insert_it.path;
-        }
-    }
-
-    while( hasBlock() ) { //just block(s) left to insert
-        if( carriage_return )
-            page._out << indent;
-
-        page._out << line._it->substr( col, insert_it.block->first.col - col );
-
-        if( ( carriage_return = writeHtmlBlock( page, indent, insert_it.block->second ) ) )
-            page._out << indent;
-
-        col = insert_it.block->first.col;
-        ++insert_it.block;
-    }
-
-    while( hasPath() ) { //just path(s) left to insert
-        page._out << line._it->substr( col, insert_it.path->first.col - col )
-                  << html::encodePathToURL( fs::adaptRelPath( _template.src, page._abs_path, insert_it.path->second.string() ).string() );
-
-        col = insert_it.path->first.col;
-        ++insert_it.path;
-    }
-
-    page._out << line._it->substr( col ) << "\n";
-}
-
 /**
  * Write the HTML block to the page
  * @param page         Output page DTO
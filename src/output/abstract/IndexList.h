@@ -7,6 +7,7 @@
 #include "../../dto/Page.h"
 #include "../../dto/Line.h"
 #include "Page.h"
+#include "../helper/TemplateRenderer.h"
 
 namespace blogator::output::abstract {
     class IndexList : Breadcrumb {
@@ -24,13 +25,10 @@ namespace blogator::output::abstract {
         cli::MsgInterface                  &_display;
         std::shared_ptr<const dto::Options> _options;
 
-        const dto::Template &_template;
-        BreadCrumb_t        _breadcrumb_parents;
-        std::string         _breadcrumb_page_str;
-
-        void writeTemplateLine( dto::Page       &page,
-                                const dto::Line &line,
-                                dto::Template::WritePosIterators &insert_it ) const;
+        const dto::Template      &_template;
+        helper::TemplateRenderer  _renderer;
+        BreadCrumb_t              _breadcrumb_parents;
+        std::string               _breadcrumb_page_str;
 
         bool writeHtmlBlock( dto::Page &page,
                              const std::string  &indent,
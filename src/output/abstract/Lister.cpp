@@ -6,16 +6,96 @@
  * @param global_options Global Options DTO
  * @param articles       Articles
  * @param page_template  Page Template DTO to use
+ * @param build_graph    Build graph
+ * @param inputs         Build graph inputs common to all the pages of the listing
  */
 blogator::output::abstract::Lister::Lister( std::shared_ptr<const dto::Options> global_options,
                                             const dto::Index::Articles_t &articles,
-                                            const dto::Template          &page_template ) :
+                                            const dto::Template          &page_template,
+                                            std::shared_ptr<BuildGraph>  build_graph,
+                                            BuildGraph::Inputs_t         inputs ) :
     _display( cli::MsgInterface::getInstance() ),
     _options( std::move( global_options ) ),
     _articles( articles ),
-    _template( page_template )
+    _template( page_template ),
+    _renderer( page_template, helper::TemplateRenderer::Layout::LIST ),
+    _build_graph( std::move( build_graph ) ),
+    _inputs( std::move( inputs ) )
 {}
 
+/**
+ * Calculates the number of entries on a listing page
+ * (with stable pagination the first page takes the remainder so that the older pages are always full)
+ * @param page_i    Position of the page in the listing
+ * @param remaining Number of entries left to list from the page onwards
+ * @return Entry count
+ */
+size_t blogator::output::abstract::Lister::calcPageItemCount( size_t page_i, size_t remaining ) const {
+    const auto per_page = _options->_index.items_per_page;
+
+    if( _options->_index.stable_pagination && page_i == 0 && ( remaining % per_page ) > 0 )
+        return remaining % per_page;
+
+    return std::min( per_page, remaining );
+}
+
+/**
+ * Calculates the number shown for a listing page
+ * (with stable pagination the pages are counted from the last one so that the number of a page does not change)
+ * @param paths   Collection of page paths
+ * @param path_it Iterator to the page's path
+ * @return Page number
+ */
+size_t blogator::output::abstract::Lister::calcPageNumber( const dto::Index::PagePaths_t &paths,
+                                                           const dto::Index::PagePaths_t::const_iterator &path_it ) const
+{
+    const auto page_i = static_cast<size_t>( path_it - paths.cbegin() );
+
+    return ( _options->_index.stable_pagination ? paths.size() - page_i : page_i + 1 );
+}
+
+/**
+ * Gets the position description of a page in the page navigation
+ * @param paths   Collection of page paths
+ * @param path_it Iterator to the page's path
+ * @return Page number and page count (page number only with stable pagination)
+ */
+std::string blogator::output::abstract::Lister::getPageNavPosition( const dto::Index::PagePaths_t &paths,
+                                                                    const dto::Index::PagePaths_t::const_iterator &path_it ) const
+{
+    if( _options->_index.stable_pagination )
+        return std::to_string( calcPageNumber( paths, path_it ) );
+
+    return std::to_string( calcPageNumber( paths, path_it ) ) + _options->_page_nav.separator + std::to_string( paths.size() );
+}
+
+/**
+ * Gets the inputs a listing page is built from (without its entries)
+ * @param paths   Collection of page paths
+ * @param path_it Iterator to the page's path
+ * @return Build graph input keys
+ */
+blogator::output::BuildGraph::Inputs_t blogator::output::abstract::Lister::getPageInputs(
+    const dto::Index::PagePaths_t &paths,
+    const dto::Index::PagePaths_t::const_iterator &path_it ) const
+{
+    const bool is_first = path_it == paths.cbegin();
+    const bool is_last  = path_it == std::prev( paths.cend() );
+
+    auto digest = BuildGraph::Digest(); //what the page navigation/breadcrumb shows
+
+    digest.add( getPageNavPosition( paths, path_it ) )
+          .add( paths.cbegin()->string() )
+          .add( is_first ? std::string() : std::prev( path_it )->string() )
+          .add( is_last ? std::string() : std::next( path_it )->string() )
+          .add( std::prev( paths.cend() )->string() );
+
+    auto inputs = _inputs;
+
+    inputs.emplace_back( BuildGraph::valueKey( "page-nav", std::to_string( digest.value() ) ) );
+    return inputs;
+}
+
 /**
  * Writes the page navigation html to a file
  * @param page    Target file
@@ -30,7 +110,6 @@ void blogator::output::abstract::Lister::writePageNavDiv( dto::Page &page,
 {
     const bool   is_first    = path_it == paths.cbegin();
     const bool   is_last     = path_it == std::prev( paths.cend() );
-    const size_t page_number = ( path_it - paths.cbegin() ) + 1;
 
     page._out << indent << "<ul>\n"
               << indent << "\t<li class=\"first\">"
@@ -44,7 +123,7 @@ void blogator::output::abstract::Lister::writePageNavDiv( dto::Page &page,
                              : html::createHyperlink( *std::prev( path_it ), _options->_page_nav.backward, "", "prev" ) )
                         << "</li>\n"
               << indent << "\t<li class=\"curr\">"
-                        << std::to_string( page_number ) << _options->_page_nav.separator << std::to_string( paths.size() )
+                        << getPageNavPosition( paths, path_it )
                         << "</li>\n"
               << indent << "\t<li class=\"next\">"
                         << ( is_last
@@ -56,6 +135,5 @@ void blogator::output::abstract::Lister::writePageNavDiv( dto::Page &page,
                              ? html::createHyperlink( *std::prev( paths.cend() ), _options->_page_nav.last, "disabled" )
                              : html::createHyperlink( *std::prev( paths.cend() ), _options->_page_nav.last ) )
                         << "</li>\n"
-              << indent << "</ul>"
-              << std::endl;
+              << indent << "</ul>\n";
 }
\ No newline at end of file
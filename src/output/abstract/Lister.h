@@ -2,17 +2,21 @@
 #define BLOGATOR_OUTPUT_ABSTRACT_LISTER_H
 
 #include "Breadcrumb.h"
+#include "../BuildGraph.h"
 #include "../../dto/Index.h"
 #include "../../dto/Template.h"
 #include "../../dto/Options.h"
 #include "../../cli/MsgInterface.h"
+#include "../helper/TemplateRenderer.h"
 
 namespace blogator::output::abstract {
     class Lister : protected abstract::Breadcrumb {
       public:
         Lister( std::shared_ptr<const dto::Options> global_options,
                 const dto::Index::Articles_t &articles,
-                const dto::Template          &page_template );
+                const dto::Template          &page_template,
+                std::shared_ptr<BuildGraph>  build_graph,
+                BuildGraph::Inputs_t         inputs );
 
       protected:
         cli::MsgInterface                  &_display;
@@ -20,6 +24,18 @@ namespace blogator::output::abstract {
 
         const dto::Index::Articles_t &_articles;
         const dto::Template          &_template;
+        helper::TemplateRenderer      _renderer;
+        std::shared_ptr<BuildGraph>   _build_graph;
+        const BuildGraph::Inputs_t    _inputs; //build graph inputs common to all the pages of the listing
+
+        [[nodiscard]] size_t calcPageItemCount( size_t page_i, size_t remaining ) const;
+        [[nodiscard]] size_t calcPageNumber( const dto::Index::PagePaths_t &paths,
+                                             const dto::Index::PagePaths_t::const_iterator &path_it ) const;
+        [[nodiscard]] std::string getPageNavPosition( const dto::Index::PagePaths_t &paths,
+                                                      const dto::Index::PagePaths_t::const_iterator &path_it ) const;
+
+        [[nodiscard]] BuildGraph::Inputs_t getPageInputs( const dto::Index::PagePaths_t &paths,
+                                                          const dto::Index::PagePaths_t::const_iterator &path_it ) const;
 
         void writePageNavDiv( dto::Page &page,
                               const std::string &indent,
@@ -5,12 +5,15 @@
  * @param master_index   Master index
  * @param templates      Templates
  * @param global_options Global blogator options
+ * @param build_graph    Build graph
  */
 blogator::output::abstract::Page::Page( std::shared_ptr<const blogator::dto::Index> master_index,
                                         std::shared_ptr<const blogator::dto::Templates> templates,
-                                        std::shared_ptr<const blogator::dto::Options> global_options ) :
+                                        std::shared_ptr<const blogator::dto::Options> global_options,
+                                        std::shared_ptr<BuildGraph> build_graph ) :
     _index( std::move( master_index ) ),
     _templates( std::move( templates ) ),
     _options( std::move( global_options ) ),
+    _build_graph( std::move( build_graph ) ),
     _display( cli::MsgInterface::getInstance() )
 {}
\ No newline at end of file
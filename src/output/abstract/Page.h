@@ -2,6 +2,7 @@
 #define BLOGATOR_OUTPUT_ABSTRACT_PAGE_H
 
 #include "Breadcrumb.h"
+#include "../BuildGraph.h"
 #include "../../dto/Index.h"
 #include "../../dto/Templates.h"
 #include "../../dto/Options.h"
@@ -12,13 +13,15 @@ namespace blogator::output::abstract {
       public:
         Page( std::shared_ptr<const dto::Index>     master_index,
               std::shared_ptr<const dto::Templates> templates,
-              std::shared_ptr<const dto::Options>   global_options );
+              std::shared_ptr<const dto::Options>   global_options,
+              std::shared_ptr<BuildGraph>           build_graph );
 
       protected:
-        cli::MsgInterface                    &_display;
         std::shared_ptr<const dto::Index>     _index;
         std::shared_ptr<const dto::Templates> _templates;
         std::shared_ptr<const dto::Options>   _options;
+        std::shared_ptr<BuildGraph>           _build_graph;
+        cli::MsgInterface                    &_display;
     };
 }
 
@@ -3,6 +3,7 @@
 #include <fstream>
 
 #include "RSS.h"
+#include "../../dto/Page.h"
 #include "../../exception/file_access_failure.h"
 
 /**
@@ -10,13 +11,16 @@
  * @param master_index   Master index
  * @param templates      Templates
  * @param global_options Global blogator options
+ * @param build_graph    Build graph
  */
 blogator::output::feed::RSS::RSS( std::shared_ptr<const dto::Index>     master_index,
                                   std::shared_ptr<const dto::Templates> templates,
-                                  std::shared_ptr<const dto::Options>   global_options ) :
+                                  std::shared_ptr<const dto::Options>   global_options,
+                                  std::shared_ptr<BuildGraph>           build_graph ) :
     _master_index( std::move( master_index ) ),
     _templates( std::move( templates ) ),
     _options( std::move( global_options ) ),
+    _build_graph( std::move( build_graph ) ),
     _display( cli::MsgInterface::getInstance() )
 {
     _feed_item_count = _options->_rss.item_count > _master_index->_articles.size()
@@ -33,14 +37,22 @@ bool blogator::output::feed::RSS::init() {
         return true;
 
     try {
-        auto path = _options->_paths.root_dir / _options->_rss.file_name;
+        auto path   = _options->_paths.root_dir / _options->_rss.file_name;
+        auto inputs = BuildGraph::Inputs_t( { BuildGraph::CFG_COMMON, BuildGraph::CFG_RSS } );
 
-        if( std::filesystem::exists( path ) )
+        for( size_t i = 0; i < _feed_item_count; ++i )
+            inputs.emplace_back( BuildGraph::entryKey( _master_index->_articles[ i ] ) );
+
+        if( _options->purgesOutput() && std::filesystem::exists( path ) )
             throw exception::file_access_failure(
                 "Old RSS feed file was not purged: " + path.string()
             );
 
-        std::ofstream out( path );
+        if( !_build_graph->update( path, std::move( inputs ) ) )
+            return true; //unchanged since the last run (keeps its 'lastBuildDate')
+
+        auto  page = dto::Page( path );
+        auto &out  = page._out;
 
         if( !out.is_open() )
             throw exception::file_access_failure(
@@ -67,7 +79,7 @@ bool blogator::output::feed::RSS::init() {
  * Writes the feed's header tags
  * @param file RSS feed file
  */
-void blogator::output::feed::RSS::writeHead( std::ofstream &file ) const {
+void blogator::output::feed::RSS::writeHead( std::ostream &file ) const {
     _display.begin( "Generating RSS feed", _feed_item_count + 2, "header" );
 
     file << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
@@ -100,7 +112,7 @@ void blogator::output::feed::RSS::writeHead( std::ofstream &file ) const {
  * Writes all article items into the feed
  * @param file RSS feed file
  */
-void blogator::output::feed::RSS::writeItems( std::ofstream &file ) const {
+void blogator::output::feed::RSS::writeItems( std::ostream &file ) const {
     size_t item_count  = 0;
     auto   article_it  = _master_index->_articles.cbegin();
 
@@ -120,7 +132,7 @@ void blogator::output::feed::RSS::writeItems( std::ofstream &file ) const {
                                   << "</pubDate>\n";
 
         for( const auto &tag : article_it->_tags ) {
-            file << "\t\t\t<category>" << tag << "</category>\n";
+            file << "\t\t\t<category>" << _master_index->_indices.byTag.name( tag ) << "</category>\n";
         }
 
         file << "\t\t\t<description>";
@@ -140,7 +152,7 @@ void blogator::output::feed::RSS::writeItems( std::ofstream &file ) const {
  * Write the feed's footer closing tags
  * @param file RSS feed file
  */
-void blogator::output::feed::RSS::writeFoot( std::ofstream & file ) const {
+void blogator::output::feed::RSS::writeFoot( std::ostream &file ) const {
     _display.progress( "footer" );
     file << "\t</channel>\n"
          << "</rss>";
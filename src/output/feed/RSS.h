@@ -7,13 +7,15 @@
 #include "../../dto/Options.h"
 #include "../../dto/Templates.h"
 #include "../../cli/MsgInterface.h"
+#include "../BuildGraph.h"
 
 namespace blogator::output::feed {
     class RSS {
       public:
         RSS( std::shared_ptr<const dto::Index>     master_index,
              std::shared_ptr<const dto::Templates> templates,
-             std::shared_ptr<const dto::Options>   global_options );
+             std::shared_ptr<const dto::Options>   global_options,
+             std::shared_ptr<BuildGraph>           build_graph );
 
         bool init();
 
@@ -21,12 +23,13 @@ namespace blogator::output::feed {
         std::shared_ptr<const dto::Index>     _master_index;
         std::shared_ptr<const dto::Templates> _templates;
         std::shared_ptr<const dto::Options>   _options;
+        std::shared_ptr<BuildGraph>           _build_graph;
         size_t                                _feed_item_count;
         cli::MsgInterface                    &_display;
 
-        void writeHead( std::ofstream &file ) const;
-        void writeItems( std::ofstream &file ) const;
-        void writeFoot( std::ofstream &file ) const;
+        void writeHead( std::ostream &file ) const;
+        void writeItems( std::ostream &file ) const;
+        void writeFoot( std::ostream &file ) const;
 
     };
 }
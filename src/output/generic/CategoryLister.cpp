@@ -7,6 +7,7 @@
 #include "../../html/html.h"
 #include "../../html/reader/reader.h"
 #include "../../fs/fs.h"
+#include "../../fs/OutputQueue.h"
 #include "../../cli/MsgInterface.h"
 #include "../../html/editor/editor.h"
 
@@ -16,21 +17,27 @@
  * @param articles       Articles
  * @param page_template  Page Template to use
  * @param entry_maker    EntryMaker instance to use
+ * @param build_graph    Build graph
+ * @param inputs         Build graph inputs common to all the pages of the listing
  */
 blogator::output::generic::CategoryLister::CategoryLister( std::shared_ptr<const dto::Options> global_options,
                                                            const dto::Index::Articles_t &articles,
                                                            const dto::Template          &page_template,
-                                                           generic::EntryWriter         entry_maker ) :
+                                                           generic::EntryWriter         entry_maker,
+                                                           std::shared_ptr<BuildGraph>  build_graph,
+                                                           BuildGraph::Inputs_t         inputs ) :
     Lister(
         std::move( global_options ),
         articles,
-        page_template
+        page_template,
+        std::move( build_graph ),
+        std::move( inputs )
     ),
     _entry_maker( std::move( entry_maker ) )
 {}
 
 /**
- * Writes categorised index pages
+ * Writes categorised index pages (the pages whose inputs are unchanged since the last run are skipped)
  * @param cat_index  Index::Category index
  * @param breadcrumb Parent Breadcrumb
  * @param dir_path   Absolute path to the output directory of the index files
@@ -42,6 +49,7 @@ void blogator::output::generic::CategoryLister::write( const dto::Index::Categor
     auto &display = cli::MsgInterface::getInstance();
 
     _breadcrumb_parents = breadcrumb;
+    _category           = &cat_index;
 
     auto cat_it = cat_index.cats.cbegin();
     while( cat_it != cat_index.cats.cend() ) {
@@ -54,18 +62,35 @@ void blogator::output::generic::CategoryLister::write( const dto::Index::Categor
             if( page_path_it == cat_it->second.file_names.cend() )
                 throw std::invalid_argument(
                     "Page paths found for categorised index pages are not sufficient for the number of articles. "
-                    "(dir: '" + dir_path.filename().string() + "', cat = '" + cat_it->first + "')"
+                    "(dir: '" + dir_path.filename().string() + "', cat = '" + cat_index.name( cat_it->first ) + "')"
                 );
 
             auto abs_file_path = dir_path / *page_path_it;
             display.progress( dir_path.stem() / *page_path_it );
 
-            if( std::filesystem::exists( abs_file_path ) )
+            if( !fs::OutputQueue::getInstance().claim( abs_file_path ) )
                 throw exception::file_access_failure(
                     "File '" + abs_file_path.string() + "' already exists."
                 );
 
-            dto::Page page = { abs_file_path, std::ofstream( abs_file_path ) };
+            auto page_inputs = getPageInputs( cat_it->second.file_names, page_path_it );
+            _page_item_count = calcPageItemCount( page_path_it - cat_it->second.file_names.cbegin(),
+                                                  cat_it->second.article_indices.cend() - article_i_it );
+
+            auto page_end_it = article_i_it + _page_item_count;
+
+            page_inputs.emplace_back( BuildGraph::valueKey( "category", _category->name( cat_it->first ) ) );
+
+            for( auto it = article_i_it; it != page_end_it; ++it )
+                page_inputs.emplace_back( BuildGraph::entryKey( _articles.at( *it ) ) );
+
+            if( !_build_graph->update( abs_file_path, std::move( page_inputs ) ) ) {
+                article_i_it = page_end_it;
+                ++page_path_it;
+                continue;
+            }
+
+            auto page = dto::Page( abs_file_path );
 
             if( !page._out.is_open() )
                 throw exception::file_access_failure(
@@ -74,13 +99,9 @@ void blogator::output::generic::CategoryLister::write( const dto::Index::Categor
 
             page._out << _options->getSoftwareSignatureStr() << "\n";
 
-            dto::Template::WritePosIterators insert_points = { _template.block_write_pos.cbegin(), _template.path_write_pos.cbegin() };
-            dto::Line                        line          = { _template.html->_lines.cbegin(), 0 };
-
-            while( line._it != _template.html->_lines.cend() ) {
-                writeTemplateLine( page, line, cat_it, page_path_it, article_i_it, insert_points );
-                ++line;
-            }
+            _renderer.write( page, [&]( dto::Page &p, const std::string &indent, const std::string &block_name ) {
+                return writeHtmlBlock( p, indent, block_name, cat_it, page_path_it, article_i_it );
+            } );
 
             page._out.close();
             ++page_path_it;
@@ -90,82 +111,6 @@ void blogator::output::generic::CategoryLister::write( const dto::Index::Categor
     }
 }
 
-/**
- * Inserts any paths/block that are on a line
- * @param page         Output page DTO
- * @param line         Line DTO
- * @param cat_it       Iterator to the categories
- * @param page_path_it Iterator to the current page path
- * @param article_i_it Iterator to the article index position
- * @param insert_it    Iterators to the block/path insertion points for the template
- */
-void blogator::output::generic::CategoryLister::writeTemplateLine(
-    dto::Page         &page,
-    const dto::Line   &line,
-    const dto::Index::ListIndexPaths_t::const_iterator &cat_it,
-    const dto::Index::PagePaths_t::const_iterator      &page_path_it,
-    std::vector<size_t>::const_iterator                &article_i_it,
-    dto::Template::WritePosIterators                   &insert_it )
-{
-    auto hasBlock = [&]() { return ( insert_it.block != _template.block_write_pos.cend() && insert_it.block->first.line == line._num ); };
-    auto hasPath  = [&]() { return ( insert_it.path  != _template.path_write_pos.cend()  && insert_it.path->first.line  == line._num ); };
-
-    std::string::size_type col = 0;
-    const auto indent = html::reader::getIndent( *line._it );
-    bool carriage_return = false;
-
-    //EARLY RETURN: when there's nothing to add/edit on the line
-    if( !hasBlock() && !hasPath() ) {
-        page._out << *line._it << "\n";
-        return;
-    }
-
-    while( hasBlock() && hasPath() ) {
-        if( insert_it.block->first.col < insert_it.path->first.col ) { //do the block first
-            if( carriage_return )
-                page._out << indent;
-
-            page._out << line._it->substr( col, insert_it.block->first.col - col );
-
-            if( ( carriage_return = writeHtmlBlock( page, indent, insert_it.block->second, cat_it, page_path_it, article_i_it ) ) )
-                page._out << indent;
-
-            col = insert_it.block->first.col;
-            ++insert_it.block;
-
-        } else { //do the path first
-            page._out << line._it->substr( col, insert_it.path->first.col - col )
-                      << html::encodePathToURL( fs::adaptRelPath( _template.src, page._abs_path, insert_it.path->second.string() ).string() );
-
-            col = insert_it.path->first.col;
-            ++insert_it.path;
-        }
-    }
-
-    while( hasBlock() ) { //just block(s) left to insert
-        if( carriage_return )
-            page._out << indent;
-
-        page._out << line._it->substr( col, insert_it.block->first.col - col );
-
-        if( ( carriage_return = writeHtmlBlock( page, indent, insert_it.block->second, cat_it, page_path_it, article_i_it ) ) )
-            page._out << indent;
-
-        col = insert_it.block->first.col;
-        ++insert_it.block;
-    }
-
-    while( hasPath() ) { //just path(s) left to insert
-        page._out << line._it->substr( col, insert_it.path->first.col - col )
-                  << html::encodePathToURL( fs::adaptRelPath( _template.src, page._abs_path, insert_it.path->second.string() ).string() );
-
-        col = insert_it.path->first.col;
-        ++insert_it.path;
-    }
-
-    page._out << line._it->substr( col ) << "\n";
-}
-
 /**
  * Write the HTML block to the page
  * @param page         Output page DTO
@@ -185,12 +130,12 @@ bool blogator::output::generic::CategoryLister::writeHtmlBlock(
     std::vector<size_t>::const_iterator                &article_i_it )
 {
     if( block_name == "page-name" ) {
-        page._out << cat_it->first;
+        page._out << _category->name( cat_it->first );
         return false;
 
     } else if( block_name == "breadcrumb" ) {
         page._out  << "\n";
-        writeBreadcrumb( page, indent + "\t", _breadcrumb_parents, cat_it->first );
+        writeBreadcrumb( page, indent + "\t", _breadcrumb_parents, _category->name( cat_it->first ) );
         return true;
 
     } else if( block_name == "page-nav" ) {
@@ -202,7 +147,7 @@ bool blogator::output::generic::CategoryLister::writeHtmlBlock(
         page._out  << "\n";
 
         while( article_i_it != cat_it->second.article_indices.cend() &&
-               _entry_counter < _options->_index.items_per_page )
+               _entry_counter < _page_item_count )
         {
             const auto &article  = _articles.at( *article_i_it );
             auto abs_path        = page._abs_path.parent_path();
@@ -244,13 +189,7 @@ void blogator::output::generic::CategoryLister::writeIndexEntry(
     else
         page._out << indent << "<a href=\"" << post_href_path.string() << "\">\n";
 
-    if( article._cust_index_entry ) {
-        auto custom_entry_maker = generic::EntryWriter( _options, article._cust_index_entry );
-        custom_entry_maker.write( page, indent, article );
-
-    } else {
-        _entry_maker.write( page, indent, article );
-    }
+    _entry_maker.write( page, indent, article );
 
-    page._out << indent << "</a>" << std::endl;
+    page._out << indent << "</a>\n";
 }
\ No newline at end of file
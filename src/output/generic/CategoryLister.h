@@ -14,7 +14,9 @@ namespace blogator::output::generic {
         CategoryLister( std::shared_ptr<const dto::Options> global_options,
                         const dto::Index::Articles_t &articles,
                         const dto::Template          &page_template,
-                        generic::EntryWriter         entry_maker );
+                        generic::EntryWriter         entry_maker,
+                        std::shared_ptr<BuildGraph>  build_graph,
+                        BuildGraph::Inputs_t         inputs );
 
         void write( const dto::Index::Category  &cat_index,
                     const BreadCrumb_t          &breadcrumb,
@@ -23,15 +25,10 @@ namespace blogator::output::generic {
       private:
         const generic::EntryWriter _entry_maker;
 
-        BreadCrumb_t          _breadcrumb_parents;
-        size_t                _entry_counter { 0 };
-
-        void writeTemplateLine( dto::Page       &page,
-                                const dto::Line &line,
-                                const dto::Index::ListIndexPaths_t::const_iterator &cat_it,
-                                const dto::Index::PagePaths_t::const_iterator &page_path_it,
-                                std::vector<size_t>::const_iterator &article_i_it,
-                                dto::Template::WritePosIterators    &insert_it );
+        BreadCrumb_t                  _breadcrumb_parents;
+        const dto::Index::Category   *_category        { nullptr }; //category index being written
+        size_t                        _entry_counter   { 0 };
+        size_t                        _page_item_count { 0 };
 
         bool writeHtmlBlock( dto::Page &page,
                              const std::string  &indent,
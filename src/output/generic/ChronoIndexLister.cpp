@@ -3,6 +3,7 @@
 #include "../../cli/MsgInterface.h"
 #include "../../exception/file_access_failure.h"
 #include "../../fs/fs.h"
+#include "../../fs/OutputQueue.h"
 #include "../../html/html.h"
 #include "../../exception/failed_expectation.h"
 
@@ -12,21 +13,27 @@
  * @param articles       Articles
  * @param page_template  Page Template to use
  * @param entry_maker    EntryMaker instance to use
+ * @param build_graph    Build graph
+ * @param inputs         Build graph inputs common to all the pages of the listing
  */
 blogator::output::generic::ChronoIndexLister::ChronoIndexLister( std::shared_ptr<const dto::Options> global_options,
                                                                  const dto::Index::Articles_t &articles,
                                                                  const dto::Template          &page_template,
-                                                                 output::generic::EntryWriter entry_maker ) :
+                                                                 output::generic::EntryWriter entry_maker,
+                                                                 std::shared_ptr<BuildGraph>  build_graph,
+                                                                 BuildGraph::Inputs_t         inputs ) :
     Lister(
         std::move( global_options ),
         articles,
-        page_template
+        page_template,
+        std::move( build_graph ),
+        std::move( inputs )
     ),
     _entry_maker( std::move( entry_maker ) )
 {}
 
 /**
- * Writes the chronological index pages
+ * Writes the chronological index pages (the pages whose inputs are unchanged since the last run are skipped)
  * @param chrono_index Chronological index information
  * @param breadcrumb   Parent Breadcrumb
  * @param dir_path     Absolute path to the output directory of the index files
@@ -45,7 +52,6 @@ void blogator::output::generic::ChronoIndexLister::write(
     auto page_path_it  = chrono_index.file_names.cbegin();
 
     while( article_it != _articles.cend() ) {
-        _page_num     += 1;
         _entry_counter = 0;
 
         if( page_path_it == chrono_index.file_names.cend() )
@@ -58,12 +64,26 @@ void blogator::output::generic::ChronoIndexLister::write(
         if( article_it != _articles.cbegin() )
             display.progress( dir_path.stem() / *page_path_it );
 
-        if( std::filesystem::exists( abs_file_path ) )
+        if( !fs::OutputQueue::getInstance().claim( abs_file_path ) )
             throw exception::file_access_failure(
                 "File '" + abs_file_path.string() + "' already exists."
             );
 
-        dto::Page page = { abs_file_path, std::ofstream( abs_file_path ) };
+        auto page_inputs = getPageInputs( chrono_index.file_names, page_path_it );
+        _page_item_count = calcPageItemCount( page_path_it - chrono_index.file_names.cbegin(), _articles.cend() - article_it );
+
+        auto page_end_it = article_it + _page_item_count;
+
+        for( auto it = article_it; it != page_end_it; ++it )
+            page_inputs.emplace_back( BuildGraph::entryKey( *it ) );
+
+        if( !_build_graph->update( abs_file_path, std::move( page_inputs ) ) ) {
+            article_it = page_end_it;
+            ++page_path_it;
+            continue;
+        }
+
+        auto page = dto::Page( abs_file_path );
 
         if( !page._out.is_open() )
             throw exception::file_access_failure(
@@ -72,95 +92,15 @@ void blogator::output::generic::ChronoIndexLister::write(
 
         page._out << _options->getSoftwareSignatureStr() << "\n";
 
-        dto::Template::WritePosIterators insert_points = { _template.block_write_pos.cbegin(), _template.path_write_pos.cbegin() };
-        dto::Line                        line          = { _template.html->_lines.cbegin(), 0 };
-
-        while( line._it != _template.html->_lines.cend() ) {
-            writeTemplateLine( page, line, chrono_index.file_names, page_path_it, article_it, insert_points );
-            ++line;
-        }
+        _renderer.write( page, [&]( dto::Page &p, const std::string &indent, const std::string &block_name ) {
+            return writeHtmlBlock( p, indent, block_name, chrono_index.file_names, page_path_it, article_it );
+        } );
 
         page._out.close();
         ++page_path_it;
     }
 }
 
-/**
- * Inserts any paths/block that are on a line
- * @param page         Output page DTO
- * @param line         Line DTO
- * @param page_paths   List of pages for the index
- * @param page_path_it Current page path iterator
- * @param article_it   Current article iterator
- * @param insert_it    Iterators to the block/path insertion points for the template
- */
-void blogator::output::generic::ChronoIndexLister::writeTemplateLine(
-    dto::Page       &page,
-    const dto::Line &line,
-    const dto::Index::PagePaths_t                  &page_paths,
-    const dto::Index::PagePaths_t::const_iterator  &page_path_it,
-    dto::Index::Articles_t::const_iterator         &article_it,
-    dto::Template::WritePosIterators               &insert_it  )
-{
-    auto hasBlock = [&]() { return ( insert_it.block != _template.block_write_pos.cend() && insert_it.block->first.line == line._num ); };
-    auto hasPath  = [&]() { return ( insert_it.path  != _template.path_write_pos.cend()  && insert_it.path->first.line  == line._num ); };
-
-    std::string::size_type col = 0;
-    const auto indent = html::reader::getIndent( *line._it );
-    bool carriage_return = false;
-
-    //EARLY RETURN: when there's nothing to add/edit on the line
-    if( !hasBlock() && !hasPath() ) {
-        page._out << *line._it << "\n";
-        return;
-    }
-
-    while( hasBlock() && hasPath() ) {
-        if( insert_it.block->first.col < insert_it.path->first.col ) { //do the block first
-            if( carriage_return )
-                page._out << indent;
-
-            page._out << line._it->substr( col, insert_it.block->first.col - col );
-
-            if( ( carriage_return = writeHtmlBlock( page, indent, insert_it.block->second, page_paths, page_path_it, article_it ) ) )
-                page._out << indent;
-
-            col = insert_it.block->first.col;
-            ++insert_it.block;
-
-        } else { //do the path first
-            page._out << line._it->substr( col, insert_it.path->first.col - col )
-                      << html::encodePathToURL( fs::adaptRelPath( _template.src, page._abs_path, insert_it.path->second.string() ).string() );
-
-            col = insert_it.path->first.col;
-            ++insert_it.path;
-        }
-    }
-
-    while( hasBlock() ) { //just block(s) left to insert
-        if( carriage_return )
-            page._out << indent;
-
-        page._out << line._it->substr( col, insert_it.block->first.col - col );
-
-        if( ( carriage_return = writeHtmlBlock( page, indent, insert_it.block->second, page_paths, page_path_it, article_it ) ) )
-            page._out << indent;
-
-        col = insert_it.block->first.col;
-        ++insert_it.block;
-    }
-
-    while( hasPath() ) { //just path(s) left to insert
-        page._out << line._it->substr( col, insert_it.path->first.col - col )
-                  << html::encodePathToURL( fs::adaptRelPath( _template.src, page._abs_path, insert_it.path->second.string() ).string() );
-
-        col = insert_it.path->first.col;
-        ++insert_it.path;
-    }
-
-    page._out << line._it->substr( col ) << "\n";
-}
-
 /**
  * Writes the relevant HTML block at the given position
  * @param page         Output file
@@ -185,7 +125,7 @@ bool blogator::output::generic::ChronoIndexLister::writeHtmlBlock(
 
     } else if( block_name == "breadcrumb" ) {
         page._out  << "\n";
-        auto page_desc = _options->_breadcrumb.page + std::to_string( _page_num );
+        auto page_desc = _options->_breadcrumb.page + std::to_string( calcPageNumber( page_paths, page_path_it ) );
         writeBreadcrumb( page, indent + "\t", _breadcrumb_parents, page_desc );
         return true;
 
@@ -197,7 +137,7 @@ bool blogator::output::generic::ChronoIndexLister::writeHtmlBlock(
     } else if( block_name == "index-entries" ) {
         page._out  << "\n";
 
-        while( article_it != _articles.cend() && _entry_counter < _options->_index.items_per_page ) {
+        while( article_it != _articles.cend() && _entry_counter < _page_item_count ) {
             auto abs_path        = page._abs_path.parent_path();
             auto rel_path        = ( _options->_paths.posts_dir / article_it->_paths.out_html ).lexically_relative( abs_path );
 
@@ -237,13 +177,7 @@ void blogator::output::generic::ChronoIndexLister::writeIndexEntry(
     else
         page._out << indent << "<a href=\"" << post_href_path.string() << "\">\n";
 
-    if( article._cust_index_entry ) {
-        auto custom_entry_maker = generic::EntryWriter( _options, article._cust_index_entry );
-        custom_entry_maker.write( page, indent, article );
-
-    } else {
-        _entry_maker.write( page, indent, article );
-    }
+    _entry_maker.write( page, indent, article );
 
-    page._out << indent << "</a>" << std::endl;
+    page._out << indent << "</a>\n";
 }
\ No newline at end of file
@@ -13,7 +13,9 @@ namespace blogator::output::generic {
       ChronoIndexLister( std::shared_ptr<const dto::Options> global_options,
                          const dto::Index::Articles_t        &articles,
                          const dto::Template                 &page_template,
-                         generic::EntryWriter                entry_maker );
+                         generic::EntryWriter                entry_maker,
+                         std::shared_ptr<BuildGraph>         build_graph,
+                         BuildGraph::Inputs_t                inputs );
 
       void write( const dto::Index::Indices::ChronoIndex &chrono_index,
                   const abstract::Lister::BreadCrumb_t   &breadcrumb,
@@ -23,15 +25,8 @@ namespace blogator::output::generic {
       const generic::EntryWriter _entry_maker;
 
       BreadCrumb_t          _breadcrumb_parents;
-      size_t                _page_num            { 0 };
       size_t                _entry_counter       { 0 };
-
-      void writeTemplateLine( dto::Page       &page,
-                              const dto::Line &line,
-                              const dto::Index::PagePaths_t                  &page_paths,
-                              const dto::Index::PagePaths_t::const_iterator  &page_path_it,
-                              dto::Index::Articles_t::const_iterator         &article_it,
-                              dto::Template::WritePosIterators               &insert_it );
+      size_t                _page_item_count     { 0 };
 
       bool writeHtmlBlock( dto::Page &page,
                            const std::string  &indent,
@@ -18,11 +18,14 @@ blogator::output::generic::EntryWriter::EntryWriter( std::shared_ptr<const dto::
                                                      std::shared_ptr<const dto::Template> entry_template ) :
     _display( cli::MsgInterface::getInstance() ),
     _options( std::move( global_options ) ),
-    _template( std::move( entry_template ) )
+    _template( std::move( entry_template ) ),
+    _renderer( *_template, helper::TemplateRenderer::Layout::ENTRY ),
+    _cache( std::make_shared<FragmentCache>() )
 {}
 
 /**
  * Write an entry for an Article to a page
+ * (uses the article's custom entry template when it has one)
  * @param page    Output Page DTO
  * @param indent  Space to place before the output lines (i.e.: html indent)
  * @param article Article DTO
@@ -31,94 +34,81 @@ void blogator::output::generic::EntryWriter::write( blogator::dto::Page &page,
                                                     const std::string   &indent,
                                                     const dto::Article  &article ) const
 {
-    dto::Template::WritePosIterators insert_points = { _template->block_write_pos.cbegin(), _template->path_write_pos.cbegin() };
-    dto::Line                        line          = { _template->html->_lines.cbegin(), 0 };
+    const auto &fragment = getFragment( page._abs_path, indent, article );
 
-    while( line._it != _template->html->_lines.cend() ) {
-        writeTemplateLine( page, indent + "\t", line, article, insert_points );
-        ++line;
-    }
-}
-
-/**
- * Gets the Template's type used for makign the entries
- * @return Template::Type
- */
-blogator::dto::Template::Type blogator::output::generic::EntryWriter::getTemplateType() const {
-    return _template->type;
+    page._out << fragment.html;
+    _display.flush( fragment.messages );
 }
 
 /**
- * Inserts any paths/blocks that are on a line
- * @param page       Output page DTO
- * @param line       Line DTO
- * @param article    Article DTO for the entry
- * @param insert_its Iterators to the block/path insertion points for the template
+ * Gets the rendered entry of an article for pages in a directory (renders it on first request)
+ * @param page_path Path of the page the entry is for
+ * @param indent    Space to place before the output lines (i.e.: html indent)
+ * @param article   Article DTO
+ * @return Rendered entry fragment
  */
-void blogator::output::generic::EntryWriter::writeTemplateLine( dto::Page &page,
-                                                                const std::string &indent,
-                                                                const dto::Line &line,
-                                                                const dto::Article &article,
-                                                                dto::Template::WritePosIterators &insert_its ) const
+const blogator::output::generic::EntryWriter::Fragment &
+    blogator::output::generic::EntryWriter::getFragment( const std::filesystem::path &page_path,
+                                                         const std::string &indent,
+                                                         const dto::Article &article ) const
 {
-    auto hasBlock = [&]() { return ( insert_its.block != _template->block_write_pos.cend() && insert_its.block->first.line == line._num ); };
-    auto hasPath  = [&]() { return ( insert_its.path  != _template->path_write_pos.cend()  && insert_its.path->first.line  == line._num ); };
+    auto key = FragmentKey( { &article, page_path.parent_path(), indent } );
 
-    std::string::size_type col = 0;
-    const auto sub_indent   = html::reader::getIndent( *line._it );
-    const auto total_indent = indent + sub_indent;
-    bool  carriage_return   = true;
+    {
+        std::lock_guard<std::mutex> lock( _cache->mutex );
+        auto it = _cache->fragments.find( key );
 
-    //EARLY RETURN: when there's nothing to add/edit on the line
-    if( !hasBlock() && !hasPath() ) {
-        page._out << indent << *line._it << "\n";
-        return;
+        if( it != _cache->fragments.end() )
+            return it->second;
     }
 
-    while( hasBlock() && hasPath() ) {
-        if( insert_its.block->first.col < insert_its.path->first.col ) { //do the block first
-            if( carriage_return )
-                page._out << indent;
-
-            page._out << line._it->substr( col, insert_its.block->first.col - col );
-
-            if( ( carriage_return = writeHtmlBlock( page, total_indent +"\t", insert_its.block->second, article ) ) )
-                page._out << total_indent;
-
-            col = insert_its.block->first.col;
-            ++insert_its.block;
-
-        } else { //do the path first
-            page._out << line._it->substr( col, insert_its.path->first.col - col )
-                      << html::encodePathToURL( fs::adaptRelPath( _template->src, page._abs_path, insert_its.path->second.string() ).string() );
+    auto  fragment     = Fragment();
+    auto  page         = dto::Page( page_path, false );
+    auto *outer_buffer = _display.setThreadBuffer( &fragment.messages );
 
-            col =  insert_its.path->first.col;
-            ++insert_its.path;
-        }
+    try {
+        render( page, indent, article );
+    } catch( ... ) {
+        _display.setThreadBuffer( outer_buffer );
+        throw;
     }
 
-    while( hasBlock() ) { //just block(s) left to insert
-        if( carriage_return )
-            page._out << indent;
-
-        page._out << line._it->substr( col, insert_its.block->first.col - col );
+    _display.setThreadBuffer( outer_buffer );
+    fragment.html = page._out.view();
 
-        if( ( carriage_return = writeHtmlBlock( page, total_indent + "\t", insert_its.block->second, article ) ) )
-            page._out << total_indent;
+    std::lock_guard<std::mutex> lock( _cache->mutex );
+    return _cache->fragments.emplace( std::move( key ), std::move( fragment ) ).first->second;
+}
 
-        col = insert_its.block->first.col;
-        ++insert_its.block;
-    }
+/**
+ * Renders an entry for an Article
+ * @param page    Output Page DTO
+ * @param indent  Space to place before the output lines (i.e.: html indent)
+ * @param article Article DTO
+ */
+void blogator::output::generic::EntryWriter::render( dto::Page &page,
+                                                     const std::string &indent,
+                                                     const dto::Article &article ) const
+{
+    auto block_writer = [&]( dto::Page &p, const std::string &block_indent, const std::string &block_class ) {
+        return writeHtmlBlock( p, block_indent, block_class, article );
+    };
 
-    while( hasPath() ) { //just path(s) left to insert
-        page._out << line._it->substr( col, insert_its.path->first.col - col )
-                  << html::encodePathToURL( fs::adaptRelPath( _template->src, page._abs_path, insert_its.path->second.string() ).string() );
+    if( article._cust_index_entry ) {
+        const auto custom_renderer = helper::TemplateRenderer( *article._cust_index_entry, helper::TemplateRenderer::Layout::ENTRY );
+        custom_renderer.write( page, block_writer, indent + "\t" );
 
-        col =  insert_its.path->first.col;
-        ++insert_its.path;
+    } else {
+        _renderer.write( page, block_writer, indent + "\t" );
     }
+}
 
-    page._out << line._it->substr( col ) << std::endl;
+/**
+ * Gets the Template's type used for makign the entries
+ * @return Template::Type
+ */
+blogator::dto::Template::Type blogator::output::generic::EntryWriter::getTemplateType() const {
+    return _template->type;
 }
 
 /**
@@ -146,7 +136,7 @@ bool blogator::output::generic::EntryWriter::writeHtmlBlock( dto::Page &page,
         page._out  << "\n";
         for( const auto & author : article._authors ) {
             page._out << indent
-                      << "<span class=\"author\">" << author << "</span>\n";
+                      << "<span class=\"author\">" << dto::Dictionary::authors().str( author ) << "</span>\n";
         }
         return true;
 
@@ -154,7 +144,7 @@ bool blogator::output::generic::EntryWriter::writeHtmlBlock( dto::Page &page,
         page._out << "\n";
         for( const auto & tag : article._tags ) {
             page._out << indent
-                      << "<span class=\"tag\">" << tag << "</span>\n";
+                      << "<span class=\"tag\">" << dto::Dictionary::tags().str( tag ) << "</span>\n";
         }
         return true;
 
@@ -211,7 +201,7 @@ void blogator::output::generic::EntryWriter::writeSummaryLine( dto::Page
 
     while( hasPath() ) {
         page._out << line._it->substr( col, path_it->first.col - col )
-                  << html::encodePathToURL( fs::adaptRelPath( article._paths.src_html, page._abs_path, path_it->second.string() ).string() );
+                  << fs::adaptRelPathURL( article._paths.src_html, page._abs_path, path_it->second );
         col =  path_it->first.col;
         ++path_it;
     }
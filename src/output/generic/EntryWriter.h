@@ -1,14 +1,27 @@
 #ifndef BLOGATOR_OUTPUT_GENERIC_ENTRYWRITER_H
 #define BLOGATOR_OUTPUT_GENERIC_ENTRYWRITER_H
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 #include "../../dto/Templates.h"
 #include "../../dto/Options.h"
 #include "../../dto/Article.h"
 #include "../../dto/Page.h"
 #include "../../dto/Line.h"
 #include "../../cli/MsgInterface.h"
+#include "../helper/TemplateRenderer.h"
 
 namespace blogator::output::generic {
+    /**
+     * Index entry writer
+     *
+     * Each article's entry (its custom entry template or the default one) is rendered once per
+     * output directory and indent and the fragment is kept so that the other pages in the same
+     * directory listing the article just get the ready-made bytes copied in. Copies of the
+     * writer share the same fragment cache.
+     */
     class EntryWriter {
       public:
         EntryWriter( std::shared_ptr<const dto::Options> global_options,
@@ -19,15 +32,37 @@ namespace blogator::output::generic {
         dto::Template::Type getTemplateType() const;
 
       private:
+        struct FragmentKey {
+            const dto::Article    *article;
+            std::filesystem::path out_dir;
+            std::string           indent;
+
+            bool operator <( const FragmentKey &rhs ) const {
+                return std::tie( article, out_dir, indent ) < std::tie( rhs.article, rhs.out_dir, rhs.indent );
+            }
+        };
+
+        struct Fragment {
+            std::string                    html;     //rendered entry
+            cli::MsgInterface::MsgBuffer_t messages; //messages sent whilst rendering
+        };
+
+        struct FragmentCache {
+            std::mutex                      mutex;
+            std::map<FragmentKey, Fragment> fragments;
+        };
+
         cli::MsgInterface                    &_display;
         std::shared_ptr<const dto::Options>  _options;
         std::shared_ptr<const dto::Template> _template;
+        helper::TemplateRenderer             _renderer;
+        std::shared_ptr<FragmentCache>       _cache;
+
+        [[nodiscard]] const Fragment & getFragment( const std::filesystem::path &page_path,
+                                                    const std::string &indent,
+                                                    const dto::Article &article ) const;
 
-        void writeTemplateLine( dto::Page            &page,
-                                const std::string    &indent,
-                                const dto::Line      &line,
-                                const dto::Article   &article,
-                                dto::Template::WritePosIterators &insert_its ) const;
+        void render( dto::Page &page, const std::string &indent, const dto::Article &article ) const;
 
         bool writeHtmlBlock( dto::Page &page,
                              const std::string &indent,
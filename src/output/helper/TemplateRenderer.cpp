@@ -0,0 +1,183 @@
+#include "TemplateRenderer.h"
+
+#include <algorithm>
+
+#include "../../fs/fs.h"
+#include "../../html/html.h"
+
+/**
+ * Constructor
+ * @param source Template to render (its render plan is compiled here if not already done)
+ * @param layout Indentation layout of the inserted html blocks
+ */
+blogator::output::helper::TemplateRenderer::TemplateRenderer( const dto::Template &source, Layout layout ) :
+    _plan( source.plan ? source.plan : std::make_shared<const dto::RenderPlan>( source ) ),
+    _layout( layout )
+{}
+
+/**
+ * Writes the whole template to a page
+ * @param page         Output page DTO
+ * @param block_writer Callback for writing the html blocks
+ * @param outer_indent Space to place before each of the template's lines (ENTRY layout)
+ */
+void blogator::output::helper::TemplateRenderer::write( dto::Page &page,
+                                                        const BlockWriter_t &block_writer,
+                                                        const std::string &outer_indent ) const
+{
+    for( const auto &line : _plan->lines )
+        writeLine( page, line, block_writer, outer_indent );
+}
+
+/**
+ * Writes a range of the template's lines to a page
+ * @param page         Output page DTO
+ * @param from_line    First line to write
+ * @param to_line      Line after the last line to write
+ * @param block_writer Callback for writing the html blocks
+ * @param outer_indent Space to place before each of the template's lines (ENTRY layout)
+ */
+void blogator::output::helper::TemplateRenderer::write( dto::Page &page,
+                                                        size_t from_line,
+                                                        size_t to_line,
+                                                        const BlockWriter_t &block_writer,
+                                                        const std::string &outer_indent ) const
+{
+    to_line = std::min( to_line, _plan->lines.size() );
+
+    for( auto i = from_line; i < to_line; ++i )
+        writeLine( page, _plan->lines[ i ], block_writer, outer_indent );
+}
+
+/**
+ * Gets the number of lines in the template
+ * @return Line count
+ */
+size_t blogator::output::helper::TemplateRenderer::lineCount() const {
+    return _plan->lines.size();
+}
+
+/**
+ * Gets the indents that are given to a html block's writer
+ * @param block_class  Block's class name
+ * @param outer_indent Space placed before each of the template's lines (ENTRY layout)
+ * @return Distinct indents of the block's insertion points (in order of appearance)
+ */
+std::vector<std::string> blogator::output::helper::TemplateRenderer::blockIndents( const std::string &block_class,
+                                                                                   const std::string &outer_indent ) const
+{
+    auto indents = std::vector<std::string>();
+
+    for( const auto &line : _plan->lines ) {
+        for( auto i = line.begin; i < line.end; ++i ) {
+            const auto &segment = _plan->segments[ i ];
+
+            if( segment.slot != dto::RenderPlan::SlotType::BLOCK || _plan->blocks[ segment.slot_i ] != block_class )
+                continue;
+
+            auto indent = std::string();
+
+            switch( _layout ) {
+                case Layout::PAGE:
+                    indent = line.block_indent;
+                    break;
+                case Layout::LIST:
+                    indent = line.indent;
+                    break;
+                case Layout::ENTRY:
+                    indent = outer_indent + line.block_indent;
+                    break;
+            }
+
+            if( std::find( indents.cbegin(), indents.cend(), indent ) == indents.cend() )
+                indents.emplace_back( std::move( indent ) );
+        }
+    }
+
+    return indents;
+}
+
+/**
+ * Writes a template line with its paths/blocks inserted
+ * @param page         Output page DTO
+ * @param line         Line of the render plan
+ * @param block_writer Callback for writing the html blocks
+ * @param outer_indent Space to place before the line (ENTRY layout)
+ */
+void blogator::output::helper::TemplateRenderer::writeLine( dto::Page &page,
+                                                            const dto::RenderPlan::Line &line,
+                                                            const BlockWriter_t &block_writer,
+                                                            const std::string &outer_indent ) const
+{
+    //EARLY RETURN: when there's nothing to add/edit on the line
+    if( !line.hasSlots() ) {
+        if( _layout == Layout::ENTRY )
+            page._out << outer_indent;
+
+        page._out << _plan->literal( _plan->segments[ line.begin ] ) << "\n";
+        return;
+    }
+
+    bool carriage_return = ( _layout == Layout::ENTRY );
+
+    for( auto i = line.begin; i < line.end; ++i ) {
+        const auto &segment = _plan->segments[ i ];
+
+        switch( segment.slot ) {
+            case dto::RenderPlan::SlotType::NONE:
+                page._out << _plan->literal( segment ) << "\n";
+                break;
+
+            case dto::RenderPlan::SlotType::PATH:
+                page._out << _plan->literal( segment );
+                writePath( page, segment );
+                break;
+
+            case dto::RenderPlan::SlotType::BLOCK: {
+                const auto &block_class = _plan->blocks[ segment.slot_i ];
+
+                switch( _layout ) {
+                    case Layout::PAGE:
+                        page._out << _plan->literal( segment ) << "\n";
+                        block_writer( page, line.block_indent, block_class );
+                        page._out << line.indent;
+                        break;
+
+                    case Layout::LIST:
+                        if( carriage_return )
+                            page._out << line.indent;
+
+                        page._out << _plan->literal( segment );
+
+                        if( ( carriage_return = block_writer( page, line.indent, block_class ) ) )
+                            page._out << line.indent;
+                        break;
+
+                    case Layout::ENTRY:
+                        if( carriage_return )
+                            page._out << outer_indent;
+
+                        page._out << _plan->literal( segment );
+
+                        if( ( carriage_return = block_writer( page, outer_indent + line.block_indent, block_class ) ) )
+                            page._out << outer_indent << line.indent;
+                        break;
+                }
+
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Writes a relative path adapted to the page's location
+ * @param page    Output page DTO
+ * @param segment Path segment of the render plan
+ */
+void blogator::output::helper::TemplateRenderer::writePath( dto::Page &page,
+                                                            const dto::RenderPlan::Segment &segment ) const
+{
+    const auto &path = _plan->paths[ segment.slot_i ];
+    page._out << fs::adaptRelPathURL( _plan->src, page._abs_path, path );
+}
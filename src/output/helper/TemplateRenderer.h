@@ -0,0 +1,55 @@
+#ifndef BLOGATOR_OUTPUT_HELPER_TEMPLATERENDERER_H
+#define BLOGATOR_OUTPUT_HELPER_TEMPLATERENDERER_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../dto/Template.h"
+#include "../../dto/RenderPlan.h"
+#include "../../dto/Page.h"
+
+namespace blogator::output::helper {
+    /**
+     * Interpreter for the render plans of the templates (shared by all the page writers)
+     */
+    class TemplateRenderer {
+      public:
+        /**
+         * Indentation layout of the html blocks inserted
+         * - PAGE : block is put on a new line, indented one level deeper than its line (landing/post pages)
+         * - LIST : block decides if it goes on a new line, indented at the same level as its line (index/list pages)
+         * - ENTRY: like LIST but nested in an outer indentation and one level deeper (index entries)
+         */
+        enum class Layout {
+            PAGE, LIST, ENTRY
+        };
+
+        /**
+         * Block writer callback
+         * @param page        Output page DTO
+         * @param indent      Space to place before the block's output lines
+         * @param block_class Block's class name
+         * @return Line carriage return required after the block
+         */
+        typedef std::function<bool( dto::Page &page, const std::string &indent, const std::string &block_class )> BlockWriter_t;
+
+        TemplateRenderer( const dto::Template &source, Layout layout );
+
+        void write( dto::Page &page, const BlockWriter_t &block_writer, const std::string &outer_indent = "" ) const;
+        void write( dto::Page &page, size_t from_line, size_t to_line, const BlockWriter_t &block_writer, const std::string &outer_indent = "" ) const;
+
+        [[nodiscard]] size_t lineCount() const;
+        [[nodiscard]] std::vector<std::string> blockIndents( const std::string &block_class, const std::string &outer_indent = "" ) const;
+
+      private:
+        std::shared_ptr<const dto::RenderPlan> _plan;
+        Layout                                 _layout;
+
+        void writeLine( dto::Page &page, const dto::RenderPlan::Line &line, const BlockWriter_t &block_writer, const std::string &outer_indent ) const;
+        void writePath( dto::Page &page, const dto::RenderPlan::Segment &segment ) const;
+    };
+}
+
+#endif //BLOGATOR_OUTPUT_HELPER_TEMPLATERENDERER_H
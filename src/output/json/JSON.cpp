@@ -1,6 +1,7 @@
 #include "JSON.h"
 
 #include <fstream>
+#include "../../dto/Page.h"
 #include "../../exception/file_access_failure.h"
 #include "../../fs/fs.h"
 
@@ -34,11 +35,14 @@ std::string blogator::output::json::escapeStr( const std::string &str ) {
  * Constructor
  * @param master_index   Master index
  * @param global_options Global blogator options
+ * @param build_graph    Build graph
  */
 blogator::output::json::JSON::JSON( std::shared_ptr<const dto::Index> master_index,
-                                    std::shared_ptr<const dto::Options> global_options ) :
+                                    std::shared_ptr<const dto::Options> global_options,
+                                    std::shared_ptr<BuildGraph> build_graph ) :
     _master_index( std::move( master_index ) ),
     _options( std::move( global_options ) ),
+    _build_graph( std::move( build_graph ) ),
     _json_item_processed( 0 ),
     _json_item_count( 0 ),
     _display( cli::MsgInterface::getInstance() )
@@ -59,14 +63,24 @@ bool blogator::output::json::JSON::init() {
         return true;
 
     try {
-        auto path = _options->_paths.index_dir / _options->_json_index.file_name;
-
-        if( std::filesystem::exists( path ) )
+        auto path   = _options->_paths.index_dir / _options->_json_index.file_name;
+        auto inputs = BuildGraph::Inputs_t( { BuildGraph::CFG_INDEX,
+                                              BuildGraph::CFG_JSON,
+                                              BuildGraph::ARTICLES,
+                                              BuildGraph::CAT_YEARS,
+                                              BuildGraph::CAT_TAGS,
+                                              BuildGraph::CAT_AUTHORS } );
+
+        if( _options->purgesOutput() && std::filesystem::exists( path ) )
             throw exception::file_access_failure(
                 "Old JSON index file was not purged: " + path.string()
             );
 
-        std::ofstream out( path );
+        if( !_build_graph->update( path, std::move( inputs ) ) )
+            return true; //unchanged since the last run
+
+        auto  page = dto::Page( path );
+        auto &out  = page._out;
 
         if( !out.is_open() )
             throw exception::file_access_failure(
@@ -123,7 +137,7 @@ bool blogator::output::json::JSON::init() {
  * Write out the article index section to file
  * @param file JSON file output
  */
-void blogator::output::json::JSON::writeArticles( std::ofstream &file ) {
+void blogator::output::json::JSON::writeArticles( std::ostream &file ) {
     //"articles" = [ { "title": "", "authors": [ "" ], "tags": [ "" ], "headings": [ "" ], "href": "" } ]
 
     file << R"("articles": [ )";
@@ -139,18 +153,18 @@ void blogator::output::json::JSON::writeArticles( std::ofstream &file ) {
 
         for( auto it = article_it->_authors.cbegin(); it != article_it->_authors.cend(); ++it ) {
             if( it != std::prev( article_it->_authors.cend() ) )
-                file << "\"" << json::escapeStr( *it ) << "\", ";
+                file << "\"" << json::escapeStr( _master_index->_indices.byAuthor.name( *it ) ) << "\", ";
             else
-                file << "\"" << json::escapeStr( *it ) << "\" ], ";
+                file << "\"" << json::escapeStr( _master_index->_indices.byAuthor.name( *it ) ) << "\" ], ";
         }
 
         file << R"("tags": [ )";
 
         for( auto it = article_it->_tags.cbegin(); it != article_it->_tags.cend(); ++it ) {
             if( it != std::prev( article_it->_tags.cend() ) )
-                file << "\"" << json::escapeStr( *it ) << "\", ";
+                file << "\"" << json::escapeStr( _master_index->_indices.byTag.name( *it ) ) << "\", ";
             else
-                file << "\"" << json::escapeStr( *it ) << "\" ], ";
+                file << "\"" << json::escapeStr( _master_index->_indices.byTag.name( *it ) ) << "\" ], ";
         }
 
         file << R"("headings": [ )";
@@ -181,7 +195,7 @@ void blogator::output::json::JSON::writeArticles( std::ofstream &file ) {
  * Write out the tag index section to file
  * @param file JSON file output
  */
-void blogator::output::json::JSON::writeTags( std::ofstream &file ) {
+void blogator::output::json::JSON::writeTags( std::ostream &file ) {
     //"tags": [ { name: "", href: "" } ]
 
     file << R"("tags": [ )";
@@ -191,7 +205,7 @@ void blogator::output::json::JSON::writeTags( std::ofstream &file ) {
         _display.progress( "Tags" );
 
         file << R"({ "name": ")"
-             << json::escapeStr( tag_it->first )
+             << json::escapeStr( _master_index->_indices.byTag.name( tag_it->first ) )
              << R"(", "href": ")"
              << json::escapeStr( _options->_folders.index.by_tag / tag_it->second.file_names.front() )
              << R"(" })";
@@ -209,7 +223,7 @@ void blogator::output::json::JSON::writeTags( std::ofstream &file ) {
  * Write out the author index section to file
  * @param file JSON file output
  */
-void blogator::output::json::JSON::writeAuthors( std::ofstream &file ) {
+void blogator::output::json::JSON::writeAuthors( std::ostream &file ) {
     //"authors": [ { "name": "", "href": "" } ]
 
     file << R"("authors": [ )";
@@ -219,7 +233,7 @@ void blogator::output::json::JSON::writeAuthors( std::ofstream &file ) {
         _display.progress( "Authors" );
 
         file << R"({ "name": ")"
-             << json::escapeStr( author_it->first )
+             << json::escapeStr( _master_index->_indices.byAuthor.name( author_it->first ) )
              << R"(", "href": )"
              << json::escapeStr( _options->_folders.index.by_author / author_it->second.file_names.front() )
              << R"(" })";
@@ -237,7 +251,7 @@ void blogator::output::json::JSON::writeAuthors( std::ofstream &file ) {
  * Write out the year index section to file
  * @param file JSON file output
  */
-void blogator::output::json::JSON::writeYears( std::ofstream &file ) {
+void blogator::output::json::JSON::writeYears( std::ostream &file ) {
     //"years": [ { "year": "", "href": "" } ]
 
     file << R"("years": [ )";
@@ -247,7 +261,7 @@ void blogator::output::json::JSON::writeYears( std::ofstream &file ) {
         _display.progress( "Years" );
 
         file << R"({ "year": ")"
-             << json::escapeStr( year_it->first )
+             << json::escapeStr( _master_index->_indices.byYear.name( year_it->first ) )
              << R"(", "href": ")"
              << json::escapeStr( _options->_folders.index.by_year / year_it->second.file_names.front() )
              << R"(" })";
@@ -268,7 +282,7 @@ void blogator::output::json::JSON::writeYears( std::ofstream &file ) {
  * @param file     Output JSON
  * @throws exception::file_access_failure when source JSON file could not be opened
  */
-void blogator::output::json::JSON::appendJSON( const std::filesystem::path &src_path, std::ofstream &file ) {
+void blogator::output::json::JSON::appendJSON( const std::filesystem::path &src_path, std::ostream &file ) {
     std::ifstream     src( src_path.string() );
     std::stringstream ss;
 
@@ -6,6 +6,7 @@
 #include "../../cli/MsgInterface.h"
 #include "../../dto/Index.h"
 #include "../../dto/Options.h"
+#include "../BuildGraph.h"
 
 namespace blogator::output::json {
 
@@ -14,22 +15,24 @@ namespace blogator::output::json {
     class JSON {
       public:
         JSON( std::shared_ptr<const dto::Index>   master_index,
-              std::shared_ptr<const dto::Options> global_options );
+              std::shared_ptr<const dto::Options> global_options,
+              std::shared_ptr<BuildGraph>         build_graph );
 
         bool init();
 
       private:
         std::shared_ptr<const dto::Index>    _master_index;
         std::shared_ptr<const dto::Options>  _options;
+        std::shared_ptr<BuildGraph>          _build_graph;
         size_t                               _json_item_processed;
         size_t                               _json_item_count;
         cli::MsgInterface                   &_display;
 
-        void writeArticles( std::ofstream &file );
-        void writeTags( std::ofstream &file );
-        void writeAuthors( std::ofstream &file );
-        void writeYears( std::ofstream &file );
-        void appendJSON( const std::filesystem::path &src_path, std::ofstream &file );
+        void writeArticles( std::ostream &file );
+        void writeTags( std::ostream &file );
+        void writeAuthors( std::ostream &file );
+        void writeYears( std::ostream &file );
+        void appendJSON( const std::filesystem::path &src_path, std::ostream &file );
     };
 }
 
@@ -1,31 +1,99 @@
 #include "output.h"
 #include "../exception/failed_expectation.h"
+#include "../concurrency/TaskGraph.h"
+#include "../fs/fs.h"
+#include "../fs/OutputQueue.h"
+#include "../cli/MsgInterface.h"
 
 /**
  * Initialize HTML page generation
- * @param index     Master index
- * @param templates Templates
- * @param options   Global blogator options
- * @throws exception::failed_expectation when a maker cannot generate its targets
+ * (on an incremental run only the outputs whose inputs changed are rendered and, as in write-if-changed
+ * mode, the stale ones are removed; a staged run is published once everything is written)
+ * @param index       Master index
+ * @param templates   Templates
+ * @param options     Global blogator options
+ * @param build_graph Build graph (saved once all the outputs are generated)
+ * @throws exception::failed_expectation when a maker cannot generate its targets or queued files cannot be written
  */
 void blogator::output::generate( const std::shared_ptr<const dto::Index>     &index,
                                  const std::shared_ptr<const dto::Templates> &templates,
-                                 const std::shared_ptr<const dto::Options>   &options )
+                                 const std::shared_ptr<const dto::Options>   &options,
+                                 const std::shared_ptr<BuildGraph>           &build_graph )
 {
-    auto post_maker    = output::page::Posts( index, templates, options );
-    auto index_maker   = output::page::Indices( index, templates, options );
-    auto landing_maker = output::page::Landing( index, templates, options );
-    auto rss           = output::feed::RSS( index, templates, options );
-    auto json_index    = output::json::JSON( index, options );
-
-    if( !post_maker.init() )
-        throw exception::failed_expectation( "Failed creating the post targets." );
-    if( !index_maker.init() )
-        throw exception::failed_expectation( "Failed creating the indices targets." );
-    if( !landing_maker.init() )
-        throw exception::failed_expectation( "Failed creating the landing page target." );
-    if( !rss.init() )
-        throw exception::failed_expectation( "Failed creating the RSS feed target." );
-    if( !json_index.init() )
-        throw exception::failed_expectation( "Failed creating the JSON index target." );
-}
\ No newline at end of file
+    build_graph->fingerprintInputs( *index, *templates );
+
+    auto post_maker    = output::page::Posts( index, templates, options, build_graph );
+    auto index_maker   = output::page::Indices( index, templates, options, build_graph );
+    auto landing_maker = output::page::Landing( index, templates, options, build_graph );
+    auto rss           = output::feed::RSS( index, templates, options, build_graph );
+    auto json_index    = output::json::JSON( index, options, build_graph );
+    auto makers        = concurrency::TaskGraph(); //makers are independent of each other
+
+    makers.add( [&]() {
+        if( !post_maker.init() )
+            throw exception::failed_expectation( "Failed creating the post targets." );
+    } );
+    makers.add( [&]() {
+        if( !index_maker.init() )
+            throw exception::failed_expectation( "Failed creating the indices targets." );
+    } );
+    makers.add( [&]() {
+        if( !landing_maker.init() )
+            throw exception::failed_expectation( "Failed creating the landing page target." );
+    } );
+    makers.add( [&]() {
+        if( !rss.init() )
+            throw exception::failed_expectation( "Failed creating the RSS feed target." );
+    } );
+    makers.add( [&]() {
+        if( !json_index.init() )
+            throw exception::failed_expectation( "Failed creating the JSON index target." );
+    } );
+
+    try {
+        makers.run( options->_concurrency.jobs, "Generating output" );
+    } catch( ... ) {
+        fs::OutputQueue::getInstance().flush();
+        build_graph->discard();
+        throw;
+    }
+
+    if( fs::OutputQueue::getInstance().flush() > 0 ) {
+        build_graph->discard();
+        throw exception::failed_expectation( "Failed writing the queued output files." );
+    }
+
+    if( options->_output.staged ) {
+        try {
+            fs::publishStagedOutput( *options );
+        } catch( ... ) {
+            build_graph->discard();
+            throw;
+        }
+
+        cli::MsgInterface::getInstance().msg(
+            "Staged output published: " + std::to_string( fs::OutputQueue::getInstance().linkedCount() ) +
+            " file(s) hard-linked from the previous generation."
+        );
+    }
+
+    if( build_graph->incremental() ) {
+        const auto removed = ( options->_output.staged ? 0 : build_graph->removeStaleOutputs() ); //staged: left out of the published tree
+
+        cli::MsgInterface::getInstance().msg(
+            "Incremental build: " + std::to_string( build_graph->renderCount() ) + "/" +
+            std::to_string( build_graph->outputCount() ) + " file(s) rendered, " +
+            std::to_string( removed ) + " stale file(s) removed."
+        );
+
+    } else if( options->_output.write_if_changed && !options->_output.staged ) {
+        const auto removed = fs::removeStaleOutputs( *options );
+
+        cli::MsgInterface::getInstance().msg(
+            "Write if changed: " + std::to_string( fs::OutputQueue::getInstance().unchangedCount() ) +
+            " file(s) unchanged, " + std::to_string( removed ) + " stale file(s)/folder(s) removed."
+        );
+    }
+
+    build_graph->save();
+}
@@ -1,6 +1,7 @@
 #ifndef BLOGATOR_OUTPUT_H
 #define BLOGATOR_OUTPUT_H
 
+#include "BuildGraph.h"
 #include "page/Posts.h"
 #include "page/Indices.h"
 #include "page/Landing.h"
@@ -10,7 +11,8 @@
 namespace blogator::output {
     void generate( const std::shared_ptr<const dto::Index>     &index,
                    const std::shared_ptr<const dto::Templates> &templates,
-                   const std::shared_ptr<const dto::Options>   &options );
+                   const std::shared_ptr<const dto::Options>   &options,
+                   const std::shared_ptr<BuildGraph>           &build_graph );
 }
 
 #endif //BLOGATOR_OUTPUT_H
\ No newline at end of file
@@ -32,11 +32,11 @@ void blogator::output::page::ByTagList::writeFlatList( dto::Page         &page,
 
         while( tag_it != _index->_indices.byTag.cats.cend() ) {
             page._out << indent << "\t<li>"
-                      << html::createHyperlink( tag_it->second.file_names.front(), tag_it->first ) << "</li>\n";
+                      << html::createHyperlink( tag_it->second.file_names.front(), _index->_indices.byTag.name( tag_it->first ) ) << "</li>\n";
             ++tag_it;
         }
 
-        page._out << indent << "</ul>" << std::endl;
+        page._out << indent << "</ul>\n";
     }
 }
 
@@ -53,16 +53,16 @@ void blogator::output::page::ByTagList::writeHierarchyList( dto::Page         &p
         page._out << indent << "<ul>\n";
 
         while( tag_it != _index->_indices.byTag.cats.cend() ) {
-            const char sublist_letter = std::tolower( tag_it->first.at( 0 ) );
+            const char sublist_letter = std::tolower( _index->_indices.byTag.name( tag_it->first ).at( 0 ) );
 
             page._out << indent << "\t<li><h3>" << char( std::toupper( sublist_letter ) ) << "</h3>\n"
                       << indent << "\t\t<ul>\n";
 
             while( tag_it != _index->_indices.byTag.cats.cend() &&
-                   char( std::tolower( sublist_letter ) ) == std::tolower( tag_it->first.at( 0 )  ) )
+                   char( std::tolower( sublist_letter ) ) == std::tolower( _index->_indices.byTag.name( tag_it->first ).at( 0 )  ) )
             {
                 page._out << indent << "\t\t\t<li>"
-                          << html::createHyperlink( tag_it->second.file_names.front(), tag_it->first ) << "</li>\n";
+                          << html::createHyperlink( tag_it->second.file_names.front(), _index->_indices.byTag.name( tag_it->first ) ) << "</li>\n";
                 ++tag_it;
             }
 
@@ -70,6 +70,6 @@ void blogator::output::page::ByTagList::writeHierarchyList( dto::Page         &p
                       << indent << "\t</li>\n";
         }
 
-        page._out << indent << "</ul>" << std::endl;
+        page._out << indent << "</ul>\n";
     }
 }
\ No newline at end of file
@@ -37,11 +37,11 @@ void blogator::output::page::ByYearList::writeFlatList( dto::Page &page,
 
         while( year_it != _index->_indices.byYear.cats.crend() ) {
             page._out << indent << "\t<li>"
-                      << html::createHyperlink( year_it->second.file_names.front(), year_it->first ) << "</li>\n";
+                      << html::createHyperlink( year_it->second.file_names.front(), _index->_indices.byYear.name( year_it->first ) ) << "</li>\n";
             ++year_it;
         }
 
-        page._out << indent << "</ul>" << std::endl;
+        page._out << indent << "</ul>\n";
     }
 }
 
@@ -58,10 +58,10 @@ void blogator::output::page::ByYearList::writeHierarchyList( dto::Page &page,
         page._out << indent << "<ul>\n";
 
         while( year_it != _index->_indices.byYear.cats.crend() ) {
-            const std::string current = year_it->first;
+            const std::string current = _index->_indices.byYear.name( year_it->first );
 
             page._out << indent << "\t<li>"
-                      << html::createHyperlink(  year_it->second.file_names.front(), "<h3>" + year_it->first + "</h3>" ) << "\n"
+                      << html::createHyperlink(  year_it->second.file_names.front(), "<h3>" + _index->_indices.byYear.name( year_it->first ) + "</h3>" ) << "\n"
                       << indent << "\t\t<ul>\n";
 
             for( size_t i : year_it->second.article_indices ) {
@@ -89,6 +89,6 @@ void blogator::output::page::ByYearList::writeHierarchyList( dto::Page &page,
             ++year_it;
         }
 
-        page._out << indent << "</ul>" << std::endl;
+        page._out << indent << "</ul>\n";
     }
 }
\ No newline at end of file
@@ -16,21 +16,24 @@
 #include "../../exception/file_access_failure.h"
 #include "../../exception/failed_expectation.h"
 #include "../../cli/MsgInterface.h"
+#include "../../concurrency/TaskGraph.h"
 
 /**
  * Constructor
  * @param master_index   Master index
  * @param templates      Templates
  * @param global_options Global blogator options
+ * @param build_graph    Build graph
  */
 blogator::output::page::Indices::Indices( std::shared_ptr<const dto::Index>     master_index,
                                           std::shared_ptr<const dto::Templates> templates,
-                                          std::shared_ptr<const dto::Options>   global_options ) :
+                                          std::shared_ptr<const dto::Options>   global_options,
+                                          std::shared_ptr<BuildGraph>           build_graph ) :
     Page( std::move( master_index ),
           std::move( templates ),
-          std::move( global_options )
-    ),
-    _entry_maker( generic::EntryWriter( _options, _templates->_index_entry ) )
+          std::move( global_options ),
+          std::move( build_graph )
+    )
 {
     _breadcrumb_parents = BreadCrumb_t( { { _options->_breadcrumb.start, "../../index.html" } } );
 
@@ -47,95 +50,167 @@ blogator::output::page::Indices::Indices( std::shared_ptr<const dto::Index>
  */
 bool blogator::output::page::Indices::init() const {
     try {
-        if( _templates->_index->block_write_pos.empty() || _templates->_index_entry->block_write_pos.empty() ) {
-            throw exception::failed_expectation(
-                "Missing insertion points in one or more index templates "
-                "(Found: index page=" + std::to_string( _templates->_index->block_write_pos.size() ) +
-                ", index entry=" + std::to_string( _templates->_index_entry->block_write_pos.size() ) + ")."
-            );
-        }
-
-        { //Chronological index ("by_date")
-            if( _index->_indices.chronological.file_names.empty() )
+        auto listers     = concurrency::TaskGraph();
+        auto entry_maker = generic::EntryWriter( _options, _templates->_index_entry ); //copies share the fragment cache
+
+        const auto templates_check = listers.add( [&]() {
+            if( _templates->_index->block_write_pos.empty() || _templates->_index_entry->block_write_pos.empty() ) {
                 throw exception::failed_expectation(
-                    "No prepared filenames were found in the chronological index "
-                    "(" + std::to_string( _index->_indices.chronological.page_count ) + "pages "
-                    "for " + std::to_string( _index->_articles.size() ) + " articles)."
+                    "Missing insertion points in one or more index templates "
+                    "(Found: index page=" + std::to_string( _templates->_index->block_write_pos.size() ) +
+                    ", index entry=" + std::to_string( _templates->_index_entry->block_write_pos.size() ) + ")."
                 );
+            }
+        } );
 
-            const auto &first_file = *_index->_indices.chronological.file_names.cbegin();
-            _display.begin( "Generating index pages", _total_jobs, _options->_paths.index_date_dir.filename() / first_file );
-
-            auto entry_maker = generic::EntryWriter( _options, _templates->_index_entry );
-            auto index_maker = generic::ChronoIndexLister( _options, _index->_articles, *_templates->_index, entry_maker );
-
-            auto breadcrumb = BreadCrumb_t( _breadcrumb_parents.cbegin(), _breadcrumb_parents.cend() );
-            index_maker.write( _index->_indices.chronological, breadcrumb, _options->_paths.index_date_dir );
-        }
-
-        if( _options->_index.index_by_year ) { //Year list index ("by_year")
-            if( _templates->_year_list->block_write_pos.empty() )
-                throw exception::failed_expectation( "Missing insertion points in the tag list template." );
-
-            _display.progress( _options->_folders.index.by_year.filename() / _options->_filenames.year_list );
+        listers.add( [&]() { writeChronologicalIndex( entry_maker ); }, { templates_check } );
 
-            auto list_page_maker = ByYearList( _index, _options, *_templates->_year_list );
-            auto list_page_path  = std::filesystem::path( _options->_paths.index_year_dir / _options->_filenames.year_list );
-            auto entry_maker     = generic::EntryWriter( _options, _templates->_index_entry );
-            auto cat_page_maker  = generic::CategoryLister( _options, _index->_articles, *_templates->_year_index, entry_maker );
+        if( _options->_index.index_by_year )
+            listers.add( [&]() { writeYearIndex( entry_maker ); }, { templates_check } );
 
-            auto breadcrumb      = BreadCrumb_t( _breadcrumb_parents.cbegin(), _breadcrumb_parents.cend() );
-            breadcrumb.emplace_back( std::make_pair( _options->_breadcrumb.by_year, _options->_filenames.year_list ) );
-            dto::Page page       = { list_page_path, std::ofstream( list_page_path ) };
+        if( _options->_index.index_by_tag )
+            listers.add( [&]() { writeTagIndex( entry_maker ); }, { templates_check } );
 
-            list_page_maker.write( page );
-            cat_page_maker.write( _index->_indices.byYear, breadcrumb, _options->_paths.index_year_dir );
-        }
+        if( _options->_index.index_by_author )
+            listers.add( [&]() { writeAuthorIndex( entry_maker ); }, { templates_check } );
 
-        if( _options->_index.index_by_tag ) { //Tag list index ("by_tag")
-            if( _templates->_tag_list->block_write_pos.empty() )
-                throw exception::failed_expectation( "Missing insertion points in the tag list template." );
+        listers.run( _options->_concurrency.jobs, "Generating index pages" );
 
-            _display.progress( _options->_folders.index.by_tag.filename() / _options->_filenames.tag_list );
+        _display.progress( "DONE" );
 
-            auto list_page_maker = ByTagList( _index, _options, *_templates->_tag_list );
-            auto list_page_path  = std::filesystem::path( _options->_paths.index_tag_dir / _options->_filenames.tag_list );
-            auto entry_maker     = generic::EntryWriter( _options, _templates->_index_entry );
-            auto cat_page_maker  = generic::CategoryLister( _options, _index->_articles, *_templates->_tag_index, entry_maker );
+    } catch( std::exception &e ) {
+        _display.error( e.what() );
+        return false;
+    }
 
-            auto breadcrumb      = BreadCrumb_t( _breadcrumb_parents.cbegin(), _breadcrumb_parents.cend() );
-            breadcrumb.emplace_back( std::make_pair( _options->_breadcrumb.by_tag, _options->_filenames.tag_list ) );
-            dto::Page page       = { list_page_path, std::ofstream( list_page_path ) };
+    return true;
+}
 
-            list_page_maker.write( page );
-            cat_page_maker.write( _index->_indices.byTag, breadcrumb, _options->_paths.index_tag_dir );
-        }
+/**
+ * Writes the chronological index pages ("by_date")
+ * @param entry_maker Index entry writer (shared by the listers)
+ * @throws exception::failed_expectation when no file names were prepared for the index
+ */
+void blogator::output::page::Indices::writeChronologicalIndex( const generic::EntryWriter &entry_maker ) const {
+    if( _index->_indices.chronological.file_names.empty() )
+        throw exception::failed_expectation(
+            "No prepared filenames were found in the chronological index "
+            "(" + std::to_string( _index->_indices.chronological.page_count ) + "pages "
+            "for " + std::to_string( _index->_articles.size() ) + " articles)."
+        );
+
+    const auto &first_file = *_index->_indices.chronological.file_names.cbegin();
+    _display.begin( "Generating index pages", _total_jobs, _options->_paths.index_date_dir.filename() / first_file );
+
+    auto index_maker = generic::ChronoIndexLister( _options, _index->_articles, *_templates->_index, entry_maker,
+                                                   _build_graph, getListerInputs( *_templates->_index ) );
+
+    auto breadcrumb = BreadCrumb_t( _breadcrumb_parents.cbegin(), _breadcrumb_parents.cend() );
+    index_maker.write( _index->_indices.chronological, breadcrumb, _options->_paths.index_date_dir );
+}
 
-        if( _options->_index.index_by_author ) { //Author list index ("by_author")
-            if(  _templates->_author_list->block_write_pos.empty() )
-                throw exception::failed_expectation( "Missing insertion points in the author list template." );
+/**
+ * Writes the year list and year index pages ("by_year")
+ * @param entry_maker Index entry writer (shared by the listers)
+ * @throws exception::failed_expectation when insertion points are missing in the year list template
+ */
+void blogator::output::page::Indices::writeYearIndex( const generic::EntryWriter &entry_maker ) const {
+    if( _templates->_year_list->block_write_pos.empty() )
+        throw exception::failed_expectation( "Missing insertion points in the tag list template." );
+
+    _display.progress( _options->_folders.index.by_year.filename() / _options->_filenames.year_list );
+
+    auto list_page_maker = ByYearList( _index, _options, *_templates->_year_list );
+    auto list_page_path  = std::filesystem::path( _options->_paths.index_year_dir / _options->_filenames.year_list );
+    auto cat_page_maker  = generic::CategoryLister( _options, _index->_articles, *_templates->_year_index, entry_maker,
+                                                    _build_graph, getListerInputs( *_templates->_year_index ) );
+
+    auto breadcrumb      = BreadCrumb_t( _breadcrumb_parents.cbegin(), _breadcrumb_parents.cend() );
+    breadcrumb.emplace_back( std::make_pair( _options->_breadcrumb.by_year, _options->_filenames.year_list ) );
+    auto list_inputs     = BuildGraph::Inputs_t( { BuildGraph::CFG_COMMON,
+                                                   BuildGraph::CFG_INDEX,
+                                                   BuildGraph::templateKey( *_templates->_year_list ),
+                                                   BuildGraph::CAT_YEARS } );
+
+    if( _build_graph->update( list_page_path, std::move( list_inputs ) ) ) {
+        auto page = dto::Page( list_page_path );
+        list_page_maker.write( page );
+    }
 
-            _display.progress( _options->_folders.index.by_author.filename() / _options->_filenames.author_list );
+    cat_page_maker.write( _index->_indices.byYear, breadcrumb, _options->_paths.index_year_dir );
+}
 
-            auto list_page_maker = ByAuthorList( _index, _options, *_templates->_author_list );
-            auto list_page_path  = std::filesystem::path( _options->_paths.index_author_dir / _options->_filenames.author_list );
-            auto entry_maker     = generic::EntryWriter( _options, _templates->_index_entry );
-            auto cat_page_maker  = generic::CategoryLister( _options, _index->_articles, *_templates->_author_index, entry_maker );
+/**
+ * Writes the tag list and tag index pages ("by_tag")
+ * @param entry_maker Index entry writer (shared by the listers)
+ * @throws exception::failed_expectation when insertion points are missing in the tag list template
+ */
+void blogator::output::page::Indices::writeTagIndex( const generic::EntryWriter &entry_maker ) const {
+    if( _templates->_tag_list->block_write_pos.empty() )
+        throw exception::failed_expectation( "Missing insertion points in the tag list template." );
+
+    _display.progress( _options->_folders.index.by_tag.filename() / _options->_filenames.tag_list );
+
+    auto list_page_maker = ByTagList( _index, _options, *_templates->_tag_list );
+    auto list_page_path  = std::filesystem::path( _options->_paths.index_tag_dir / _options->_filenames.tag_list );
+    auto cat_page_maker  = generic::CategoryLister( _options, _index->_articles, *_templates->_tag_index, entry_maker,
+                                                    _build_graph, getListerInputs( *_templates->_tag_index ) );
+
+    auto breadcrumb      = BreadCrumb_t( _breadcrumb_parents.cbegin(), _breadcrumb_parents.cend() );
+    breadcrumb.emplace_back( std::make_pair( _options->_breadcrumb.by_tag, _options->_filenames.tag_list ) );
+    auto list_inputs     = BuildGraph::Inputs_t( { BuildGraph::CFG_COMMON,
+                                                   BuildGraph::CFG_INDEX,
+                                                   BuildGraph::templateKey( *_templates->_tag_list ),
+                                                   BuildGraph::CAT_TAGS } );
+
+    if( _build_graph->update( list_page_path, std::move( list_inputs ) ) ) {
+        auto page = dto::Page( list_page_path );
+        list_page_maker.write( page );
+    }
 
-            auto breadcrumb      = BreadCrumb_t( _breadcrumb_parents.cbegin(), _breadcrumb_parents.cend() );
-            breadcrumb.emplace_back( std::make_pair( _options->_breadcrumb.by_author, _options->_filenames.author_list ) );
-            dto::Page page       = { list_page_path, std::ofstream( list_page_path ) };
+    cat_page_maker.write( _index->_indices.byTag, breadcrumb, _options->_paths.index_tag_dir );
+}
 
-            list_page_maker.write( page );
-            cat_page_maker.write( _index->_indices.byAuthor, breadcrumb, _options->_paths.index_author_dir );
-        }
+/**
+ * Writes the author list and author index pages ("by_author")
+ * @param entry_maker Index entry writer (shared by the listers)
+ * @throws exception::failed_expectation when insertion points are missing in the author list template
+ */
+void blogator::output::page::Indices::writeAuthorIndex( const generic::EntryWriter &entry_maker ) const {
+    if(  _templates->_author_list->block_write_pos.empty() )
+        throw exception::failed_expectation( "Missing insertion points in the author list template." );
+
+    _display.progress( _options->_folders.index.by_author.filename() / _options->_filenames.author_list );
+
+    auto list_page_maker = ByAuthorList( _index, _options, *_templates->_author_list );
+    auto list_page_path  = std::filesystem::path( _options->_paths.index_author_dir / _options->_filenames.author_list );
+    auto cat_page_maker  = generic::CategoryLister( _options, _index->_articles, *_templates->_author_index, entry_maker,
+                                                    _build_graph, getListerInputs( *_templates->_author_index ) );
+
+    auto breadcrumb      = BreadCrumb_t( _breadcrumb_parents.cbegin(), _breadcrumb_parents.cend() );
+    breadcrumb.emplace_back( std::make_pair( _options->_breadcrumb.by_author, _options->_filenames.author_list ) );
+    auto list_inputs     = BuildGraph::Inputs_t( { BuildGraph::CFG_COMMON,
+                                                   BuildGraph::CFG_INDEX,
+                                                   BuildGraph::templateKey( *_templates->_author_list ),
+                                                   BuildGraph::CAT_AUTHORS } );
+
+    if( _build_graph->update( list_page_path, std::move( list_inputs ) ) ) {
+        auto page = dto::Page( list_page_path );
+        list_page_maker.write( page );
+    }
 
-        _display.progress( "DONE" );
+    cat_page_maker.write( _index->_indices.byAuthor, breadcrumb, _options->_paths.index_author_dir );
+}
 
-    } catch( std::exception &e ) {
-        _display.error( e.what() );
-        return false;
-    }
 
-    return true;
+/**
+ * Gets the build graph inputs common to all the pages of a listing
+ * @param page_template Page template of the listing
+ * @return Build graph input keys
+ */
+blogator::output::BuildGraph::Inputs_t blogator::output::page::Indices::getListerInputs( const dto::Template &page_template ) const {
+    return BuildGraph::Inputs_t( { BuildGraph::CFG_COMMON,
+                                   BuildGraph::CFG_INDEX,
+                                   BuildGraph::templateKey( page_template ),
+                                   BuildGraph::templateKey( *_templates->_index_entry ) } );
 }
\ No newline at end of file
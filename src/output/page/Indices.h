@@ -19,14 +19,21 @@ namespace blogator::output::page {
       public:
         Indices( std::shared_ptr<const dto::Index>     master_index,
                  std::shared_ptr<const dto::Templates> templates,
-                 std::shared_ptr<const dto::Options>   global_options );
+                 std::shared_ptr<const dto::Options>   global_options,
+                 std::shared_ptr<BuildGraph>           build_graph );
 
         [[nodiscard]] bool init() const;
 
       private:
-        generic::EntryWriter _entry_maker;
-        BreadCrumb_t         _breadcrumb_parents;
-        size_t               _total_jobs;
+        BreadCrumb_t _breadcrumb_parents;
+        size_t       _total_jobs;
+
+        void writeChronologicalIndex( const generic::EntryWriter &entry_maker ) const;
+        void writeYearIndex( const generic::EntryWriter &entry_maker ) const;
+        void writeTagIndex( const generic::EntryWriter &entry_maker ) const;
+        void writeAuthorIndex( const generic::EntryWriter &entry_maker ) const;
+
+        [[nodiscard]] BuildGraph::Inputs_t getListerInputs( const dto::Template &page_template ) const;
     };
 }
 
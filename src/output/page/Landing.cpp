@@ -16,15 +16,19 @@
  * @param master_index   Master index
  * @param templates      Templates
  * @param global_options Global blogator options
+ * @param build_graph    Build graph
  */
 blogator::output::page::Landing::Landing( std::shared_ptr<const dto::Index>     master_index,
                                           std::shared_ptr<const dto::Templates> templates,
-                                          std::shared_ptr<const dto::Options>   global_options ) :
+                                          std::shared_ptr<const dto::Options>   global_options,
+                                          std::shared_ptr<BuildGraph>           build_graph ) :
     Page( std::move( master_index ),
                std::move( templates ),
-               std::move( global_options ) ),
+               std::move( global_options ),
+               std::move( build_graph ) ),
     _entry_maker( generic::EntryWriter( _options, _templates->_index_entry ) ),
-    _breadcrumb_parents( BreadCrumb_t() )
+    _breadcrumb_parents( BreadCrumb_t() ),
+    _renderer( *_templates->_landing, helper::TemplateRenderer::Layout::PAGE )
 {}
 
 /**
@@ -55,16 +59,18 @@ bool blogator::output::page::Landing::init() const {
 }
 
 /**
- * Generates the landing page
+ * Generates the landing page (skipped when its inputs are unchanged since the last run)
  * @throws std::invalid_argument when page path could not be generated for landing page
  */
 void blogator::output::page::Landing::generateLandingPage() const {
     using dto::Page;
-    using dto::Line;
-    using dto::Template;
 
-    Page page = { _options->_paths.root_dir / _options->_filenames.landing,
-                  std::ofstream( _options->_paths.root_dir / _options->_filenames.landing ) };
+    const auto path = _options->_paths.root_dir / _options->_filenames.landing;
+
+    if( !_build_graph->update( path, getPageInputs() ) )
+        return;
+
+    auto page = Page( path );
 
     if( !page._out.is_open() )
         throw exception::file_access_failure(
@@ -73,77 +79,37 @@ void blogator::output::page::Landing::generateLandingPage() const {
 
     page._out << _options->getSoftwareSignatureStr() << "\n";
 
-    Template::WritePosIterators insert_it = { _templates->_landing->block_write_pos.cbegin(),
-                                              _templates->_landing->path_write_pos.cbegin() };
-
-    Line line = { _templates->_landing->html->_lines.cbegin(), 0 };
-
-    while( line._it != _templates->_landing->html->_lines.cend() ) {
-        writeTemplateLine( page, line, insert_it );
-        ++line;
-    }
+    _renderer.write( page, [&]( Page &p, const std::string &indent, const std::string &block_class ) {
+        writeHtmlBlock( p, indent, block_class );
+        return true;
+    } );
 
     page._out.close();
 }
 
 /**
- * Inserts any paths/blocks that are on a line
- * @param page      Output page DTO
- * @param line      Line DTO
- * @param insert_it Iterators to the current block and path insertion point
+ * Gets the inputs the landing page is built from
+ * (the newest posts considered are capped to what can be listed if all the featured posts are skipped)
+ * @return Build graph input keys
  */
-void blogator::output::page::Landing::writeTemplateLine( dto::Page       &page,
-                                                         const dto::Line &line,
-                                                         dto::Template::WritePosIterators &insert_it ) const
-{
-    auto hasBlock = [&]() { return ( insert_it.block != _templates->_landing->block_write_pos.cend() && insert_it.block->first.line == line._num ); };
-    auto hasPath  = [&]() { return ( insert_it.path  != _templates->_landing->path_write_pos.cend()  && insert_it.path->first.line  == line._num ); };
-
-    std::string::size_type col = 0;
-    const auto indent = html::reader::getIndent( *line._it );
-
-    //EARLY RETURN: when there's nothing to add/edit on the line
-    if( !hasBlock() && !hasPath() ) {
-        page._out << *line._it << "\n";
-        return;
-    }
-
-    while( hasBlock() && hasPath() ) {
-        if( insert_it.block->first.col < insert_it.path->first.col ) { //do the block first
-            page._out << line._it->substr( col, insert_it.block->first.col - col ) << "\n";
-            writeHtmlBlock( page, indent + "\t", insert_it.block->second );
-            page._out << indent;
-
-            col = insert_it.block->first.col;
-            ++insert_it.block;
-
-        } else { //do the path first
-            page._out << line._it->substr( col, insert_it.path->first.col - col )
-                      << html::encodePathToURL( fs::adaptRelPath( _index->_paths.templates.landing, page._abs_path, insert_it.path->second.string() ).string() );
+blogator::output::BuildGraph::Inputs_t blogator::output::page::Landing::getPageInputs() const {
+    auto inputs = BuildGraph::Inputs_t( { BuildGraph::CFG_COMMON,
+                                          BuildGraph::CFG_INDEX,
+                                          BuildGraph::CFG_LANDING,
+                                          BuildGraph::templateKey( *_templates->_landing ),
+                                          BuildGraph::templateKey( *_templates->_index_entry ),
+                                          BuildGraph::CAT_TAGS,
+                                          BuildGraph::CAT_AUTHORS } );
 
-            col = insert_it.path->first.col;
-            ++insert_it.path;
-        }
-    }
+    const auto newest = std::min( _index->_articles.size(), _options->_landing_page.most_recent + _index->_featured.size() );
 
-    while( hasBlock() ) { //just block(s) left to insert
-        page._out << line._it->substr( col, insert_it.block->first.col - col ) << "\n";
-        writeHtmlBlock( page, indent + "\t", insert_it.block->second );
-        page._out << indent;
-
-        col = insert_it.block->first.col;
-        ++insert_it.block;
-    }
+    for( size_t i = 0; i < newest; ++i )
+        inputs.emplace_back( BuildGraph::entryKey( _index->_articles[ i ] ) );
 
-    while( hasPath() ) { //just path(s) left to insert
-        page._out << line._it->substr( col, insert_it.path->first.col - col )
-                  << html::encodePathToURL( fs::adaptRelPath( _index->_paths.templates.landing, page._abs_path, insert_it.path->second.string() ).string() );
+    for( const auto &article_i : _index->_featured )
+        inputs.emplace_back( BuildGraph::entryKey( _index->_articles.at( article_i ) ) );
 
-        col = insert_it.path->first.col;
-        ++insert_it.path;
-    }
-
-    page._out << line._it->substr( col ) << "\n";
+    return inputs;
 }
 
 /**
@@ -179,7 +145,7 @@ void blogator::output::page::Landing::writeHtmlBlock( dto::Page &page,
  * @param page   Target file
  * @param indent Space to place before the output line (i.e.: html indent)
  */
-void blogator::output::page::Landing::writeTopTags( std::ofstream     &page,
+void blogator::output::page::Landing::writeTopTags( std::ostream      &page,
                                                     const std::string &indent ) const
 {
     page << indent << "<ul>\n";
@@ -187,7 +153,7 @@ void blogator::output::page::Landing::writeTopTags( std::ofstream     &page,
     for( const auto &tag : _index->_indices.byTag.top ) {
         try {
             const auto       &specs     = _index->_indices.byTag.cats.at( tag );
-            const std::string str       = tag + " (" + std::to_string( specs.article_indices.size() ) + ')';
+            const std::string str       = _index->_indices.byTag.name( tag ) + " (" + std::to_string( specs.article_indices.size() ) + ')';
             const auto       &file_name = specs.file_names.at( 0 );
             const auto        rel_path  = _options->_paths.index_tag_dir.lexically_relative( _options->_paths.root_dir );
 
@@ -199,12 +165,12 @@ void blogator::output::page::Landing::writeTopTags( std::ofstream     &page,
             if( _index->_indices.byTag.cats.find( tag ) == _index->_indices.byTag.cats.end() )
                 _display.error(
                     "[output::page::Landing::writeTopTags(..)] "
-                    "Tag '" + tag + "' does not seem to exist in the master index."
+                    "Tag '" + _index->_indices.byTag.name( tag ) + "' does not seem to exist in the master index."
                 );
             else
                 _display.error(
                     "[output::page::Landing::writeTopTags(..)] "
-                    "Tag '" + tag + "' doesn't not have any index page path(s) in its specifications."
+                    "Tag '" + _index->_indices.byTag.name( tag ) + "' doesn't not have any index page path(s) in its specifications."
                 );
         }
     }
@@ -217,7 +183,7 @@ void blogator::output::page::Landing::writeTopTags( std::ofstream     &page,
  * @param page   Target file
  * @param indent Space to place before the output line (i.e.: html indent)
  */
-void blogator::output::page::Landing::writeTopAuthors( std::ofstream     &page,
+void blogator::output::page::Landing::writeTopAuthors( std::ostream      &page,
                                                        const std::string &indent ) const
 {
     page << indent << "<ul>\n";
@@ -225,7 +191,7 @@ void blogator::output::page::Landing::writeTopAuthors( std::ofstream     &page,
     for( const auto &author : _index->_indices.byAuthor.top ) {
         try {
             const auto       &specs     = _index->_indices.byAuthor.cats.at( author );
-            const std::string str       = author + " (" + std::to_string( specs.article_indices.size() ) + ')';
+            const std::string str       = _index->_indices.byAuthor.name( author ) + " (" + std::to_string( specs.article_indices.size() ) + ')';
             const auto       &file_name = specs.file_names.at( 0 );
             const auto        rel_path  = _options->_paths.index_author_dir.lexically_relative( _options->_paths.root_dir );
 
@@ -234,15 +200,15 @@ void blogator::output::page::Landing::writeTopAuthors( std::ofstream     &page,
                  << "</li>\n";
 
         } catch( std::out_of_range &e ) {
-            if( _index->_indices.byTag.cats.find( author ) == _index->_indices.byTag.cats.end() )
+            if( _index->_indices.byAuthor.cats.find( author ) == _index->_indices.byAuthor.cats.end() )
                 _display.error(
                     "[output::page::Landing::writeTopAuthors(..)] "
-                    "Author '" + author + "' does not seem to exist in the master index."
+                    "Author '" + _index->_indices.byAuthor.name( author ) + "' does not seem to exist in the master index."
                 );
             else
                 _display.error(
                     "[output::page::Landing::writeTopAuthors(..)] "
-                    "Author '" + author + "' doesn't not have any index page path(s) in its specifications."
+                    "Author '" + _index->_indices.byAuthor.name( author ) + "' doesn't not have any index page path(s) in its specifications."
                 );
         }
     }
@@ -282,8 +248,8 @@ void blogator::output::page::Landing::writeNewestPosts( dto::Page &page, const s
             else
                 page._out << indent << "<a href=\"" << href.string() << "\">\n";
 
-            writeEntry( page, indent, *article_it );
-            page._out << indent << "</a>" << std::endl;
+            _entry_maker.write( page, indent, *article_it );
+            page._out << indent << "</a>\n";
 
             ++i;
         }
@@ -298,34 +264,16 @@ void blogator::output::page::Landing::writeNewestPosts( dto::Page &page, const s
  * @param indent Space to place before the output line (i.e.: html indent)
  */
 void blogator::output::page::Landing::writeFeatured( dto::Page &page, const std::string &indent ) const {
-    for( const auto &article : _index->_featured ) {
-        auto href = _options->_folders.posts.root / article._paths.out_html;
+    for( const auto &article_i : _index->_featured ) {
+        const auto &article = _index->_articles.at( article_i );
+        auto        href    = _options->_folders.posts.root / article._paths.out_html;
 
         if( !_options->_index.featured_css_class.empty() )
             page._out << indent << "<a class=\"" << _options->_index.featured_css_class << "\" href=\"" << href.string() << "\">\n";
         else
             page._out << indent << "<a href=\"" << href.string() << "\">\n";
 
-        writeEntry( page, indent, article );
-        page._out << indent << "</a>" << std::endl;
-    }
-}
-
-/**
- * Writes the index entry for the landing page's section
- * @param page    Target file
- * @param indent  Space to place before the output line (i.e.: html indent)
- * @param article Article who's entry to write
- */
-void blogator::output::page::Landing::writeEntry( blogator::dto::Page &page,
-                                                  const std::string   &indent,
-                                                  const dto::Article  &article ) const
-{
-    if( article._cust_index_entry ) {
-        auto custom_entry_maker = generic::EntryWriter( _options, article._cust_index_entry );
-        custom_entry_maker.write( page, indent, article );
-
-    } else {
         _entry_maker.write( page, indent, article );
+        page._out << indent << "</a>\n";
     }
 }
@@ -5,6 +5,7 @@
 
 #include "../abstract/Page.h"
 #include "../generic/EntryWriter.h"
+#include "../helper/TemplateRenderer.h"
 #include "../../dto/Options.h"
 #include "../../dto/Index.h"
 #include "../../dto/Templates.h"
@@ -16,29 +17,27 @@ namespace blogator::output::page {
       public:
         Landing( std::shared_ptr<const dto::Index>     master_index,
                  std::shared_ptr<const dto::Templates> templates,
-                 std::shared_ptr<const dto::Options>   global_options );
+                 std::shared_ptr<const dto::Options>   global_options,
+                 std::shared_ptr<BuildGraph>           build_graph );
 
         [[nodiscard]] bool init() const;
 
       private:
-        generic::EntryWriter _entry_maker;
-        BreadCrumb_t   _breadcrumb_parents;
+        generic::EntryWriter     _entry_maker;
+        BreadCrumb_t             _breadcrumb_parents;
+        helper::TemplateRenderer _renderer;
 
         void generateLandingPage() const;
-
-        void writeTemplateLine( dto::Page       &page,
-                                const dto::Line &line,
-                                dto::Template::WritePosIterators &insert_it ) const;
+        [[nodiscard]] BuildGraph::Inputs_t getPageInputs() const;
 
         void writeHtmlBlock( dto::Page &page,
                              const std::string &indent,
                              const std::string &block_class ) const;
 
-        void writeTopTags( std::ofstream &page, const std::string &indent ) const;
-        void writeTopAuthors( std::ofstream &page, const std::string &indent ) const;
+        void writeTopTags( std::ostream &page, const std::string &indent ) const;
+        void writeTopAuthors( std::ostream &page, const std::string &indent ) const;
         void writeNewestPosts( dto::Page &page, const std::string &indent ) const;
         void writeFeatured( dto::Page &page, const std::string &indent ) const;
-        void writeEntry( dto::Page &page, const std::string &indent, const dto::Article &article ) const;
     };
 }
 
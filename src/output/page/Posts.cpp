@@ -3,15 +3,21 @@
 #include "Posts.h"
 
 #include <iostream>
+#include <fstream>
 #include <stack>
 #include <functional>
 #include <variant>
+#include <atomic>
+#include <unordered_set>
+#include <mutex>
 
 #include "../../fs/fs.h"
+#include "../../fs/OutputQueue.h"
 #include "../../html/html.h"
 #include "../../exception/failed_expectation.h"
 #include "../../exception/file_access_failure.h"
 #include "../../cli/MsgInterface.h"
+#include "../../concurrency/concurrency.h"
 #include "../helper/OrderedPostInsertion.h"
 
 /**
@@ -19,23 +25,41 @@
  * @param master_index   Master index
  * @param templates      Templates
  * @param global_options Global blogator options
+ * @param build_graph    Build graph
  */
 blogator::output::page::Posts::Posts( std::shared_ptr<const dto::Index>     master_index,
                                       std::shared_ptr<const dto::Templates> templates,
-                                      std::shared_ptr<const dto::Options>   global_options  ) :
+                                      std::shared_ptr<const dto::Options>   global_options,
+                                      std::shared_ptr<BuildGraph>           build_graph ) :
     Page( std::move( master_index ),
           std::move( templates ),
-          std::move( global_options ) ),
+          std::move( global_options ),
+          std::move( build_graph ) ),
     _breadcrumb_parents( { { _options->_breadcrumb.start, "../index.html" },
-                           { _options->_breadcrumb.by_date, "../index/by_date/0.html" } } )
+                           { _options->_breadcrumb.by_date, "../index/by_date/0.html" } } ),
+    _renderer( *_templates->_post, helper::TemplateRenderer::Layout::PAGE )
 {
     auto date_tree_it = _templates->_post->block_classes.find( "index-pane-dates" );
-    if( date_tree_it != _templates->_post->block_classes.end() && date_tree_it->second )
+    if( date_tree_it != _templates->_post->block_classes.end() && date_tree_it->second ) {
         _html_date_tree = html::generateIndexDateTreeHTML( *_index, *_options );
+        _build_graph->setInput( BuildGraph::TREE_DATES, BuildGraph::Digest().add( _html_date_tree->html ).value() );
+
+        if( !_options->_posts.ssi.index_panes ) { //the SSI fragment is written as-is
+            for( const auto &indent : _renderer.blockIndents( "index-pane-dates" ) )
+                _date_tree_html.emplace( indent, dto::PatchableHTML( _html_date_tree->html, indent + "\t" ) );
+        }
+    }
 
     auto tag_tree_it = _templates->_post->block_classes.find( "index-pane-tags" );
-    if( tag_tree_it != _templates->_post->block_classes.end() && tag_tree_it->second )
+    if( tag_tree_it != _templates->_post->block_classes.end() && tag_tree_it->second ) {
         _html_tag_tree = html::generateIndexTagTreeHTML( *_index, *_options );
+        _build_graph->setInput( BuildGraph::TREE_TAGS, BuildGraph::Digest().add( _html_tag_tree->html ).value() );
+
+        if( !_options->_posts.ssi.index_panes ) { //the SSI fragment is written as-is
+            for( const auto &indent : _renderer.blockIndents( "index-pane-tags" ) )
+                _tag_tree_html.emplace( indent, dto::PatchableHTML( _html_tag_tree->html, indent + "\t" ) );
+        }
+    }
 }
 
 /**
@@ -44,8 +68,6 @@ blogator::output::page::Posts::Posts( std::shared_ptr<const dto::Index>     mast
  * @throws exception::failed_expectation when no insertion points are found in the post template
  */
 bool blogator::output::page::Posts::init() const {
-    const auto total_articles = '/' + std::to_string( _index->_articles.size() );
-
     auto &insert_points = _templates->_post->block_write_pos;
 
     if( insert_points.empty() )
@@ -53,57 +75,220 @@ bool blogator::output::page::Posts::init() const {
 
     try {
         const auto css_insert_line = _templates->_post->html->findLineOfTag( "</head>" );
-        size_t     curr_article_i  = 0;
 
-        for( const auto &article : _index->_articles ) {
-            if( curr_article_i == 0 )
-                _display.begin( "Generating post pages", _index->_articles.size(), std::to_string( curr_article_i + 1 ) + total_articles );
-            else
-                _display.progress( std::to_string( curr_article_i + 1 ) + total_articles );
+        if( _options->_posts.ssi.index_panes )
+            writeSSIFragments();
+
+        if( _options->_concurrency.jobs > 1 ) {
+            writePostPages( _options->_concurrency.jobs, css_insert_line );
+        } else {
+            for( size_t i = 0; i < _index->_articles.size(); ++i ) {
+                displayProgress( i );
+                writePostPage( i, css_insert_line );
+            }
+        }
 
-            const auto css_path = copyStylesheet( article );
-            const auto html_out = ( _options->_paths.posts_dir / article._paths.out_html );
+    } catch( std::exception &e ) {
+        _display.error( e.what() );
+        return false;
+    }
 
-            if( std::filesystem::exists( html_out ) )
-                throw exception::file_access_failure(
-                    "File '" + html_out.string() + "' already exists. Possible files with duplicate names in source folder structure."
-                );
+    _display.progress( "DONE" );
+    return true;
+}
 
-            dto::Page page = { html_out, std::ofstream( html_out ) };
+/**
+ * Writes the post pages concurrently
+ * Note: the messages of each post are buffered and sent to the display in the order of the master index
+ *       as soon as all the pages before it are written so that the display output matches a serial run.
+ * @param jobs            Number of worker threads to use
+ * @param css_insert_line Line number in the post template where the custom stylesheet link goes
+ * @throws the first exception (in the order of the master index) raised whilst writing a post page
+ */
+void blogator::output::page::Posts::writePostPages( unsigned jobs, size_t css_insert_line ) const {
+    struct PostResult {
+        std::exception_ptr             error;
+        cli::MsgInterface::MsgBuffer_t messages;
+        bool                           done { false };
+    };
 
-            if( !page._out.is_open() )
-                throw exception::file_access_failure(
-                    "File '" + html_out.string() + "' could not be opened for writing."
-                );
+    const auto count         = findDuplicateOutput();
+    auto       results       = std::vector<PostResult>( count );
+    auto       failed_i      = std::atomic<size_t>( count ); //lowest post index that failed so far
+    auto      *caller_buffer = _display.getThreadBuffer();   //messages go where the caller's would
+    auto       flush_mutex   = std::mutex();
+    size_t     flushed       = 0; //number of posts whose messages were sent to the display
 
-            page._out << _options->getSoftwareSignatureStr() << "\n";
+    concurrency::forEach( jobs, count, [&]( size_t i ) {
+        if( i > failed_i ) //skips what a serial run would not have reached
+            return;
 
-            dto::Template::WritePosIterators insert_it = { _templates->_post->block_write_pos.cbegin(),
-                                                           _templates->_post->path_write_pos.cbegin() };
+        auto *worker_buffer = _display.setThreadBuffer( &results[ i ].messages );
 
-            dto::Line line      = { _templates->_post->html->_lines.cbegin(), 0 };
-            PageInfo  page_info = { article, curr_article_i, css_insert_line, css_path };
+        try {
+            writePostPage( i, css_insert_line );
 
-            while( line._it != _templates->_post->html->_lines.cend() ) {
-                writeTemplateLine( page, line, page_info, insert_it );
-                ++line;
-            }
+        } catch( ... ) {
+            results[ i ].error = std::current_exception();
 
-            page._out.close();
-            ++curr_article_i;
+            auto lowest = failed_i.load();
+            while( i < lowest && !failed_i.compare_exchange_weak( lowest, i ) );
         }
 
-    } catch( std::exception &e ) {
-        _display.error( e.what() );
-        return false;
+        std::lock_guard<std::mutex> lock( flush_mutex );
+
+        _display.setThreadBuffer( caller_buffer );
+        results[ i ].done = true;
+
+        for( ; flushed < count && results[ flushed ].done && !results[ flushed ].error; ++flushed ) {
+            displayProgress( flushed );
+            _display.flush( results[ flushed ].messages );
+        }
+
+        _display.setThreadBuffer( worker_buffer );
+    } );
+
+    for( size_t i = flushed; i < count; ++i ) {
+        displayProgress( i );
+        _display.flush( results[ i ].messages );
+
+        if( results[ i ].error )
+            std::rethrow_exception( results[ i ].error );
     }
 
-    _display.progress( "DONE" );
-    return true;
+    if( count < _index->_articles.size() ) { //post with a duplicate output name (throws once its stylesheet is copied)
+        displayProgress( count );
+        writePostPage( count, css_insert_line );
+    }
+}
+
+/**
+ * Writes a post page (skipped when its inputs are unchanged since the last run)
+ * @param article_i       Index of the post's article in the master index
+ * @param css_insert_line Line number in the post template where the custom stylesheet link goes
+ * @throws exception::file_access_failure when the output file already exists or cannot be opened
+ */
+void blogator::output::page::Posts::writePostPage( size_t article_i, size_t css_insert_line ) const {
+    const auto &article  = _index->_articles.at( article_i );
+    const auto  css_path = copyStylesheet( article );
+    const auto  html_out = ( _options->_paths.posts_dir / article._paths.out_html );
+
+    if( !fs::OutputQueue::getInstance().claim( html_out ) )
+        throw exception::file_access_failure(
+            "File '" + html_out.string() + "' already exists. Possible files with duplicate names in source folder structure."
+        );
+
+    if( !_build_graph->update( html_out, getPageInputs( article_i ) ) )
+        return;
+
+    auto page = dto::Page( html_out );
+
+    if( !page._out.is_open() )
+        throw exception::file_access_failure(
+            "File '" + html_out.string() + "' could not be opened for writing."
+        );
+
+    page._out << _options->getSoftwareSignatureStr() << "\n";
+
+    const auto page_info    = PageInfo( { article, article_i, css_insert_line, css_path } );
+    const auto block_writer = [&]( dto::Page &p, const std::string &indent, const std::string &block_class ) {
+        writeHtmlBlock( p, indent, page_info, block_class );
+        return true;
+    };
+
+    const bool ssi_style = ( _options->_posts.ssi.index_panes && ( _html_date_tree || _html_tag_tree ) );
+
+    if( article._paths.css.empty() && !ssi_style ) {
+        _renderer.write( page, block_writer );
+    } else {
+        _renderer.write( page, 0, css_insert_line, block_writer );
+
+        if( !article._paths.css.empty() )
+            page._out << html::createStylesheetLink( css_path ) << "\n";
+
+        if( ssi_style )
+            writeSSIStyle( page, page_info );
+
+        _renderer.write( page, css_insert_line, _renderer.lineCount(), block_writer );
+    }
+
+    page._out.close();
+}
+
+/**
+ * Gets the inputs a post page is built from (index trees only for the panes used by the template)
+ * @param article_i Index of the post's article in the master index
+ * @return Build graph input keys
+ */
+blogator::output::BuildGraph::Inputs_t blogator::output::page::Posts::getPageInputs( size_t article_i ) const {
+    const auto &article = _index->_articles.at( article_i );
+    const auto  last_i  = _index->_articles.size() - 1;
+
+    auto nav = std::to_string( _index->_articles.size() - article_i ) + '/' + std::to_string( _index->_articles.size() );
+
+    for( const auto i : { size_t( 0 ), ( article_i > 0 ? article_i - 1 : 0 ), std::min( article_i + 1, last_i ), last_i } )
+        nav += '|' + _index->_articles.at( i )._paths.out_html.string();
+
+    auto inputs = BuildGraph::Inputs_t( { BuildGraph::CFG_COMMON,
+                                          BuildGraph::CFG_POSTS,
+                                          BuildGraph::templateKey( *_templates->_post ),
+                                          BuildGraph::bodyKey( article ),
+                                          BuildGraph::entryKey( article ),
+                                          BuildGraph::valueKey( "page-nav", nav ) } );
+
+    if( _options->_posts.ssi.index_panes ) { //the page only holds the includes and its own tree states
+        auto style = std::string();
+
+        for( const auto &id : getSSICheckboxIDs( article, article_i ) )
+            style += id + ',';
+
+        if( _html_date_tree || _html_tag_tree )
+            inputs.emplace_back( BuildGraph::valueKey( "ssi-style", style ) );
+
+    } else {
+        if( _html_date_tree )
+            inputs.emplace_back( BuildGraph::TREE_DATES );
+
+        if( _html_tag_tree )
+            inputs.emplace_back( BuildGraph::TREE_TAGS );
+    }
+
+    return inputs;
+}
+
+/**
+ * Finds the first post whose output file name is already taken (claimed in the run or by an earlier post)
+ * @return Index of the post in the master index (article count when there are none)
+ */
+size_t blogator::output::page::Posts::findDuplicateOutput() const {
+    auto names = std::unordered_set<std::string>();
+
+    for( size_t i = 0; i < _index->_articles.size(); ++i ) {
+        const auto html_out = ( _options->_paths.posts_dir / _index->_articles[ i ]._paths.out_html );
+
+        if( !names.emplace( html_out.string() ).second || fs::OutputQueue::getInstance().contains( html_out ) )
+            return i;
+    }
+
+    return _index->_articles.size();
+}
+
+/**
+ * Sends the progress of the post pages generation to the display
+ * @param article_i Index of the post's article being written
+ */
+void blogator::output::page::Posts::displayProgress( size_t article_i ) const {
+    const auto step = std::to_string( article_i + 1 ) + '/' + std::to_string( _index->_articles.size() );
+
+    if( article_i == 0 )
+        _display.begin( "Generating post pages", _index->_articles.size(), step );
+    else
+        _display.progress( step );
 }
 
 /**
  * Copies and renames the custom stylesheet for an article (if any) to the post output folder
+ * (handed to the output queue in write-if-changed/staged mode so that an identical copy is left untouched)
  * @param article Article DTO
  * @return Final filename of copied stylesheet
  */
@@ -113,10 +298,22 @@ std::filesystem::path blogator::output::page::Posts::copyStylesheet( const dto::
 
     auto css_name   = article._paths.out_html.filename().stem().string() + article._paths.css.extension().string();
     auto target_css = _options->_paths.posts_dir / css_name;
+
+    if( !_build_graph->update( target_css, { BuildGraph::bodyKey( article ) } ) )
+        return target_css.filename();
+
     _display.debug( "Copying custom stylesheet: " + article._paths.css.string() + " -> " + target_css.string() );
 
     try {
-        std::filesystem::copy_file( article._paths.css, target_css );
+        if( _options->_output.write_if_changed || _options->_output.staged ) {
+            fs::OutputQueue::getInstance().push( target_css, fs::readFileContent( article._paths.css ) );
+            return target_css.filename();
+        }
+
+        std::filesystem::copy_file( article._paths.css,
+                                    target_css,
+                                    ( _build_graph->incremental() ? std::filesystem::copy_options::overwrite_existing
+                                                                  : std::filesystem::copy_options::none ) );
     } catch( std::exception &e ) {
         _display.error( std::string( e.what() ) + ": " + strerror(errno) );
     }
@@ -125,68 +322,122 @@ std::filesystem::path blogator::output::page::Posts::copyStylesheet( const dto::
 }
 
 /**
- * Inserts any paths/blocks that are on a line
- * @param page      Output page DTO
- * @param line      Line DTO
- * @param page_info Page info (Article, Article i, css line)
- * @param insert_it Iterators to the current block and path insertion point
+ * Writes the index trees to their shared server-side include fragment files
+ * @throws exception::file_access_failure when a fragment file cannot be opened
  */
-void blogator::output::page::Posts::writeTemplateLine( dto::Page &page,
-                                                       const dto::Line &line,
-                                                       const PageInfo  &page_info,
-                                                       dto::Template::WritePosIterators &insert_it ) const
-{
-    auto hasBlock = [&]() { return ( insert_it.block != _templates->_post->block_write_pos.cend() && insert_it.block->first.line == line._num ); };
-    auto hasPath  = [&]() { return ( insert_it.path  != _templates->_post->path_write_pos.cend()  && insert_it.path->first.line  == line._num ); };
+void blogator::output::page::Posts::writeSSIFragments() const {
+    if( !_html_date_tree && !_html_tag_tree )
+        return;
 
-    std::string::size_type col = 0;
-    const auto indent = html::reader::getIndent( *line._it );
+    std::filesystem::create_directories( fs::OutputQueue::getInstance().stagedPath( _options->_paths.posts_ssi_dir ) );
 
-    if( !page_info.article._paths.css.empty() && page_info.css_line == line._num )
-        page._out << html::createStylesheetLink( page_info.css_path ) << std::endl;
+    if( _html_date_tree )
+        writeSSIFragment( _options->_filenames.ssi_dates, _html_date_tree->html, BuildGraph::TREE_DATES );
 
-    //EARLY RETURN: when there's nothing to add/edit on the line
-    if( !hasBlock() && !hasPath() ) {
-        page._out << *line._it << "\n";
+    if( _html_tag_tree )
+        writeSSIFragment( _options->_filenames.ssi_tags, _html_tag_tree->html, BuildGraph::TREE_TAGS );
+}
+
+/**
+ * Writes a server-side include fragment file (skipped when its tree is unchanged since the last run)
+ * @param file_name Fragment file name
+ * @param html      HTML lines of the fragment
+ * @param input     Build graph input key of the fragment's tree
+ * @throws exception::file_access_failure when the fragment file cannot be opened
+ */
+void blogator::output::page::Posts::writeSSIFragment( const std::filesystem::path &file_name,
+                                                      const dto::HTML &html,
+                                                      const std::string &input ) const
+{
+    const auto path = _options->_paths.posts_ssi_dir / file_name;
+
+    if( !_build_graph->update( path, { input } ) )
         return;
-    }
 
-    while( hasBlock() && hasPath() ) {
-        if( insert_it.block->first.col < insert_it.path->first.col ) { //do the block first
-            page._out << line._it->substr( col, insert_it.block->first.col - col ) << "\n";
-            writeHtmlBlock( page, indent + "\t", page_info, insert_it.block->second );
-            page._out << indent;
+    _display.debug( "Writing SSI fragment: " + path.string() );
+
+    auto page = dto::Page( path );
 
-            col = insert_it.block->first.col;
-            ++insert_it.block;
+    if( !page._out.is_open() )
+        throw exception::file_access_failure(
+            "File '" + path.string() + "' could not be opened for writing."
+        );
 
-        } else { //do the path first
-            page._out << line._it->substr( col, insert_it.path->first.col - col )
-                      << html::encodePathToURL( fs::adaptRelPath( _index->_paths.templates.landing, page._abs_path, insert_it.path->second.string() ).string() );
+    for( const auto &line : html._lines )
+        page._out << line << "\n";
 
-            col = insert_it.path->first.col;
-            ++insert_it.path;
-        }
-    }
+    page._out.close();
+}
 
-    while( hasBlock() ) { //just block(s) left to insert
-        page._out << line._it->substr( col, insert_it.block->first.col - col ) << "\n";
-        writeHtmlBlock( page, indent + "\t", page_info, insert_it.block->second );
-        page._out << indent;
+/**
+ * Writes the style rules expressing the states of a post in the included index trees
+ * (expands the article's year/month/tags and styles its links instead of patching the tree markup)
+ * @param page      Target 'post' file
+ * @param page_info Page info (Article, Article i, css line)
+ */
+void blogator::output::page::Posts::writeSSIStyle( dto::Page &page, const PageInfo &page_info ) const {
+    const auto checkbox_ids = getSSICheckboxIDs( page_info.article, page_info.article_i );
 
-        col = insert_it.block->first.col;
-        ++insert_it.block;
-    }
+    page._out << "<style>\n";
 
-    while( hasPath() ) { //just path(s) left to insert
-        page._out << line._it->substr( col, insert_it.path->first.col - col )
-                  << html::encodePathToURL( fs::adaptRelPath( _index->_paths.templates.landing, page._abs_path, insert_it.path->second.string() ).string() );
+    if( !checkbox_ids.empty() ) { //inverts the expanded/collapsed toggle of the article's parent nodes
+        page._out << "\t";
+        for( auto it = checkbox_ids.cbegin(); it != checkbox_ids.cend(); ++it )
+            page._out << ( it == checkbox_ids.cbegin() ? "" : ", " ) << *it << ":not(:checked) + *";
+        page._out << " { display: block; }\n";
 
-        col = insert_it.path->first.col;
-        ++insert_it.path;
+        page._out << "\t";
+        for( auto it = checkbox_ids.cbegin(); it != checkbox_ids.cend(); ++it )
+            page._out << ( it == checkbox_ids.cbegin() ? "" : ", " ) << *it << ":checked + *";
+        page._out << " { display: none; }\n";
     }
 
-    page._out << line._it->substr( col ) << "\n";
+    page._out << "\t.tree a[href=\"" << page_info.article._paths.out_html.string() << "\"] { "
+              << _options->_posts.ssi.current_post_css << " }\n"
+              << "</style>\n";
+}
+
+/**
+ * Gets the selectors of the checkboxes to expand for a post in the included index trees
+ * @param article     Article DTO
+ * @param article_pos Position of article in the master index
+ * @return Checkbox ID selectors (date tree's first)
+ */
+std::vector<std::string> blogator::output::page::Posts::getSSICheckboxIDs( const dto::Article &article,
+                                                                         const size_t &article_pos ) const
+{
+    auto checkbox_ids = std::vector<std::string>();
+
+    const auto addCheckboxIDs = [&]( const dto::HTML &tree_html, const TreeStates &states ) {
+        for( const auto &i : states.checkbox_lines ) {
+            auto id = html::reader::getContentBetween( "id=\"", "\"", tree_html._lines.at( i ) );
+            if( !id.empty() )
+                checkbox_ids.emplace_back( "#" + id );
+        }
+    };
+
+    if( _html_date_tree )
+        addCheckboxIDs( _html_date_tree->html, getDateTreeStates( article, article_pos ) );
+
+    if( _html_tag_tree )
+        addCheckboxIDs( _html_tag_tree->html, getTagTreeStates( article, article_pos ) );
+
+    return checkbox_ids;
+}
+
+/**
+ * Writes a server-side include directive for a fragment file
+ * @param page      Target 'post' file
+ * @param indent    Space to place before the output line (i.e.: html indent)
+ * @param file_name Fragment file name
+ */
+void blogator::output::page::Posts::writeSSIInclude( dto::Page &page,
+                                                     const std::string &indent,
+                                                     const std::filesystem::path &file_name ) const
+{
+    const auto rel_path = ( _options->_paths.posts_ssi_dir / file_name ).lexically_relative( page._abs_path.parent_path() );
+
+    page._out << indent << "\t<!--#include virtual=\"" << html::encodePathToURL( rel_path ) << "\" -->\n";
 }
 
 /**
@@ -208,6 +459,8 @@ void blogator::output::page::Posts::writeHtmlBlock( dto::Page &page,
         writeContentDiv( page, page_info.article );
     } else if( block_class == "index-pane-dates" ) {
         writeIndexDateTree( page, indent, page_info.article, page_info.article_i );
+    } else if( block_class == "index-pane-tags" ) {
+        writeIndexTagTree( page, indent, page_info.article, page_info.article_i );
     } else {
         _display.error(
             "[output::page::Posts::init(..)] "
@@ -234,6 +487,7 @@ void blogator::output::page::Posts::writeContentDiv( dto::Page &page,
 
 /**
  * Write the source content verbatim to the target page
+ * (large sources are copied kernel-side, the others are streamed line by line)
  * @param page        Output file
  * @param source_path Post's HTML source path
  * @throws blogator::exception::file_access_failure when source file could not be opened/imported
@@ -241,19 +495,23 @@ void blogator::output::page::Posts::writeContentDiv( dto::Page &page,
 void blogator::output::page::Posts::writeContentVerbatim( dto::Page &page,
                                                           const std::filesystem::path &source_path ) const
 {
+    if( page._out.appendFile( source_path, true ) )
+        return;
+
     auto in = std::ifstream( source_path );
     if( !in.is_open() )
         throw exception::file_access_failure( "Cannot read source file '" + source_path.string() + "'." );
 
     std::string line;
     while( getline( in, line ) )
-        page._out << line << std::endl;
+        page._out << line << "\n";
 
     in.close();
 }
 
 /**
  * Writes the source article lines with modifications to a file
+ * (uses the post body kept from indexing, the source file is only read when the article has none)
  * @param page        Output file
  * @param article     Article DTO
  * @throws blogator::exception::file_access_failure when source file could not be opened/imported
@@ -263,16 +521,21 @@ void blogator::output::page::Posts::writeContentModified( blogator::dto::Page &p
 {
     using helper::OrderedPostInsertion;
 
-    auto      html             = fs::importHTML( article._paths.src_html );
-    auto      insert_positions = helper::OrderedPostInsertion();
-    auto      path_positions   = dto::Templates::extractRelativePaths( *html );
-    dto::Line line             = { html->_lines.cbegin(), 0 };
+    auto body = article._body;
+
+    if( !body ) {
+        auto html = fs::importHTML( article._paths.src_html );
+        body = std::make_shared<const dto::PostBody>( *html, _options->_posts.adapt_rel_paths );
+    }
+
+    auto             insert_positions = helper::OrderedPostInsertion();
+    std::string_view line;
 
     const bool toc_flag      = ( article._toc != nullptr );
-    const bool rel_path_flag = ( _options->_posts.adapt_rel_paths && !path_positions.empty() );
+    const bool rel_path_flag = ( _options->_posts.adapt_rel_paths && !body->path_write_pos.empty() );
 
     if( rel_path_flag ) {
-        for( const auto &path : path_positions )
+        for( const auto &path : body->path_write_pos )
             insert_positions.pushPath( path );
     }
 
@@ -289,8 +552,8 @@ void blogator::output::page::Posts::writeContentModified( blogator::dto::Page &p
     auto insertPath = [&]( const OrderedPostInsertion::PathPosition_t &path_pos,
                            const std::string::size_type &column )
     {
-        page._out << line._it->substr( column, path_pos.first.col - column )
-                  << html::encodePathToURL( fs::adaptRelPath( article._paths.src_html, page._abs_path, path_pos.second.string() ).string() );
+        page._out << line.substr( column, path_pos.first.col - column )
+                  << fs::adaptRelPathURL( article._paths.src_html, page._abs_path, path_pos.second );
         return path_pos.first.col;
     };
 
@@ -298,7 +561,7 @@ void blogator::output::page::Posts::writeContentModified( blogator::dto::Page &p
                            const std::string &indent,
                            const std::string::size_type &column )
     {
-        page._out << line._it->substr( column, toc_pos.col - column ) << "\n";
+        page._out << line.substr( column, toc_pos.col - column ) << "\n";
         writeTocTree( page, indent + "\t", *article._toc );
         page._out << indent;
         return toc_pos.col;
@@ -311,11 +574,11 @@ void blogator::output::page::Posts::writeContentModified( blogator::dto::Page &p
         auto id_col  = mod_info.first.col - column;
         auto str_col = mod_info.second.str_pos.col - id_col;
 
-        page._out << line._it->substr( column, id_col )
+        page._out << line.substr( column, id_col )
                   << " id=\"" << mod_info.second.printID() << "\"";
 
         if( add_numbering )
-                  page._out << line._it->substr( id_col, str_col )
+                  page._out << line.substr( id_col, str_col )
                             << mod_info.second.printNumbering() << " ";
 
         return ( add_numbering ? mod_info.second.str_pos.col : mod_info.first.col );
@@ -324,14 +587,16 @@ void blogator::output::page::Posts::writeContentModified( blogator::dto::Page &p
 
     page._out << "\n";
 
-    while( line._it != html->_lines.cend() ) {
-        const auto indent = html::reader::getIndent( *line._it );
+    for( size_t line_i = 0; line_i < body->lineCount(); ++line_i ) {
+        line = body->line( line_i );
+
+        const auto indent = html::reader::getIndent( line );
         std::string::size_type column = 0;
 
         while( !insert_positions.empty() ) {
             const auto & pos = OrderedPostInsertion::getInsertPosition( insert_positions.top() );
 
-            if( pos.line != line._num )
+            if( pos.line != line_i )
                 break;
 
             switch( insert_positions.top().first ) {
@@ -360,8 +625,7 @@ void blogator::output::page::Posts::writeContentModified( blogator::dto::Page &p
             insert_positions.pop();
         }
 
-        page._out << line._it->substr( column ) << "\n";
-        ++line;
+        page._out << line.substr( column ) << "\n";
     }
 }
 
@@ -407,12 +671,13 @@ void blogator::output::page::Posts::writePageNavDiv( dto::Page &page,
                              ? html::createHyperlink( latest, _options->_page_nav.last, "disabled" )
                              : html::createHyperlink( latest, _options->_page_nav.last ) )
                         << "</li>\n"
-              << indent << "</ul>"
-              << std::endl;
+              << indent << "</ul>\n";
 }
 
 /**
  * Writes the indexed date tree for a 'post' page
+ * (copies the pre-rendered tree with the article's year/month expanded and its link marked
+ * or, in SSI mode, includes the shared tree fragment)
  * @param page        Target 'post' file
  * @param indent      Space to place before the output line (i.e.: html indent)
  * @param article     Article DTO
@@ -429,27 +694,16 @@ void blogator::output::page::Posts::writeIndexDateTree( dto::Page &page,
             "No Tree was created and yet the post tree writer method was called."
         );
 
-    const auto &tree  = *_html_date_tree;
-    auto year_line    = tree.date_line_map.find( article._datestamp._year );
-    auto month_line   = tree.date_line_map.find( dto::DateStamp::concatYYYYMM( article._datestamp ) );
-    auto article_line = tree.article_line_map.find( article_pos );
-
-    size_t i = 0;
-    for( const auto &line : tree.html._lines ) {
-        if( year_line != tree.date_line_map.end() && year_line->second == i )
-            page._out << indent << "\t" << html::writer::setInputCheckboxState( line, "checked" ) << std::endl;
-        else if( month_line != tree.date_line_map.end() && month_line->second == i )
-            page._out << indent << "\t" << html::writer::setInputCheckboxState( line, "checked" ) << std::endl;
-        else if( article_line != tree.article_line_map.end() && article_line->second == i )
-            page._out << indent << "\t" << html::writer::setHyperlinkClass( line, "current-post" ) << std::endl;
-        else
-            page._out << indent << "\t" << line << std::endl;
-        ++i;
-    }
+    if( _options->_posts.ssi.index_panes )
+        writeSSIInclude( page, indent, _options->_filenames.ssi_dates );
+    else
+        writePatchableTree( page, indent, _html_date_tree->html, _date_tree_html, getDateTreeStates( article, article_pos ) );
 }
 
 /**
  * Write the indexed tag tree for a 'post' page
+ * (copies the pre-rendered tree with the article's tags expanded and its links marked
+ * or, in SSI mode, includes the shared tree fragment)
  * @param page        Target 'post' file
  * @param indent      Space to place before the output line (i.e.: html indent)
  * @param article     Article DTO
@@ -466,43 +720,85 @@ void blogator::output::page::Posts::writeIndexTagTree( dto::Page &page,
             "No Tree was created and yet the post tree writer method was called."
         );
 
-    const auto &tree        = *_html_tag_tree;
-    auto tag_checkbox_lines = std::vector<dto::HTML::LineIndex_t>();
-    auto article_link_lines = std::vector<dto::HTML::LineIndex_t>();
+    if( _options->_posts.ssi.index_panes )
+        writeSSIInclude( page, indent, _options->_filenames.ssi_tags );
+    else
+        writePatchableTree( page, indent, _html_tag_tree->html, _tag_tree_html, getTagTreeStates( article, article_pos ) );
+}
+
+/**
+ * Gets the states of an article in the date tree
+ * @param article     Article DTO
+ * @param article_pos Position of article in the master index
+ * @return Year/month checkbox lines and article link line
+ */
+blogator::output::page::Posts::TreeStates
+    blogator::output::page::Posts::getDateTreeStates( const dto::Article &article, const size_t &article_pos ) const
+{
+    const auto &tree   = *_html_date_tree;
+    auto        states = TreeStates();
+
+    auto year_line    = tree.date_line_map.find( article._datestamp._year );
+    auto month_line   = tree.date_line_map.find( dto::DateStamp::concatYYYYMM( article._datestamp ) );
+    auto article_line = tree.article_line_map.find( article_pos );
+
+    if( year_line != tree.date_line_map.end() )
+        states.checkbox_lines.emplace_back( year_line->second );
+    if( month_line != tree.date_line_map.end() )
+        states.checkbox_lines.emplace_back( month_line->second );
+    if( article_line != tree.article_line_map.end() )
+        states.link_lines.emplace_back( article_line->second );
+
+    return states;
+}
+
+/**
+ * Gets the states of an article in the tag tree
+ * @param article     Article DTO
+ * @param article_pos Position of article in the master index
+ * @return Tag checkbox lines and article link lines
+ */
+blogator::output::page::Posts::TreeStates
+    blogator::output::page::Posts::getTagTreeStates( const dto::Article &article, const size_t &article_pos ) const
+{
+    const auto &tree   = *_html_tag_tree;
+    auto        states = TreeStates();
 
     //<input type="checkbox"..> lines
     for( const auto &t : article._tags ) {
         auto it = tree.tag_line_map.find( t );
         if( it != tree.tag_line_map.end() )
-            tag_checkbox_lines.emplace_back( it->second );
+            states.checkbox_lines.emplace_back( it->second );
     }
 
     //<a>...</a> article link lines
     auto it = tree.articles_line_map.find( article_pos );
     if( it != tree.articles_line_map.end() )
-        std::copy( it->second.begin(), it->second.end(), std::back_inserter( article_link_lines ) );
-
-    //sort by ascending line number
-    std::sort( tag_checkbox_lines.begin(), tag_checkbox_lines.end() );
-    std::sort( article_link_lines.begin(), article_link_lines.end() );
-
-    //writing index tree html
-    auto checkbox_line = tag_checkbox_lines.cbegin();
-    auto link_line     = article_link_lines.cbegin();
-
-    size_t i = 0;
-    for( const auto &line : tree.html._lines ) {
-        if( checkbox_line != tag_checkbox_lines.cend() && *checkbox_line == i ) {
-            page._out << indent << "\t" << html::writer::setInputCheckboxState( line, "checked" ) << std::endl;
-            ++checkbox_line;
-        } else if( link_line != article_link_lines.cend() && *link_line == i ) {
-            page._out << indent << "\t" << html::writer::setHyperlinkClass( line, "current-post" ) << std::endl;
-            ++link_line;
-        } else {
-            page._out << indent << "\t" << line << std::endl;
-        }
-        ++i;
-    }
+        states.link_lines = it->second;
+
+    return states;
+}
+
+/**
+ * Writes a pre-rendered tree for a 'post' page
+ * @param page   Target 'post' file
+ * @param indent Space to place before the output line (i.e.: html indent)
+ * @param html   Tree html lines (for rendering on the fly when not pre-rendered for the indent)
+ * @param trees  Pre-rendered trees
+ * @param states Tree lines with checkboxes to set to 'checked' and links to mark as the 'current-post'
+ */
+void blogator::output::page::Posts::writePatchableTree( dto::Page &page,
+                                                        const std::string &indent,
+                                                        const dto::HTML &html,
+                                                        const PatchableTrees_t &trees,
+                                                        const TreeStates &states ) const
+{
+    const auto it = trees.find( indent );
+
+    if( it != trees.cend() )
+        it->second.write( page._out, states.checkbox_lines, states.link_lines );
+    else
+        dto::PatchableHTML( html, indent + "\t" ).write( page._out, states.checkbox_lines, states.link_lines );
 }
 
 /**
@@ -556,7 +852,7 @@ void blogator::output::page::Posts::writeTocTree( dto::Page &page,
     html::writer::closeTree( html );
 
     if( !_options->_posts.toc.heading.empty() )
-        page._out << indent << _options->_posts.toc.heading << std::endl;
+        page._out << indent << _options->_posts.toc.heading << "\n";
 
     for( const auto &line : html._lines )
         page._out << indent << line << "\n";
@@ -1,23 +1,28 @@
 #ifndef BLOGATOR_OUTPUT_PAGE_POST_H
 #define BLOGATOR_OUTPUT_PAGE_POST_H
 
+#include <map>
+
 #include "../abstract/Page.h"
 #include "../../dto/Article.h"
 #include "../../dto/Index.h"
 #include "../../dto/HTML.h"
 #include "../../dto/IndexDateTree.h"
 #include "../../dto/IndexTagTree.h"
+#include "../../dto/PatchableHTML.h"
 #include "../../dto/Options.h"
 #include "../../dto/Templates.h"
 #include "../../dto/Line.h"
 #include "../../cli/MsgInterface.h"
+#include "../helper/TemplateRenderer.h"
 
 namespace blogator::output::page {
     class Posts : abstract::Page {
       public:
         Posts( std::shared_ptr<const dto::Index>     master_index,
                std::shared_ptr<const dto::Templates> templates,
-               std::shared_ptr<const dto::Options>   global_options );
+               std::shared_ptr<const dto::Options>   global_options,
+               std::shared_ptr<BuildGraph>           build_graph );
 
         [[nodiscard]] bool init() const;
 
@@ -29,16 +34,33 @@ namespace blogator::output::page {
             const std::filesystem::path css_path;
         };
 
+        struct TreeStates {
+            dto::PatchableHTML::LineIndices_t checkbox_lines; //lines with checkboxes to set to 'checked'
+            dto::PatchableHTML::LineIndices_t link_lines;     //lines with links to mark as the 'current-post'
+        };
+
+        typedef std::map<std::string, dto::PatchableHTML> PatchableTrees_t; //K=indent
+
         std::unique_ptr<const dto::IndexDateTree> _html_date_tree;
         std::unique_ptr<const dto::IndexTagTree>  _html_tag_tree;
         Breadcrumb::BreadCrumb_t                  _breadcrumb_parents;
+        helper::TemplateRenderer                  _renderer;
+        PatchableTrees_t                          _date_tree_html; //pre-rendered date tree for each insertion indent
+        PatchableTrees_t                          _tag_tree_html;  //pre-rendered tag tree for each insertion indent
+
+        void writePostPages( unsigned jobs, size_t css_insert_line ) const;
+        void writePostPage( size_t article_i, size_t css_insert_line ) const;
+        [[nodiscard]] BuildGraph::Inputs_t getPageInputs( size_t article_i ) const;
+        [[nodiscard]] size_t findDuplicateOutput() const;
+        void displayProgress( size_t article_i ) const;
 
         [[nodiscard]] std::filesystem::path copyStylesheet( const dto::Article &article ) const;
 
-        void writeTemplateLine( dto::Page       &page,
-                                const dto::Line &line,
-                                const PageInfo  &page_info,
-                                dto::Template::WritePosIterators &insert_it ) const;
+        void writeSSIFragments() const;
+        void writeSSIFragment( const std::filesystem::path &file_name, const dto::HTML &html, const std::string &input ) const;
+        void writeSSIStyle( dto::Page &page, const PageInfo &page_info ) const;
+        [[nodiscard]] std::vector<std::string> getSSICheckboxIDs( const dto::Article &article, const size_t &article_pos ) const;
+        void writeSSIInclude( dto::Page &page, const std::string &indent, const std::filesystem::path &file_name ) const;
 
         void writeHtmlBlock( dto::Page &page,
                              const std::string &indent,
@@ -67,6 +89,15 @@ namespace blogator::output::page {
                                 const dto::Article &article,
                                 const size_t &article_pos ) const;
 
+        [[nodiscard]] TreeStates getDateTreeStates( const dto::Article &article, const size_t &article_pos ) const;
+        [[nodiscard]] TreeStates getTagTreeStates( const dto::Article &article, const size_t &article_pos ) const;
+
+        void writePatchableTree( dto::Page &page,
+                                 const std::string &indent,
+                                 const dto::HTML &html,
+                                 const PatchableTrees_t &trees,
+                                 const TreeStates &states ) const;
+
         void writeTocTree( dto::Page &page,
                            const std::string &indent,
                            const dto::TableOfContents &toc ) const;
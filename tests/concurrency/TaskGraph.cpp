@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "../../src/concurrency/TaskGraph.h"
+#include "../../src/cli/MsgInterface.h"
+#include "../../src/exception/failed_expectation.h"
+
+using blogator::concurrency::TaskGraph;
+
+TEST( TaskGraph_tests, add_fail ) {
+    auto graph = TaskGraph();
+
+    ASSERT_EQ( 0, graph.add( []() {} ) );
+    ASSERT_THROW( graph.add( []() {}, { 1 } ), std::invalid_argument );
+    ASSERT_EQ( 1, graph.add( []() {}, { 0 } ) );
+    ASSERT_EQ( 2, graph.size() );
+}
+
+TEST( TaskGraph_tests, run_dependencies ) {
+    for( unsigned jobs : { 1, 2, 8 } ) {
+        auto graph = TaskGraph();
+        auto mutex = std::mutex();
+        auto order = std::vector<size_t>();
+
+        auto task = [&]( size_t i ) {
+            return [&, i]() {
+                std::this_thread::sleep_for( std::chrono::milliseconds( 3 - i % 3 ) );
+                std::lock_guard<std::mutex> lock( mutex );
+                order.emplace_back( i );
+            };
+        };
+
+        auto a = graph.add( task( 0 ) );
+        auto b = graph.add( task( 1 ) );
+        auto c = graph.add( task( 2 ), { a } );
+        auto d = graph.add( task( 3 ), { b, c } );
+        graph.add( task( 4 ), { d } );
+        graph.add( task( 5 ) );
+
+        graph.run( jobs );
+
+        auto pos = [&]( size_t i ) { return std::find( order.begin(), order.end(), i ) - order.begin(); };
+
+        ASSERT_EQ( 6, order.size() ) << "jobs: " << jobs;
+        ASSERT_LT( pos( 0 ), pos( 2 ) ) << "jobs: " << jobs;
+        ASSERT_LT( pos( 1 ), pos( 3 ) ) << "jobs: " << jobs;
+        ASSERT_LT( pos( 2 ), pos( 3 ) ) << "jobs: " << jobs;
+        ASSERT_LT( pos( 3 ), pos( 4 ) ) << "jobs: " << jobs;
+
+        if( jobs == 1 ) {
+            ASSERT_EQ( std::vector<size_t>( { 0, 1, 2, 3, 4, 5 } ), order );
+        }
+    }
+}
+
+TEST( TaskGraph_tests, run_concurrently ) {
+    auto graph   = TaskGraph();
+    auto running = std::atomic<int>( 0 );
+    auto peak    = std::atomic<int>( 0 );
+
+    for( size_t i = 0; i < 4; ++i ) {
+        graph.add( [&]() {
+            auto n = ++running;
+            for( auto p = peak.load(); n > p && !peak.compare_exchange_weak( p, n ); );
+            std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+            --running;
+        } );
+    }
+
+    graph.run( 4 );
+
+    ASSERT_GT( peak, 1 );
+}
+
+TEST( TaskGraph_tests, run_concurrently_live_progress ) {
+    auto &display = blogator::cli::MsgInterface::getInstance();
+    auto  graph   = TaskGraph();
+    auto  seen    = std::atomic<bool>( false );
+
+    graph.add( [&]() {
+        display.begin( "Task A", 2, "1/2" );
+        display.progress( "2/2" );
+        display.warning( "buffered until the graph is done" );
+
+        for( size_t i = 0; i < 500 && !seen; ++i ) //waits for the other task
+            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    } );
+
+    graph.add( [&]() { //sees the progress whilst the first task is still running
+        for( size_t i = 0; i < 500 && !seen; ++i ) {
+            seen = ( display.total() > 0 );
+            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+        }
+    } );
+
+    graph.run( 2, "Testing" );
+
+    ASSERT_TRUE( seen );
+    ASSERT_DOUBLE_EQ( 1, display.total() );
+}
+
+TEST( TaskGraph_tests, run_fail ) {
+    for( unsigned jobs : { 1, 4 } ) {
+        auto graph = TaskGraph();
+        auto ran   = std::vector<std::atomic<bool>>( 5 );
+
+        auto a = graph.add( [&]() { ran[ 0 ] = true; } );
+        graph.add( [&]() {
+            ran[ 1 ] = true;
+            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+            throw blogator::exception::failed_expectation( "first" );
+        } );
+        auto c = graph.add( [&]() { ran[ 2 ] = true; throw blogator::exception::failed_expectation( "second" ); }, { a } );
+        graph.add( [&]() { ran[ 3 ] = true; }, { c } );
+        graph.add( [&]() { ran[ 4 ] = true; } );
+
+        try {
+            graph.run( jobs );
+            FAIL() << "No exception thrown (jobs: " << jobs << ").";
+        } catch( blogator::exception::failed_expectation &e ) {
+            ASSERT_EQ( std::string( "first" ), e.what() ) << "jobs: " << jobs; //first failure in insertion order
+        }
+
+        ASSERT_TRUE( ran[ 0 ] );
+        ASSERT_TRUE( ran[ 1 ] );
+        ASSERT_FALSE( ran[ 3 ] ) << "jobs: " << jobs; //dependent of a failed task
+
+        if( jobs == 1 ) {
+            ASSERT_FALSE( ran[ 2 ] );
+            ASSERT_FALSE( ran[ 4 ] );
+        }
+    }
+}
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "../../src/dto/Dictionary.h"
+
+TEST( Dictionary_tests, intern ) {
+    using blogator::dto::Dictionary;
+
+    auto dict = Dictionary();
+    auto id1  = dict.intern( "java" );
+    auto id2  = dict.intern( "JavaScript" );
+    auto id3  = dict.intern( "Java" );
+
+    ASSERT_EQ( 2, dict.size() );
+    ASSERT_EQ( id1, id3 );
+    ASSERT_NE( id1, id2 ); //prefix is a different string
+    ASSERT_EQ( "java", dict.str( id1 ) ); //first spelling is used for display
+    ASSERT_EQ( "java", dict.key( id1 ) );
+    ASSERT_EQ( "JavaScript", dict.str( id2 ) );
+    ASSERT_EQ( "javascript", dict.key( id2 ) );
+    ASSERT_THROW( (void) dict.str( 2 ), std::out_of_range );
+}
+
+TEST( Dictionary_tests, find ) {
+    using blogator::dto::Dictionary;
+
+    auto dict = Dictionary();
+    auto id   = dict.intern( "Tag" );
+
+    ASSERT_EQ( id, dict.find( "tAG" ) );
+    ASSERT_FALSE( dict.find( "Ta" ).has_value() );
+    ASSERT_FALSE( dict.find( "Tags" ).has_value() );
+}
+
+TEST( Dictionary_tests, sort ) {
+    using blogator::dto::Dictionary;
+
+    auto dict = Dictionary();
+    auto ids  = Dictionary::IDs_t();
+
+    for( const auto &s : { "c", "B", "abc", "b", "ab", "A" } )
+        Dictionary::add( ids, dict.intern( s ) );
+
+    ASSERT_EQ( 5, ids.size() ); //"b" == "B"
+
+    dict.sort( ids );
+
+    auto names = std::vector<std::string>();
+    for( auto id : ids )
+        names.emplace_back( dict.str( id ) );
+
+    ASSERT_EQ( std::vector<std::string>( { "A", "ab", "abc", "B", "c" } ), names );
+}
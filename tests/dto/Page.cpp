@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include <fstream>
+#include <sstream>
+
+#include "../../src/dto/Page.h"
+
+namespace {
+    std::filesystem::path tempPath( const std::string &file_name ) {
+        const auto dir = std::filesystem::temp_directory_path() / "blogator_Page_test";
+        std::filesystem::create_directories( dir );
+        return dir / file_name;
+    }
+
+    std::string readFile( const std::filesystem::path &path ) {
+        auto in = std::ifstream( path );
+        auto ss = std::stringstream();
+        ss << in.rdbuf();
+        return ss.str();
+    }
+}
+
+TEST( Page_tests, write_on_close ) {
+    const auto path = tempPath( "write_on_close.html" );
+
+    auto page = blogator::dto::Page( path );
+
+    ASSERT_TRUE( page._out.is_open() );
+    ASSERT_TRUE( std::filesystem::exists( path ) );
+
+    page._out << "<html>" << std::endl << 42 << '\n' << "</html>\n";
+    page._out.flush();
+
+    ASSERT_EQ( "", readFile( path ) ); //nothing written before closing
+    ASSERT_EQ( "<html>\n42\n</html>\n", page._out.view() );
+
+    page._out.close();
+
+    ASSERT_FALSE( page._out.is_open() );
+    ASSERT_TRUE( page._out.good() );
+    ASSERT_EQ( "<html>\n42\n</html>\n", readFile( path ) );
+}
+
+TEST( Page_tests, write_on_destruction ) {
+    const auto path = tempPath( "write_on_destruction.html" );
+
+    {
+        auto page = blogator::dto::Page( path );
+        page._out << "text";
+    }
+
+    ASSERT_EQ( "text", readFile( path ) );
+}
+
+TEST( Page_tests, growth ) {
+    const auto path     = tempPath( "growth.html" );
+    auto       expected = std::string();
+
+    {
+        auto page = blogator::dto::Page( path );
+
+        for( size_t i = 0; i < 50000; ++i ) {
+            const auto line = "\t<p>" + std::to_string( i ) + "</p>\n";
+            page._out << line << static_cast<char>( 'a' + i % 26 );
+            expected += line;
+            expected += static_cast<char>( 'a' + i % 26 );
+        }
+
+        page._out << std::string( 300000, 'x' );
+        expected += std::string( 300000, 'x' );
+    }
+
+    ASSERT_EQ( expected, readFile( path ) );
+}
+
+TEST( Page_tests, pooled_buffer_reuse ) {
+    const auto path1 = tempPath( "reuse1.html" );
+    const auto path2 = tempPath( "reuse2.html" );
+
+    {
+        auto page = blogator::dto::Page( path1 );
+        page._out << "first page content";
+    }
+    {
+        auto page = blogator::dto::Page( path2 );
+        page._out << "second";
+    }
+
+    ASSERT_EQ( "first page content", readFile( path1 ) );
+    ASSERT_EQ( "second", readFile( path2 ) );
+}
+
+TEST( Page_tests, open_fail ) {
+    auto page = blogator::dto::Page( tempPath( "missing_dir" ) / "page.html" );
+
+    ASSERT_FALSE( page._out.is_open() );
+    ASSERT_TRUE( page._out.fail() );
+}
+
+TEST( Page_tests, appendFile ) {
+    const auto src  = tempPath( "appendFile_src.html" );
+    const auto path = tempPath( "appendFile.html" );
+    const auto body = std::string( blogator::dto::PageStream::KERNEL_COPY_MIN_SIZE, 'x' );
+
+    {
+        auto out = std::ofstream( src );
+        out << body;
+    }
+
+    {
+        auto page = blogator::dto::Page( path );
+        page._out << "<head>\n";
+        ASSERT_TRUE( page._out.appendFile( src, true ) );
+        ASSERT_EQ( "\n", page._out.view() ); //completed line
+        page._out << "</body>\n";
+        ASSERT_TRUE( page._out.appendFile( src ) );
+        page._out.close();
+        ASSERT_TRUE( page._out.good() );
+    }
+
+    ASSERT_EQ( "<head>\n" + body + "\n</body>\n" + body, readFile( path ) );
+}
+
+TEST( Page_tests, appendFile_fallback ) {
+    const auto src  = tempPath( "appendFile_fallback_src.html" );
+    const auto path = tempPath( "appendFile_fallback.html" );
+
+    {
+        auto out = std::ofstream( src );
+        out << std::string( blogator::dto::PageStream::KERNEL_COPY_MIN_SIZE, 'x' );
+    }
+
+    auto memory = blogator::dto::Page( path, false );
+    ASSERT_FALSE( memory._out.appendFile( src ) ); //not backed by a file
+
+    {
+        auto small = std::ofstream( src );
+        small << "<p>small</p>\n";
+    }
+
+    auto page = blogator::dto::Page( path );
+    page._out << "<head>\n";
+    ASSERT_FALSE( page._out.appendFile( src ) ); //too small
+    ASSERT_FALSE( page._out.appendFile( tempPath( "appendFile_none.html" ) ) ); //missing
+    ASSERT_EQ( "<head>\n", page._out.view() );
+}
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+#include <sstream>
+
+#include "../../src/dto/PatchableHTML.h"
+#include "../../src/html/writer/writer.h"
+
+using blogator::dto::HTML;
+using blogator::dto::PatchableHTML;
+
+namespace {
+    HTML makeTree() {
+        auto html = HTML();
+
+        html._lines = {
+            "<ul class=\"tree\">",
+            "\t<li><input type=\"checkbox\" id=\"a\"/><label for=\"a\">2020</label>",
+            "\t\t<ul>",
+            "\t\t\t<li><input type=\"checkbox\" id=\"b\"/><label for=\"b\">January</label>",
+            "\t\t\t\t<ul>",
+            "\t\t\t\t\t<li><a href=\"../posts/1.html\">Post 1</a></li>",
+            "\t\t\t\t\t<li><a href=\"../posts/0.html\">Post 0</a></li>",
+            "\t\t\t\t</ul>",
+            "\t\t\t</li>",
+            "\t\t</ul>",
+            "\t</li>",
+            "</ul>"
+        };
+
+        return html;
+    }
+
+    /**
+     * Reference implementation (previous per-line writer)
+     */
+    std::string reference( const HTML &html,
+                           const std::string &indent,
+                           const PatchableHTML::LineIndices_t &checkbox_lines,
+                           const PatchableHTML::LineIndices_t &link_lines )
+    {
+        auto ss = std::stringstream();
+
+        for( size_t i = 0; i < html._lines.size(); ++i ) {
+            const auto &line = html._lines[ i ];
+
+            if( std::find( checkbox_lines.cbegin(), checkbox_lines.cend(), i ) != checkbox_lines.cend() )
+                ss << indent << blogator::html::writer::setInputCheckboxState( line, "checked" ) << "\n";
+            else if( std::find( link_lines.cbegin(), link_lines.cend(), i ) != link_lines.cend() )
+                ss << indent << blogator::html::writer::setHyperlinkClass( line, "current-post" ) << "\n";
+            else
+                ss << indent << line << "\n";
+        }
+
+        return ss.str();
+    }
+
+    std::string write( const PatchableHTML &tree,
+                       const PatchableHTML::LineIndices_t &checkbox_lines,
+                       const PatchableHTML::LineIndices_t &link_lines )
+    {
+        auto ss = std::stringstream();
+        tree.write( ss, checkbox_lines, link_lines );
+        return ss.str();
+    }
+}
+
+TEST( PatchableHTML_tests, buffer ) {
+    const auto html = makeTree();
+    const auto tree = PatchableHTML( html, "\t\t" );
+
+    ASSERT_EQ( reference( html, "\t\t", {}, {} ), tree.buffer() );
+    ASSERT_EQ( tree.buffer(), write( tree, {}, {} ) );
+}
+
+TEST( PatchableHTML_tests, write ) {
+    const auto html = makeTree();
+    const auto tree = PatchableHTML( html, "\t" );
+
+    ASSERT_EQ( reference( html, "\t", { 1, 3 }, { 6 } ), write( tree, { 3, 1 }, { 6 } ) );
+    ASSERT_EQ( reference( html, "\t", { 1 }, { 5, 6 } ), write( tree, { 1 }, { 6, 5 } ) );
+    ASSERT_EQ( reference( html, "\t", { 0, 5 }, { 2, 5 } ), write( tree, { 0, 5 }, { 2, 5 } ) ); //lines without the tags
+    ASSERT_EQ( reference( html, "\t", {}, {} ), write( tree, { 100 }, { 100 } ) );                 //out of range
+}
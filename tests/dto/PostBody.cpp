@@ -0,0 +1,63 @@
+#include "gtest/gtest.h"
+#include "../../src/dto/PostBody.h"
+
+TEST( PostBody_tests, constructor_lines ) {
+    using blogator::dto::HTML;
+    using blogator::dto::PostBody;
+
+    auto html = HTML();
+    html._lines.emplace_back( "<h1>Title</h1>" );
+    html._lines.emplace_back( "" );
+    html._lines.emplace_back( "\t<p>text</p>" );
+
+    auto body = PostBody( html, false );
+
+    ASSERT_EQ( 3, body.lineCount() );
+    ASSERT_EQ( "<h1>Title</h1>", body.line( 0 ) );
+    ASSERT_EQ( "", body.line( 1 ) );
+    ASSERT_EQ( "\t<p>text</p>", body.line( 2 ) );
+    ASSERT_TRUE( body.path_write_pos.empty() );
+    ASSERT_THROW( (void) body.line( 3 ), std::out_of_range );
+}
+
+TEST( PostBody_tests, constructor_paths ) {
+    using blogator::dto::HTML;
+    using blogator::dto::PostBody;
+
+    auto html = HTML();
+    html._lines.emplace_back( "<p>text</p>" );
+    html._lines.emplace_back( R"(<img src="img/a.png" /><a href="../b.html">b</a>)" );
+
+    auto body = PostBody( html, true );
+
+    ASSERT_EQ( 2, body.lineCount() );
+    ASSERT_EQ( "<p>text</p>", body.line( 0 ) );
+    ASSERT_EQ( R"(<img src="" /><a href="">b</a>)", body.line( 1 ) );
+    ASSERT_EQ( 2, body.path_write_pos.size() );
+
+    auto p1 = body.path_write_pos.cbegin();
+    ASSERT_EQ( 1, p1->first.line );
+    ASSERT_EQ( 10, p1->first.col );
+    ASSERT_EQ( "img/a.png", p1->second );
+    auto p2 = std::next( p1 );
+    ASSERT_EQ( 1, p2->first.line );
+    ASSERT_EQ( 23, p2->first.col );
+    ASSERT_EQ( "../b.html", p2->second );
+}
+
+TEST( PostBody_tests, appendLine ) {
+    using blogator::dto::PostBody;
+
+    auto body = PostBody();
+    ASSERT_EQ( 0, body.lineCount() );
+
+    body.appendLine( "abc" );
+    body.appendLine( "" );
+    body.appendLine( "de" );
+
+    ASSERT_EQ( "abcde", body.buffer );
+    ASSERT_EQ( 3, body.lineCount() );
+    ASSERT_EQ( "abc", body.line( 0 ) );
+    ASSERT_EQ( "", body.line( 1 ) );
+    ASSERT_EQ( "de", body.line( 2 ) );
+}
@@ -1,4 +1,7 @@
 #include "gtest/gtest.h"
+#include <random>
+#include <regex>
+
 #include "../../src/dto/TableOfContents.h"
 
 class TableOfContents_tests : public testing::Test {
@@ -329,4 +332,151 @@ TEST_F( TableOfContents_tests, findTocBlock2 ) {
     toc->findTocBlock( ip.line, "<div class=\"auto-toc\"></div>", "auto-toc" );
     ASSERT_EQ( 1, toc->tocPositions().size() );
     ASSERT_EQ( ip, toc->tocPositions().front() );
-}
\ No newline at end of file
+}
+/**
+ * Reference implementations (previous regex based versions of findHeading(..) and findTocBlock(..))
+ */
+class TableOfContents_regex_equivalence_tests : public testing::Test {
+  protected:
+    typedef std::map<blogator::dto::InsertPosition, blogator::dto::TableOfContents::Heading> Headings_t;
+
+    static bool regexHeading( const std::string &line, int min_level, int max_level, blogator::dto::InsertPosition &pos, blogator::dto::TableOfContents::Heading &heading ) {
+        auto rx = std::regex( R"(^(.*?<\s*h([1|2|3|4|5|6]){1})\s*>(.*)(?:</h\2){1}>)" );
+        auto it = std::sregex_iterator( line.begin(), line.end(), rx );
+
+        while( it != std::sregex_iterator() ) {
+            auto level_i = stoi( it->str( 2 ) ); //throws std::invalid_argument on '|'
+
+            if( level_i >= min_level && level_i <= max_level ) {
+                pos     = blogator::dto::InsertPosition( 0, it->str( 1 ).length() );
+                heading = blogator::dto::TableOfContents::Heading( static_cast<blogator::dto::TableOfContents::HeadingLevel>( level_i ),
+                                                                   it->str( 3 ),
+                                                                   blogator::dto::InsertPosition( 0, it->position( 3 ) ) );
+                return true;
+            }
+            ++it;
+        }
+
+        return false;
+    }
+
+    static std::list<blogator::dto::InsertPosition> regexTocBlock( const std::string &line, const std::string &css_class ) {
+        auto s  = R"(^(.*<\s*[a-zA-Z\d]+\s*class\s*=\s*"[a-zA-Z-_\s]*)" + css_class + R"((?:\s[a-zA-Z-_\s]*"|")>\s*)(?:</[a-zA-Z\d]+>))";
+        auto rx = std::regex( s );
+        auto it = std::sregex_iterator( line.begin(), line.end(), rx );
+        auto positions = std::list<blogator::dto::InsertPosition>();
+
+        while( it != std::sregex_iterator() ) {
+            positions.emplace_back( blogator::dto::InsertPosition( 0, it->str( 1 ).length() ) );
+            ++it;
+        }
+
+        return positions;
+    }
+
+    static void assertSameHeading( const std::string &line ) {
+        using blogator::dto::TableOfContents;
+        using blogator::dto::InsertPosition;
+
+        auto toc        = TableOfContents( 6, 0 );
+        auto ref_pos    = InsertPosition( 0, 0 );
+        auto ref        = TableOfContents::Heading( TableOfContents::HeadingLevel::H1, "" );
+        bool ref_thrown = false;
+        bool ref_found  = false;
+
+        try {
+            ref_found = regexHeading( line, 1, 6, ref_pos, ref );
+        } catch( std::invalid_argument &e ) {
+            ref_thrown = true;
+        }
+
+        if( ref_thrown ) {
+            EXPECT_THROW( toc.findHeading( 0, line ), std::invalid_argument ) << "Line: \"" << line << "\"";
+            return;
+        }
+
+        toc.findHeading( 0, line );
+
+        if( !ref_found ) {
+            EXPECT_TRUE( toc.headings().empty() ) << "Line: \"" << line << "\"";
+        } else {
+            ASSERT_EQ( 1, toc.headings().size() ) << "Line: \"" << line << "\"";
+            const auto &h = *toc.headings().cbegin();
+            EXPECT_EQ( ref_pos, h.first ) << "Line: \"" << line << "\"";
+            EXPECT_EQ( ref.level, h.second.level ) << "Line: \"" << line << "\"";
+            EXPECT_EQ( ref.str, h.second.str ) << "Line: \"" << line << "\"";
+            EXPECT_EQ( ref.str_pos, h.second.str_pos ) << "Line: \"" << line << "\"";
+        }
+    }
+
+    static void assertSameTocBlock( const std::string &line, const std::string &css_class ) {
+        auto toc = blogator::dto::TableOfContents( 6, 0 );
+        toc.findTocBlock( 0, line, css_class );
+        EXPECT_EQ( regexTocBlock( line, css_class ), toc.tocPositions() ) << "Line: \"" << line << "\"";
+    }
+
+    static std::string randomLine( std::mt19937 &rng, const std::vector<std::string> &tokens ) {
+        auto line  = std::string();
+        auto count = std::uniform_int_distribution<size_t>( 0, 12 )( rng );
+        auto pick  = std::uniform_int_distribution<size_t>( 0, tokens.size() - 1 );
+
+        for( size_t i = 0; i < count; ++i )
+            line += tokens[ pick( rng ) ];
+
+        return line;
+    }
+};
+
+TEST_F( TableOfContents_regex_equivalence_tests, findHeading ) {
+    const auto lines = std::vector<std::string>( {
+        "", "<h1>", "<h1>A</h1>", "  <h2 >A</h2>", "< h3>A</h3>", "<\th4 \t>A</h4>", "<h 1>A</h1>", "<H1>A</H1>",
+        "<h1>A</h2>", "<h1>A</h1> B </h1>", "<h1>A</h1><h2>B</h2>", "<h2>A</h1><h1>B</h1>", "x<h3>A</h3>y",
+        "<h7>A</h7>", "<h0>A</h0><h5>B</h5>", "<h1 class=\"x\">A</h1>", "<hr><h2>A</h2>", "<h|>A</h|>",
+        "<h1>A\r</h1>", "x\r<h1>A</h1>", "<\rh1>A</h1>", "<h1>A</h1>\r<h1>B</h1>", "<h6></h6>", "<<h1>>A</h1>>",
+        "<h2>A</h2", "<h2>A<h2>B</h2>"
+    } );
+
+    for( const auto &line : lines )
+        assertSameHeading( line );
+}
+
+TEST_F( TableOfContents_regex_equivalence_tests, findHeading_random ) {
+    const auto tokens = std::vector<std::string>( {
+        "<", ">", "</", "h", "h1", "h2", "h6", "h7", "<h1>", "</h1>", "<h2>", "</h2>", "<h3 >", "</h3>", " ", "\t", "\r",
+        "text", "|", "<h|>", "</h|>", "class=\"a\"", "<p>", "</p>"
+    } );
+
+    auto rng = std::mt19937( 20201016 );
+
+    for( int i = 0; i < 2000; ++i )
+        assertSameHeading( randomLine( rng, tokens ) );
+}
+
+TEST_F( TableOfContents_regex_equivalence_tests, findTocBlock ) {
+    const auto lines = std::vector<std::string>( {
+        "", "<div class=\"auto-toc\"></div>", "  <div class=\"auto-toc\"> </div>  ", "<div class=\"a auto-toc b\"></div>",
+        "<div class=\"auto-toc-x\"></div>", "<div class=\"x-auto-toc\"></div>", "<div class = \"auto-toc\"></div>",
+        "<div id=\"a\" class=\"auto-toc\"></div>", "<div class=\"auto-toc\">text</div>", "<div class=\"auto-toc\"></>",
+        "<divclass=\"auto-toc\"></div>", "<class=\"auto-toc\"></div>", "<aclassclass=\"auto-toc\"></div>",
+        "<div class=\"auto-toc\"></div><p class=\"auto-toc\"></p>", "<div class=\"auto-toc auto-toc\"></div>",
+        "<div class=\"auto-toc\"></div>\r", "x\r<div class=\"auto-toc\"></div>", "<div class=\"auto-toc\"\r></div>",
+        "<div class=\"auto-toc\"></div >", "<div class=\"auto-toc 1\"></div>", "<span class=\"auto-toc\"></span><div>",
+        "<div class=\"auto-toc\"><div class=\"auto-toc\"></div>"
+    } );
+
+    for( const auto &line : lines )
+        assertSameTocBlock( line, "auto-toc" );
+}
+
+TEST_F( TableOfContents_regex_equivalence_tests, findTocBlock_random ) {
+    const auto tokens = std::vector<std::string>( {
+        "<", ">", "</", "div", " ", "\t", "\r", "class=", "\"", "toc", "x", "-", "1", "<div class=\"", "\"></div>",
+        "<div class=\"toc\"></div>", "<p class=\"x toc\"> </p>", "<div class=\"toc-x\"></div>",
+        "<div class = \"toc x\"></div >", "<divclass=\"toc\"></div>", "<span class=\"toc\">"
+    } );
+
+    auto rng = std::mt19937( 20201016 );
+
+    for( int i = 0; i < 2000; ++i )
+        assertSameTocBlock( randomLine( rng, tokens ), "toc" );
+}
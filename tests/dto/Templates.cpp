@@ -1,4 +1,7 @@
 #include "gtest/gtest.h"
+#include <random>
+#include <regex>
+
 #include "../../src/dto/Templates.h"
 
 TEST( Template_tests, extractRelativePaths0 ) {
@@ -91,4 +94,122 @@ TEST( Template_tests, extractRelativePaths4 ) {
     ASSERT_EQ( 1, r2->first.line );
     ASSERT_EQ( 30, r2->first.col );
     ASSERT_EQ( "../img/icons/calendar_white.svg", r2->second );
-}
\ No newline at end of file
+}
+TEST( Template_tests, extractRelativePaths5 ) { //3+ paths on a line
+    using blogator::dto::HTML;
+    using blogator::dto::Templates;
+
+    auto html = HTML();
+    html._lines.emplace_back( R"(<a href="aa.html">1</a><a href="bbbb.html">2</a><a href="cc.html">3</a><a href="http://x.com/d.html">4</a>)" );
+    auto result = Templates::extractRelativePaths( html );
+
+    ASSERT_EQ( R"(<a href="">1</a><a href="">2</a><a href="">3</a><a href="http://x.com/d.html">4</a>)", html._lines[ 0 ] );
+    ASSERT_EQ( 3, result.size() );
+    auto r0 = result.cbegin();
+    ASSERT_EQ( 9, r0->first.col );
+    ASSERT_EQ( "aa.html", r0->second );
+    auto r1 = std::next( r0 );
+    ASSERT_EQ( 25, r1->first.col );
+    ASSERT_EQ( "bbbb.html", r1->second );
+    auto r2 = std::next( r1 );
+    ASSERT_EQ( 41, r2->first.col );
+    ASSERT_EQ( "cc.html", r2->second );
+}
+
+TEST( Template_tests, extractRelativePaths6 ) { //carriage return in the middle of a line
+    using blogator::dto::HTML;
+    using blogator::dto::Templates;
+
+    auto html = HTML();
+    html._lines.emplace_back( "abc\r<img src=\"aa.png\"><img src=\"bb.png\">" );
+    auto result = Templates::extractRelativePaths( html );
+
+    ASSERT_EQ( "abc\r<img src=\"\"><img src=\"\">", html._lines[ 0 ] );
+    ASSERT_EQ( 2, result.size() );
+    ASSERT_EQ( 14, result.cbegin()->first.col );
+    ASSERT_EQ( 26, std::next( result.cbegin() )->first.col );
+}
+
+TEST( Template_tests, extractRelativePaths7 ) { //values that are not relative paths
+    using blogator::dto::HTML;
+    using blogator::dto::Templates;
+
+    auto html = HTML();
+    html._lines = {
+        R"(<a href="/root.html">)", R"(<a href="www.site.com/a.html">)", R"(<a href="https://site.com/a.html">)",
+        R"(<img src="a.png">)", R"(<a href="file.markdown">)", R"(<a href="file">)", R"(<a href='file.html'>)",
+        R"(src="outside.html" <p>)", R"(<a href="unclosed.html)", R"(<a href="bad?.html">)"
+    };
+    const auto lines = html._lines;
+    auto result = Templates::extractRelativePaths( html );
+
+    ASSERT_TRUE( result.empty() );
+    ASSERT_EQ( lines, html._lines );
+}
+
+namespace {
+    /**
+     * Reference implementation (previous regex based version of Templates::extractRelativePaths(..)
+     * with the path columns taken from the edited line)
+     */
+    blogator::dto::ConsecutivePathPositions_t regexExtractRelativePaths( blogator::dto::HTML &source ) {
+        const auto path_rx = std::regex( R"((.*?<.*?(?:src|href)=")(?!www|http)([^/]{1}[a-zA-Z\%\.\-_\d/\s]+\.[a-zA-Z\d_]{2,4})("))" );
+        auto       pos     = blogator::dto::ConsecutivePathPositions_t();
+        size_t     line_i  = 0;
+
+        for( auto &line : source._lines ) {
+            std::string edited;
+            auto it = std::sregex_iterator( line.begin(), line.end(), path_rx );
+            size_t substr_start = 0;
+
+            while( it != std::sregex_iterator() ) {
+                edited += it->str( 1 );
+                pos.insert( std::make_pair( blogator::dto::InsertPosition( line_i, edited.size() ), it->str( 2 ) ) );
+                edited += it->str( 3 );
+                substr_start += it->str( 0 ).length();
+                ++it;
+            }
+
+            line = edited + line.substr( substr_start );
+            ++line_i;
+        }
+
+        return pos;
+    }
+}
+
+TEST( Template_tests, extractRelativePaths_eq_regex ) {
+    using blogator::dto::HTML;
+    using blogator::dto::Templates;
+
+    const auto tokens = std::vector<std::string>( {
+        "<", ">", "a", " ", "\t", "=", "\"", "/", ".", "src=\"", "href=\"", "<a href=\"", "<img src=\"", "page.html", "img/pic.png",
+        "../up.html", "www", "http", "x.", "js", "file.jpeg", "%20", "-_", "data-src=\"", "\"/>", "ab.c", "ab.abcde", "q.ht",
+        "<a href=\"page.html\">", "<img src=\"../img/my pic.png\"/>", " href=\"ab.js\"", "<a href=\"www.x.com/a.html\">"
+    } );
+
+    auto rng   = std::mt19937( 20201016 );
+    auto count = std::uniform_int_distribution<size_t>( 0, 16 );
+    auto pick  = std::uniform_int_distribution<size_t>( 0, tokens.size() - 1 );
+
+    for( int i = 0; i < 300; ++i ) {
+        auto html = HTML();
+
+        for( int l = 0; l < 5; ++l ) {
+            auto &line = html._lines.emplace_back();
+
+            for( auto n = count( rng ); n > 0; --n )
+                line += tokens[ pick( rng ) ];
+        }
+
+        auto expected_html = html;
+        auto expected      = regexExtractRelativePaths( expected_html );
+        auto result        = Templates::extractRelativePaths( html );
+
+        std::stringstream ss;
+        ss << expected_html;
+
+        ASSERT_EQ( expected, result ) << ss.str();
+        ASSERT_EQ( expected_html, html ) << ss.str();
+    }
+}
@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#include "../../src/fs/OutputQueue.h"
+#include "../../src/dto/Page.h"
+
+using blogator::fs::OutputQueue;
+
+namespace {
+    const auto test_dir = std::filesystem::temp_directory_path() / "blogator_OutputQueue_test";
+
+    std::string readFile( const std::filesystem::path &path ) {
+        auto in = std::ifstream( path );
+        auto ss = std::stringstream();
+        ss << in.rdbuf();
+        return ss.str();
+    }
+}
+
+TEST( OutputQueue_tests, claim ) {
+    auto &queue = OutputQueue::getInstance();
+    queue.configure( OutputQueue::Backend::DIRECT );
+
+    ASSERT_FALSE( queue.contains( test_dir / "a.html" ) );
+    ASSERT_TRUE( queue.claim( test_dir / "a.html" ) );
+    ASSERT_TRUE( queue.contains( test_dir / "a.html" ) );
+    ASSERT_FALSE( queue.claim( test_dir / "a.html" ) );
+    ASSERT_TRUE( queue.claim( test_dir / "b.html" ) );
+
+    queue.configure( OutputQueue::Backend::DIRECT ); //clears the registry
+    ASSERT_TRUE( queue.claim( test_dir / "a.html" ) );
+    queue.configure( OutputQueue::Backend::DIRECT );
+}
+
+TEST( OutputQueue_tests, batched_pages ) {
+    auto &queue = OutputQueue::getInstance();
+    const auto dir = test_dir / "batched";
+
+    std::filesystem::remove_all( dir );
+    std::filesystem::create_directories( dir );
+
+    const auto backend = queue.configure( OutputQueue::Backend::IO_URING, 4 );
+    ASSERT_EQ( backend == OutputQueue::Backend::IO_URING, queue.batched() );
+
+    for( size_t i = 0; i < 10; ++i ) {
+        auto page = blogator::dto::Page( dir / ( std::to_string( i ) + ".html" ) );
+        ASSERT_TRUE( page._out.is_open() );
+        page._out << "page " << i << "\n";
+    } //closed on destruction
+
+    ASSERT_EQ( 0, queue.flush() );
+
+    for( size_t i = 0; i < 10; ++i )
+        ASSERT_EQ( "page " + std::to_string( i ) + "\n", readFile( dir / ( std::to_string( i ) + ".html" ) ) );
+
+    queue.configure( OutputQueue::Backend::DIRECT );
+}
+
+TEST( OutputQueue_tests, batched_failure ) {
+    auto &queue = OutputQueue::getInstance();
+    const auto dir = test_dir / "failure";
+
+    std::filesystem::remove_all( dir );
+    std::filesystem::create_directories( dir );
+
+    {
+        auto out = std::ofstream( dir / "truncated.html" );
+        out << "old content";
+    }
+
+    queue.configure( OutputQueue::Backend::IO_URING, 4 );
+
+    queue.push( dir / "ok.html", "ok" );
+    queue.push( dir / "missing" / "ko.html", "ko" );
+    queue.push( dir / "truncated.html", "new" );
+
+    ASSERT_EQ( 1, queue.flush() );
+    ASSERT_EQ( "ok", readFile( dir / "ok.html" ) );
+    ASSERT_EQ( "new", readFile( dir / "truncated.html" ) );
+    ASSERT_FALSE( std::filesystem::exists( dir / "missing" / "ko.html" ) );
+
+    queue.configure( OutputQueue::Backend::DIRECT );
+}
+
+TEST( OutputQueue_tests, batched_write_failure ) {
+    auto &queue = OutputQueue::getInstance();
+    const auto dir = test_dir / "write_failure";
+
+    std::filesystem::remove_all( dir );
+    std::filesystem::create_directories( dir );
+
+    const auto countFDs = []() {
+        const auto it = std::filesystem::directory_iterator( "/proc/self/fd" );
+        return std::distance( std::filesystem::begin( it ), std::filesystem::end( it ) );
+    };
+
+    const auto backend  = queue.configure( OutputQueue::Backend::IO_URING, 4 );
+    const auto fd_count = countFDs();
+
+    for( size_t i = 0; i < 12; ++i ) //opens fine, write fails (ENOSPC)
+        queue.push( "/dev/full", "full" );
+
+    ASSERT_EQ( 12, queue.flush() );
+    ASSERT_EQ( fd_count, countFDs() );
+    ASSERT_EQ( backend == OutputQueue::Backend::IO_URING, queue.batched() ); //ring still in use
+
+    for( size_t i = 0; i < 4; ++i )
+        queue.push( dir / ( std::to_string( i ) + ".html" ), "page " + std::to_string( i ) );
+
+    ASSERT_EQ( 0, queue.flush() );
+
+    for( size_t i = 0; i < 4; ++i )
+        ASSERT_EQ( "page " + std::to_string( i ), readFile( dir / ( std::to_string( i ) + ".html" ) ) );
+
+    queue.configure( OutputQueue::Backend::DIRECT );
+}
+
+TEST( OutputQueue_tests, write_if_changed ) {
+    auto &queue = OutputQueue::getInstance();
+    const auto dir = test_dir / "write_if_changed";
+
+    std::filesystem::remove_all( dir );
+    std::filesystem::create_directories( dir );
+
+    {
+        auto same    = std::ofstream( dir / "same.html" );
+        auto changed = std::ofstream( dir / "changed.html" );
+        auto resized = std::ofstream( dir / "resized.html" );
+        same << "content";
+        changed << "content";
+        resized << "content";
+    }
+
+    const auto old_time = std::filesystem::last_write_time( dir / "same.html" ) - std::chrono::hours( 1 );
+    std::filesystem::last_write_time( dir / "same.html", old_time );
+    std::filesystem::last_write_time( dir / "changed.html", old_time );
+
+    queue.configure( OutputQueue::Backend::DIRECT, 64, true );
+    ASSERT_TRUE( queue.deferred() );
+
+    {
+        auto page = blogator::dto::Page( dir / "same.html" );
+        page._out << "content";
+    }
+
+    queue.push( dir / "changed.html", "CONTENT" );
+    queue.push( dir / "resized.html", "more content" );
+    queue.push( dir / "new.html", "new" );
+
+    ASSERT_EQ( 0, queue.flush() );
+    ASSERT_EQ( 1, queue.unchangedCount() );
+    ASSERT_EQ( old_time, std::filesystem::last_write_time( dir / "same.html" ) );
+    ASSERT_NE( old_time, std::filesystem::last_write_time( dir / "changed.html" ) );
+    ASSERT_EQ( "CONTENT", readFile( dir / "changed.html" ) );
+    ASSERT_EQ( "more content", readFile( dir / "resized.html" ) );
+    ASSERT_EQ( "new", readFile( dir / "new.html" ) );
+    ASSERT_TRUE( queue.contains( dir / "new.html" ) ); //pushed files are part of the run's output
+
+    queue.configure( OutputQueue::Backend::DIRECT );
+    ASSERT_FALSE( queue.deferred() );
+}
+
+TEST( OutputQueue_tests, staged ) {
+    auto &queue = OutputQueue::getInstance();
+    const auto live  = test_dir / "staged" / "live";
+    const auto stage = test_dir / "staged" / "stage";
+
+    std::filesystem::remove_all( test_dir / "staged" );
+    std::filesystem::create_directories( live / "posts" );
+    std::filesystem::create_directories( stage / "posts" );
+
+    {
+        auto same    = std::ofstream( live / "posts" / "same.html" );
+        auto changed = std::ofstream( live / "posts" / "changed.html" );
+        auto skipped = std::ofstream( live / "posts" / "skipped.html" );
+        same << "content";
+        changed << "content";
+        skipped << "content";
+    }
+
+    queue.configure( OutputQueue::Backend::DIRECT );
+    queue.setStaging( live, stage );
+    ASSERT_TRUE( queue.staged() );
+    ASSERT_TRUE( queue.deferred() );
+    ASSERT_EQ( stage / "posts" / "a.html", queue.stagedPath( live / "posts" / "a.html" ) );
+    ASSERT_EQ( test_dir / "elsewhere.html", queue.stagedPath( test_dir / "elsewhere.html" ) );
+
+    {
+        auto page = blogator::dto::Page( live / "posts" / "same.html" );
+        page._out << "content";
+    }
+
+    queue.push( live / "posts" / "changed.html", "new content" );
+    queue.claim( live / "posts" / "skipped.html" );
+
+    ASSERT_EQ( 0, queue.flush() );
+    ASSERT_EQ( 1, queue.linkUnwritten() );
+    ASSERT_EQ( 2, queue.linkedCount() );
+    ASSERT_TRUE( std::filesystem::equivalent( live / "posts" / "same.html", stage / "posts" / "same.html" ) );
+    ASSERT_TRUE( std::filesystem::equivalent( live / "posts" / "skipped.html", stage / "posts" / "skipped.html" ) );
+    ASSERT_EQ( "content", readFile( live / "posts" / "changed.html" ) ); //live tree untouched
+    ASSERT_EQ( "new content", readFile( stage / "posts" / "changed.html" ) );
+
+    queue.configure( OutputQueue::Backend::DIRECT );
+    ASSERT_FALSE( queue.staged() );
+}
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "../../src/fs/RelPathCache.h"
+#include "../../src/fs/fs.h"
+#include "../../src/html/html.h"
+
+using blogator::fs::RelPathCache;
+
+TEST( RelPathCache_tests, get ) {
+    auto cache = RelPathCache();
+    auto from1 = std::filesystem::path( "/site/templates/index/index.html" );
+    auto from2 = std::filesystem::path( "/site/templates/index/entry.html" );
+    auto to1   = std::filesystem::path( "/site/index/by_tag/0.html" );
+    auto to2   = std::filesystem::path( "/site/index/by_tag/1.html" );
+    auto to3   = std::filesystem::path( "/site/posts/1.html" );
+
+    ASSERT_EQ( "../../img/my%20pic.jpeg", cache.get( from1, to1, "../../img/my pic.jpeg" ) );
+    ASSERT_EQ( "../../img/my%20pic.jpeg", cache.get( from2, to2, "../../img/my pic.jpeg" ) ); //same directories
+    ASSERT_EQ( 1, cache.size() );
+    ASSERT_EQ( "../img/my%20pic.jpeg", cache.get( from1, to3, "../../img/my pic.jpeg" ) );
+    ASSERT_EQ( "../templates/index/a.css", cache.get( from1, to3, "a.css" ) );
+    ASSERT_EQ( 3, cache.size() );
+}
+
+TEST( RelPathCache_tests, get_concurrent ) {
+    auto cache   = RelPathCache();
+    auto from    = std::filesystem::path( "/site/source/sub/post.html" );
+    auto threads = std::vector<std::thread>();
+    auto errors  = std::vector<size_t>( 4, 0 );
+
+    for( size_t t = 0; t < 4; ++t ) {
+        threads.emplace_back( [&, t]() {
+            for( size_t i = 0; i < 1000; ++i ) {
+                const auto to  = std::filesystem::path( "/site/out" ) / std::to_string( i % 10 ) / "page.html";
+                const auto rel = std::filesystem::path( "../img/" + std::to_string( i % 7 ) + ".png" );
+
+                if( cache.get( from, to, rel ) != blogator::html::encodePathToURL( blogator::fs::adaptRelPath( from, to, rel ) ) )
+                    ++errors[ t ];
+            }
+        } );
+    }
+
+    for( auto &thread : threads )
+        thread.join();
+
+    ASSERT_EQ( std::vector<size_t>( 4, 0 ), errors );
+    ASSERT_EQ( 70, cache.size() );
+}
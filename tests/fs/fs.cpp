@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
 #include "../../src/fs/fs.h"
+#include "../../src/fs/OutputQueue.h"
+#include "../../src/exception/file_access_failure.h"
 
 TEST( fs_tests, adaptRelPath ) {
     auto rel  = std::filesystem::path( "../../img/pic.jpeg" );
@@ -10,4 +14,88 @@ TEST( fs_tests, adaptRelPath ) {
     auto expected = std::filesystem::path( "../img/pic.jpeg" );
 
     ASSERT_TRUE( result.compare( expected ) == 0 );
-}
\ No newline at end of file
+}
+TEST( fs_tests, publishStagedOutput ) {
+    auto &queue   = blogator::fs::OutputQueue::getInstance();
+    auto  dir     = std::filesystem::temp_directory_path() / "blogator_fs_test" / "publish";
+    auto  options = blogator::dto::Options();
+
+    std::filesystem::remove_all( dir );
+    options.setupAbsolutePaths( dir );
+
+    const auto write = []( const std::filesystem::path &path, const std::string &content ) {
+        std::filesystem::create_directories( path.parent_path() );
+        std::ofstream( path ) << content;
+    };
+
+    write( options._paths.posts_dir / "1.html", "old post" );
+    write( options._paths.posts_dir / "image.png", "kept by safe purge" );
+    write( options._paths.index_dir / "old.html", "stale index" );
+    write( dir / options._rss.file_name, "old feed" );
+    write( options._paths.stage_dir / options._folders.posts.root / "1.html", "new post" );
+    write( options._paths.stage_dir / options._folders.index.root / "new.html", "new index" );
+    write( options._paths.stage_dir / options._filenames.landing, "new landing" );
+
+    queue.configure( blogator::fs::OutputQueue::Backend::DIRECT );
+    queue.setStaging( options._paths.root_dir, options._paths.stage_dir );
+    blogator::fs::publishStagedOutput( options );
+    queue.configure( blogator::fs::OutputQueue::Backend::DIRECT );
+
+    const auto read = []( const std::filesystem::path &path ) {
+        auto ss = std::stringstream();
+        ss << std::ifstream( path ).rdbuf();
+        return ss.str();
+    };
+
+    ASSERT_EQ( "new post", read( options._paths.posts_dir / "1.html" ) );
+    ASSERT_EQ( "kept by safe purge", read( options._paths.posts_dir / "image.png" ) );
+    ASSERT_EQ( "new index", read( options._paths.index_dir / "new.html" ) );
+    ASSERT_EQ( "new landing", read( dir / options._filenames.landing ) );
+    ASSERT_FALSE( std::filesystem::exists( options._paths.index_dir / "old.html" ) );
+    ASSERT_FALSE( std::filesystem::exists( dir / options._rss.file_name ) );
+    ASSERT_FALSE( std::filesystem::exists( options._paths.stage_dir ) );
+
+    std::filesystem::remove_all( dir );
+}
+
+TEST( fs_tests, publishStagedOutput_rollback ) {
+    auto &queue   = blogator::fs::OutputQueue::getInstance();
+    auto  dir     = std::filesystem::temp_directory_path() / "blogator_fs_test" / "publish_rollback";
+    auto  options = blogator::dto::Options();
+
+    std::filesystem::remove_all( dir );
+    options.setupAbsolutePaths( dir );
+    options._rss.file_name = "missing/feed.rss"; //live parent folder absent: the last swap fails
+
+    const auto write = []( const std::filesystem::path &path, const std::string &content ) {
+        std::filesystem::create_directories( path.parent_path() );
+        std::ofstream( path ) << content;
+    };
+
+    write( options._paths.posts_dir / "1.html", "old post" );
+    write( options._paths.index_dir / "old.html", "old index" );
+    write( options._paths.stage_dir / options._folders.posts.root / "1.html", "new post" );
+    write( options._paths.stage_dir / options._folders.index.root / "new.html", "new index" );
+    write( options._paths.stage_dir / options._filenames.landing, "new landing" );
+    write( options._paths.stage_dir / options._rss.file_name, "new feed" );
+
+    queue.configure( blogator::fs::OutputQueue::Backend::DIRECT );
+    queue.setStaging( options._paths.root_dir, options._paths.stage_dir );
+    ASSERT_THROW( blogator::fs::publishStagedOutput( options ), blogator::exception::file_access_failure );
+    queue.configure( blogator::fs::OutputQueue::Backend::DIRECT );
+
+    const auto read = []( const std::filesystem::path &path ) {
+        auto ss = std::stringstream();
+        ss << std::ifstream( path ).rdbuf();
+        return ss.str();
+    };
+
+    ASSERT_EQ( "old post", read( options._paths.posts_dir / "1.html" ) );
+    ASSERT_EQ( "old index", read( options._paths.index_dir / "old.html" ) );
+    ASSERT_FALSE( std::filesystem::exists( options._paths.index_dir / "new.html" ) );
+    ASSERT_FALSE( std::filesystem::exists( dir / options._filenames.landing ) );
+    ASSERT_EQ( "new post", read( options._paths.stage_dir / options._folders.posts.root / "1.html" ) );
+    ASSERT_EQ( "new landing", read( options._paths.stage_dir / options._filenames.landing ) );
+
+    std::filesystem::remove_all( dir );
+}
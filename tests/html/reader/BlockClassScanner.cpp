@@ -0,0 +1,155 @@
+#include "gtest/gtest.h"
+#include <random>
+#include <regex>
+
+#include "../../../src/html/reader/reader.h"
+#include "../../../src/html/reader/BlockClassScanner.h"
+
+using blogator::dto::HTML;
+using blogator::dto::Template;
+using blogator::dto::ConsecutiveWritePositions_t;
+
+namespace {
+    /**
+     * Reference implementation (previous regex based version of html::reader::getConsecutiveWritePositions(..))
+     */
+    ConsecutiveWritePositions_t regexWritePositions( const HTML &html, Template::BlockInsertClasses_t &blocks ) {
+        auto   write_pos   = ConsecutiveWritePositions_t();
+        size_t line_number = 0;
+
+        for( const auto &line : html._lines ) {
+            for( auto &css_class : blocks ) {
+                auto s  = R"(^(.*<\s*[a-zA-Z\d]+\s*class\s*=\s*"[a-zA-Z-_\s]*)" + css_class.first + R"((?:\s[a-zA-Z-_\s]*"|")>\s*)(?:</[a-zA-Z\d]+>))";
+                auto rx = std::regex( s );
+                auto it = std::sregex_iterator( line.begin(), line.end(), rx );
+
+                if( it != std::sregex_iterator() )
+                    css_class.second = true;
+
+                while( it != std::sregex_iterator() ) {
+                    write_pos.insert( std::make_pair( blogator::dto::InsertPosition( line_number, it->str( 1 ).length() ), css_class.first ) );
+                    ++it;
+                }
+            }
+
+            ++line_number;
+        }
+
+        return write_pos;
+    }
+
+    void assertSameWritePositions( const HTML &html, const Template::BlockInsertClasses_t &blocks ) {
+        auto ref_blocks = blocks;
+        auto new_blocks = blocks;
+        auto expected   = regexWritePositions( html, ref_blocks );
+        auto result     = blogator::html::reader::getConsecutiveWritePositions( html, new_blocks );
+
+        std::stringstream ss;
+        ss << html;
+
+        EXPECT_EQ( expected, result ) << "HTML:\n" << ss.str();
+        EXPECT_EQ( ref_blocks, new_blocks ) << "HTML:\n" << ss.str();
+    }
+}
+
+TEST( html_BlockClassScanner_tests, single_class ) {
+    auto blocks    = Template::BlockInsertClasses_t( { { "breadcrumb", false }, { "page-nav", false } } );
+    auto write_pos = ConsecutiveWritePositions_t();
+    auto scanner   = blogator::html::reader::BlockClassScanner( blocks );
+
+    scanner.scan( "  <div class=\"breadcrumb\"></div>", 3, write_pos );
+
+    ASSERT_EQ( 1, write_pos.size() );
+    ASSERT_EQ( blogator::dto::InsertPosition( 3, 26 ), write_pos.cbegin()->first );
+    ASSERT_EQ( "breadcrumb", write_pos.cbegin()->second );
+    ASSERT_TRUE( blocks.at( "breadcrumb" ) );
+    ASSERT_FALSE( blocks.at( "page-nav" ) );
+}
+
+TEST( html_BlockClassScanner_tests, multiple_classes_one_line ) {
+    auto blocks    = Template::BlockInsertClasses_t( { { "breadcrumb", false }, { "page-nav", false }, { "post-content", false } } );
+    auto write_pos = ConsecutiveWritePositions_t();
+    auto scanner   = blogator::html::reader::BlockClassScanner( blocks );
+
+    scanner.scan( "<nav class=\"page-nav\"></nav><div class=\"breadcrumb post-content\"></div>", 0, write_pos );
+
+    ASSERT_EQ( 2, write_pos.size() );
+    ASSERT_EQ( blogator::dto::InsertPosition( 0, 22 ), write_pos.cbegin()->first );
+    ASSERT_EQ( "page-nav", write_pos.cbegin()->second );
+    ASSERT_EQ( blogator::dto::InsertPosition( 0, 65 ), std::next( write_pos.cbegin() )->first );
+    ASSERT_EQ( "breadcrumb", std::next( write_pos.cbegin() )->second ); //first class in the map takes the position
+    ASSERT_TRUE( blocks.at( "breadcrumb" ) );
+    ASSERT_TRUE( blocks.at( "page-nav" ) );
+    ASSERT_TRUE( blocks.at( "post-content" ) );
+}
+
+TEST( html_BlockClassScanner_tests, eq_regex ) {
+    auto html = HTML();
+    html._lines = {
+        "", "<div class=\"breadcrumb\"></div>", "  <div class=\"breadcrumb\"> </div>  ", "<div class=\"a breadcrumb b\"></div>",
+        "<div class=\"breadcrumb-x\"></div>", "<div class=\"x-breadcrumb\"></div>", "<div class = \"breadcrumb\"></div>",
+        "<div id=\"a\" class=\"breadcrumb\"></div>", "<div class=\"breadcrumb\">text</div>", "<div class=\"breadcrumb\"></>",
+        "<divclass=\"breadcrumb\"></div>", "<class=\"breadcrumb\"></div>", "<aclassclass=\"breadcrumb\"></div>",
+        "<div class=\"breadcrumb\"></div><p class=\"page-nav\"></p>", "<div class=\"page-nav breadcrumb\"></div>",
+        "<div class=\"breadcrumb\"></div>\r", "x\r<div class=\"breadcrumb\"></div>", "<div class=\"breadcrumb\"\r></div>",
+        "<div class=\"breadcrumb\"></div >", "<div class=\"breadcrumb 1\"></div>", "<div class=\"col2\"></div>",
+        "<div class=\"a col2\"></div><div class=\"xcol2 y\"></div>", "<div class=\"two words\"></div>",
+        "<div class=\"nav\"></div><div class=\"page-nav\"></div>", "<div class=\"breadcrumb\"><div class=\"page-nav\"></div>",
+        "<div class=\"\tpage-nav\t\"></div>", "<div class=\"page-nav\"></div2>"
+    };
+
+    auto blocks = Template::BlockInsertClasses_t( {
+        { "breadcrumb", false }, { "page-nav", false }, { "nav", false }, { "col2", false }, { "two words", false }, { "unused", false }
+    } );
+
+    assertSameWritePositions( html, blocks );
+}
+
+TEST( html_BlockClassScanner_tests, eq_regex_templates ) {
+    for( auto type : { Template::Type::LANDING, Template::Type::POST, Template::Type::INDEX, Template::Type::INDEX_ENTRY, Template::Type::INDEX_LIST } ) {
+        auto html = HTML();
+        html._lines = {
+            "<html><head></head><body>",
+            "\t<div class=\"breadcrumb\"></div>",
+            "\t<nav class=\"page-nav\"></nav><div class=\"page-name\"></div>",
+            "\t<div class=\"index-entries\"></div> <div class=\"post-content\"></div>",
+            "\t<span class=\"post-number\"></span><span class=\"title\"></span><span class=\"date-stamp\"></span>",
+            "\t<span class=\"authors\"></span> <span class=\"tags\"></span> <div class=\"summary\"></div>",
+            "\t<div class=\"index-pane-dates\"></div><div class=\"index-pane-tags\"></div>",
+            "\t<div class=\"newest-posts\"></div><div class=\"top-tags\"></div><div class=\"top-authors\"></div>",
+            "\t<div class=\"featured-posts\"></div><div class=\"index-list-flat\"></div><div class=\"index-list-hierarchy\"></div>",
+            "</body></html>"
+        };
+
+        assertSameWritePositions( html, Template( type ).block_classes );
+    }
+}
+
+TEST( html_BlockClassScanner_tests, eq_regex_random ) {
+    const auto tokens = std::vector<std::string>( {
+        "<", ">", "</", "div", " ", "\t", "\r", "class=", "\"", "nav", "page", "-", "x", "1", "<div class=\"", "\"></div>",
+        "<div class=\"page-nav\"></div>", "<p class=\"x nav\"> </p>", "<div class=\"nav-x\"></div>", "<span class=\"col2\"></span>",
+        "<div class = \"page-nav x\"></div >", "<divclass=\"nav\"></div>", "<span class=\"nav\">", "col2"
+    } );
+
+    const auto blocks = Template::BlockInsertClasses_t( {
+        { "nav", false }, { "page-nav", false }, { "col2", false }, { "x", false }
+    } );
+
+    auto rng   = std::mt19937( 20201016 );
+    auto count = std::uniform_int_distribution<size_t>( 0, 12 );
+    auto pick  = std::uniform_int_distribution<size_t>( 0, tokens.size() - 1 );
+
+    for( int i = 0; i < 100; ++i ) {
+        auto html = HTML();
+
+        for( int l = 0; l < 10; ++l ) {
+            auto &line = html._lines.emplace_back();
+
+            for( auto n = count( rng ); n > 0; --n )
+                line += tokens[ pick( rng ) ];
+        }
+
+        assertSameWritePositions( html, blocks );
+    }
+}
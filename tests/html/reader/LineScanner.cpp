@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+#include "../../../src/html/reader/reader.h"
+#include "../../../src/html/reader/LineScanner.h"
+#include "../../../src/dto/TableOfContents.h"
+
+using blogator::html::reader::LineScanner;
+using Marker = blogator::html::reader::LineScanner::Marker;
+
+namespace {
+    const std::vector<std::string> lines = {
+        "",
+        "no markup at all",
+        "<",
+        "<span class=\"title\">Title</span>",
+        "<span class=\"title\"></span><span class=\"title\">Second</span>",
+        "<h1><span class=\"title\">Title with <b>bold</b></span></h1>",
+        "<span class=\"title\">Unclosed title",
+        "<span class=\"titles\">Not a title</span>",
+        "<span  class=\"title\">Not a title either</span>",
+        "<time datetime=\"2020-01-01\">1st Jan</time> <time datetime=\"2021-01-01\">",
+        "<time datetime=\"2020-01-01",
+        "<span class=\"author\">A</span><span class=\"author\">B</span> <span class=\"author\"></span>",
+        "<span class=\"author\">A<span class=\"author\">B</span></span>",
+        "<span class=\"author\">unclosed <span class=\"author\">B</span>",
+        "<span class=\"tag\">t1</span>, <span class=\"tag\">t2</span><span class=\"tag\">t3",
+        "<p><span class=\"summary\">one</span> two <span class=\"summary\">three</span></p>",
+        "<p>text <span class=\"summary\">multi",
+        "line</span> end <span class=\"summary\">",
+        "</span></span><span class=\"summary\"></span>",
+        "<h2>Heading</h2> < h3 >Spaced</h3>",
+        "<\th4>Tab</h4><hr/><header>",
+        "<div class=\"auto-toc\"></div>",
+        "<div class=\"a auto-toc b\"></div><p class=\"x\">",
+        "<divclass=\"auto-toc\"></div>",
+        "<div id=\"x\" class=\"auto-toc\"></div>",
+        "<div  class = \"auto-toc\" ></div>",
+        "<span class=\"tag\"><span class=\"summary\">x</span></span>",
+    };
+}
+
+TEST( html_LineScanner_tests, contentBetween_eq_reader ) {
+    using blogator::html::reader::getContentBetween;
+    auto scanner = LineScanner();
+
+    for( const auto &line : lines ) {
+        scanner.scan( line );
+        ASSERT_EQ( getContentBetween( "<span class=\"title\">", "</span>", line ), scanner.contentBetween( Marker::TITLE, Marker::SPAN_CLOSE ) ) << line;
+        ASSERT_EQ( getContentBetween( "<time datetime=\"", "\"", line ), scanner.contentBetween( Marker::DATE, '"' ) ) << line;
+    }
+}
+
+TEST( html_LineScanner_tests, contentsBetween_eq_reader ) {
+    using blogator::html::reader::getContentsBetween;
+    auto scanner = LineScanner();
+
+    for( const auto &line : lines ) {
+        scanner.scan( line );
+        ASSERT_EQ( getContentsBetween( "<span class=\"author\">", "</span>", line ), scanner.contentsBetween( Marker::AUTHOR, Marker::SPAN_CLOSE ) ) << line;
+        ASSERT_EQ( getContentsBetween( "<span class=\"tag\">", "</span>", line ), scanner.contentsBetween( Marker::TAG, Marker::SPAN_CLOSE ) ) << line;
+    }
+}
+
+TEST( html_LineScanner_tests, summaryPositions_eq_reader ) {
+    using blogator::html::reader::getSummaryPositions;
+    auto scanner  = LineScanner();
+    auto expected = std::deque<blogator::dto::InsertPosition>();
+    auto returned = std::deque<blogator::dto::InsertPosition>();
+
+    for( size_t i = 0; i < lines.size(); ++i ) {
+        scanner.scan( lines[ i ] );
+        getSummaryPositions( i, lines[ i ], expected );
+        scanner.summaryPositions( i, returned );
+        ASSERT_EQ( expected, returned ) << lines[ i ];
+    }
+}
+
+TEST( html_LineScanner_tests, toc_candidates ) {
+    using blogator::dto::TableOfContents;
+    auto scanner = LineScanner();
+
+    for( size_t i = 0; i < lines.size(); ++i ) {
+        auto toc = TableOfContents( 6, 0 );
+        scanner.scan( lines[ i ] );
+        toc.findHeading( i, lines[ i ] );
+        toc.findTocBlock( i, lines[ i ], "auto-toc" );
+
+        if( !toc.headings().empty() ) {
+            ASSERT_TRUE( scanner.found( Marker::HEADING ) ) << lines[ i ];
+        }
+        if( toc.tocBlockExists() ) {
+            ASSERT_TRUE( scanner.found( Marker::CLASS_ATTR ) ) << lines[ i ];
+        }
+    }
+}
+
+TEST( html_LineScanner_tests, hits ) {
+    auto scanner = LineScanner();
+    auto line    = std::string( "<span class=\"tag\">a</span> <span class=\"tag\">b</span>" );
+
+    scanner.scan( line );
+    ASSERT_EQ( std::vector<size_t>( { 0, 27 } ), scanner.hits( Marker::TAG ) );
+    ASSERT_EQ( std::vector<size_t>( { 19, 46 } ), scanner.hits( Marker::SPAN_CLOSE ) );
+    ASSERT_EQ( 27, scanner.next( Marker::TAG, 1 ) );
+    ASSERT_EQ( std::string::npos, scanner.next( Marker::TAG, 28 ) );
+    ASSERT_FALSE( scanner.found( Marker::TITLE ) );
+    ASSERT_FALSE( scanner.found( Marker::HEADING ) );
+
+    scanner.scan( "" );
+    ASSERT_FALSE( scanner.found( Marker::TAG ) );
+}
@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+#include "../../../src/html/reader/markup.h"
+
+using namespace blogator::html::reader;
+
+TEST( html_markup_tests, matchClassAttribute ) {
+    const std::string npos_lines[] = { "<>", "< class=\"a\">", "<div id=\"a\">", "<div class=a>", "<div class", "<class=\"a\">" };
+
+    for( const auto &line : npos_lines )
+        ASSERT_EQ( std::string::npos, markup::matchClassAttribute( line, 0 ) ) << line;
+
+    ASSERT_EQ( 12, markup::matchClassAttribute( "<div class=\"a\">", 0 ) );
+    ASSERT_EQ( 16, markup::matchClassAttribute( "< div  class = \" a\">", 0 ) );
+    ASSERT_EQ( 13, markup::matchClassAttribute( "<divclass = \"a\">", 0 ) );
+    ASSERT_EQ( 15, markup::matchClassAttribute( "ab <div class=\"a\">", 3 ) );
+}
+
+TEST( html_markup_tests, matchBlockEnd ) {
+    ASSERT_EQ( 2, markup::matchBlockEnd( "\"></div>", 0 ) );
+    ASSERT_EQ( 4, markup::matchBlockEnd( "\">  </div>", 0 ) );
+    ASSERT_EQ( std::string::npos, markup::matchBlockEnd( "\">x</div>", 0 ) );
+    ASSERT_EQ( std::string::npos, markup::matchBlockEnd( "\"></>", 0 ) );
+    ASSERT_EQ( std::string::npos, markup::matchBlockEnd( "\"></div", 0 ) );
+    ASSERT_EQ( std::string::npos, markup::matchBlockEnd( "\" ></div>", 0 ) );
+}
+
+TEST( html_markup_tests, matchClassBlock ) {
+    ASSERT_EQ( 17, markup::matchClassBlock( "<div class=\"toc\"></div>", 0, "toc" ) );
+    ASSERT_EQ( 21, markup::matchClassBlock( "<div class=\"a toc b\"></div>", 0, "toc" ) );
+    ASSERT_EQ( 22, markup::matchClassBlock( "<div class=\"page-toc\"></div>", 0, "toc" ) ); //suffix of a token
+    ASSERT_EQ( 21, markup::matchClassBlock( "<div class=\"toc toc\"></div>", 0, "toc" ) );
+    ASSERT_EQ( std::string::npos, markup::matchClassBlock( "<div class=\"toc-a\"></div>", 0, "toc" ) );
+    ASSERT_EQ( std::string::npos, markup::matchClassBlock( "<div class=\"toc\">x</div>", 0, "toc" ) );
+    ASSERT_EQ( std::string::npos, markup::matchClassBlock( "<div id=\"toc\"></div>", 0, "toc" ) );
+    ASSERT_EQ( 17, markup::matchClassBlock( "<div class=\"t.c\"></div>", 0, "t.c" ) ); //class with chars outside of [a-zA-Z-_]
+}
+
+TEST( html_markup_tests, skip ) {
+    ASSERT_EQ( 3, markup::skipSpaces( " \t\rx", 0 ) );
+    ASSERT_EQ( 1, markup::skipSpaces( "x", 1 ) );
+    ASSERT_EQ( 6, markup::skipAlnum( "aZ09bc-", 0 ) );
+    ASSERT_EQ( 8, markup::skipClassChars( "a-b_ C d\"", 0 ) );
+    ASSERT_TRUE( markup::isClassChar( ' ' ) );
+    ASSERT_FALSE( markup::isClassChar( '0' ) );
+    ASSERT_TRUE( markup::isSpace( '\v' ) );
+    ASSERT_FALSE( markup::isSpace( 'a' ) );
+}
@@ -157,6 +157,36 @@ TEST( html_reader_tests, getTags5 ) {
     ASSERT_EQ( "nthTag", result.at( 3 ) );
 }
 
+TEST( html_reader_tests, getSummaryContent ) {
+    using blogator::html::reader::getSummaryPositions;
+    using blogator::html::reader::getSummaryContent;
+
+    auto lines = std::vector<std::string>( {
+        "<p><span class=\"summary\">one</span> two <span class=\"summary\">three</span></p>",
+        "no summary here",
+        "<p>text <span class=\"summary\">multi",
+        "  middle  ",
+        "line</span> end <span class=\"summary\">four</span> <span class=\"summary\">five",
+        "</span>",
+        "<span class=\"summary\">unclosed"
+    } );
+
+    auto positions = std::deque<blogator::dto::InsertPosition>();
+    auto summary   = blogator::dto::HTML();
+    auto buffer    = std::string();
+    size_t consumed = 0;
+
+    for( size_t i = 0; i < lines.size(); ++i ) {
+        getSummaryPositions( i, lines[ i ], positions );
+        getSummaryContent( lines[ i ], positions, consumed, buffer, summary );
+    }
+
+    auto expected = std::vector<std::string>( { "one", "three", "multi  middle  line", "four", "five" } );
+    ASSERT_EQ( expected, summary._lines );
+    ASSERT_EQ( "unclosed", buffer );
+    ASSERT_EQ( positions.size(), consumed );
+}
+
 TEST( html_reader_tests, getIndent ) {
     using blogator::html::reader::getIndent;
     ASSERT_EQ( "", getIndent( "some text") );
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include "../../src/indexer/ArticleCache.h"
+
+using blogator::indexer::ArticleCache;
+using blogator::cli::MsgInterface;
+
+class ArticleCache_tests : public testing::Test {
+  protected:
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() / "blogator_tests" / "ArticleCache";
+        std::filesystem::remove_all( dir );
+        std::filesystem::create_directories( dir / "source" );
+
+        options = std::make_unique<blogator::dto::Options>();
+        options->_paths.root_dir         = dir;
+        options->_paths.source_dir       = dir / "source";
+        options->_paths.temp_dir         = dir / "tmp";
+        options->_posts.toc.generate_toc = 3;
+        options->_posts.toc.level_offset = 1;
+
+        post = dir / "source" / "post.html";
+        std::ofstream( post ) << "<h1><span class=\"title\">Title</span></h1>\n";
+    }
+
+    void TearDown() override { std::filesystem::remove_all( dir ); }
+
+    blogator::dto::Article makeArticle() {
+        using blogator::dto::InsertPosition;
+        using blogator::dto::TableOfContents;
+
+        auto article = blogator::dto::Article();
+        article._paths.src_html = post;
+        article._heading        = "Title";
+        article._datestamp      = blogator::dto::DateStamp( 2020, 2, 29 );
+        article._names.authors.emplace_back( "Author" );
+        article._names.tags.emplace_back( "cached-tag1" );
+        article._names.tags.emplace_back( "Cached-Tag2" );
+        article._summary.html._lines.emplace_back( "Summary <img src=\"\"/>" );
+        article._summary.path_write_pos.emplace( InsertPosition( 0, 19 ), "../img/a.png" );
+
+        auto toc = std::make_shared<TableOfContents>( 3, 1 );
+        toc->addHeading( InsertPosition( 3, 3 ), TableOfContents::Heading( TableOfContents::HeadingLevel::H2, "H2", InsertPosition( 3, 4 ) ) );
+        toc->addHeading( InsertPosition( 5, 3 ), TableOfContents::Heading( TableOfContents::HeadingLevel::H3, "H3", InsertPosition( 5, 4 ) ) );
+        toc->addTocBlock( InsertPosition( 1, 22 ) );
+        article._toc = toc;
+
+        return article;
+    }
+
+  public:
+    std::filesystem::path                   dir;
+    std::filesystem::path                   post;
+    std::unique_ptr<blogator::dto::Options> options;
+};
+
+TEST_F( ArticleCache_tests, save_load_roundtrip ) {
+    auto stamp    = ArticleCache::stamp( post );
+    auto messages = MsgInterface::MsgBuffer_t( { { MsgInterface::BufferedMsg::Type::DEBUG, "message" } } );
+    auto article  = makeArticle();
+
+    ASSERT_TRUE( stamp.has_value() );
+
+    { //save
+        auto cache = ArticleCache( *options );
+        ASSERT_FALSE( cache.load() );
+        cache.store( article, *stamp, messages );
+        cache.save();
+        ASSERT_TRUE( std::filesystem::exists( cache.path() ) );
+    }
+
+    { //load
+        auto cache            = ArticleCache( *options );
+        auto fetched          = blogator::dto::Article();
+        auto fetched_messages = MsgInterface::MsgBuffer_t();
+
+        ASSERT_TRUE( cache.load() );
+        ASSERT_TRUE( cache.fetch( post, *stamp, fetched, fetched_messages ) );
+
+        ASSERT_EQ( article._paths.src_html, fetched._paths.src_html );
+        ASSERT_EQ( article._heading, fetched._heading );
+        ASSERT_EQ( 0, blogator::dto::DateStamp::compare( article._datestamp, fetched._datestamp ) );
+        ASSERT_EQ( article._names.authors, fetched._names.authors );
+        ASSERT_EQ( article._names.tags, fetched._names.tags );
+        ASSERT_FALSE( blogator::dto::Dictionary::tags().find( "cached-tag2" ).has_value() ); //interned by the indexer on merge only
+        ASSERT_EQ( article._summary.html._lines, fetched._summary.html._lines );
+        ASSERT_EQ( article._summary.path_write_pos, fetched._summary.path_write_pos );
+        ASSERT_NE( nullptr, fetched._toc );
+        ASSERT_EQ( article._toc->headings().size(), fetched._toc->headings().size() );
+        ASSERT_EQ( article._toc->tocPositions(), fetched._toc->tocPositions() );
+        ASSERT_EQ( article._toc->rootHeadingLevel(), fetched._toc->rootHeadingLevel() );
+        ASSERT_EQ( article._toc->leafHeadingLevel(), fetched._toc->leafHeadingLevel() );
+
+        for( auto it1 = article._toc->headings().cbegin(), it2 = fetched._toc->headings().cbegin();
+             it1 != article._toc->headings().cend();
+             ++it1, ++it2 )
+        {
+            ASSERT_EQ( it1->first, it2->first );
+            ASSERT_EQ( it1->second, it2->second );
+            ASSERT_EQ( it1->second.str_pos, it2->second.str_pos );
+        }
+
+        ASSERT_EQ( 1, fetched_messages.size() );
+        ASSERT_EQ( MsgInterface::BufferedMsg::Type::DEBUG, fetched_messages.front().type );
+        ASSERT_EQ( "message", fetched_messages.front().str );
+    }
+}
+
+TEST_F( ArticleCache_tests, fetch_fail_on_modified_file ) {
+    auto stamp = ArticleCache::stamp( post );
+
+    { //save
+        auto cache = ArticleCache( *options );
+        cache.store( makeArticle(), *stamp, {} );
+        cache.save();
+    }
+
+    std::ofstream( post, std::ios::app ) << "<time datetime=\"2020-02-29\">29</time>\n";
+
+    auto cache    = ArticleCache( *options );
+    auto fetched  = blogator::dto::Article();
+    auto messages = MsgInterface::MsgBuffer_t();
+
+    ASSERT_TRUE( cache.load() );
+    ASSERT_NE( *stamp, *ArticleCache::stamp( post ) );
+    ASSERT_FALSE( cache.fetch( post, *ArticleCache::stamp( post ), fetched, messages ) );
+}
+
+TEST_F( ArticleCache_tests, load_fail_on_option_change ) {
+    auto stamp = ArticleCache::stamp( post );
+
+    { //save
+        auto cache = ArticleCache( *options );
+        cache.store( makeArticle(), *stamp, {} );
+        cache.save();
+    }
+
+    options->_index.show_summary = !options->_index.show_summary;
+
+    auto cache    = ArticleCache( *options );
+    auto fetched  = blogator::dto::Article();
+    auto messages = MsgInterface::MsgBuffer_t();
+
+    ASSERT_FALSE( cache.load() );
+    ASSERT_FALSE( cache.fetch( post, *stamp, fetched, messages ) );
+}
+
+TEST_F( ArticleCache_tests, load_fail_on_corrupted_file ) {
+    auto stamp = ArticleCache::stamp( post );
+    auto path  = std::filesystem::path();
+
+    { //save
+        auto cache = ArticleCache( *options );
+        cache.store( makeArticle(), *stamp, {} );
+        cache.save();
+        path = cache.path();
+    }
+
+    std::filesystem::resize_file( path, std::filesystem::file_size( path ) - 10 );
+
+    auto cache    = ArticleCache( *options );
+    auto fetched  = blogator::dto::Article();
+    auto messages = MsgInterface::MsgBuffer_t();
+
+    ASSERT_FALSE( cache.load() );
+    ASSERT_FALSE( cache.fetch( post, *stamp, fetched, messages ) );
+}
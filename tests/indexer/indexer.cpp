@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "../../src/indexer/indexer.h"
+
+using blogator::indexer::calcPageCount;
+using blogator::indexer::calcPageFileNumber;
+using blogator::indexer::makeSlug;
+using blogator::indexer::makeHashSuffix;
+using blogator::indexer::makePathSlug;
+using blogator::indexer::addSlugOutputPaths;
+
+TEST( indexer_tests, calcPageCount ) {
+    ASSERT_EQ( 0, calcPageCount( 7, 0 ) );
+    ASSERT_EQ( 1, calcPageCount( 7, 7 ) );
+    ASSERT_EQ( 2, calcPageCount( 7, 8 ) );
+}
+
+TEST( indexer_tests, calcPageFileNumber ) {
+    auto options = blogator::dto::Options();
+
+    for( size_t i = 0; i < 4; ++i )
+        ASSERT_EQ( i, calcPageFileNumber( i, 4, options ) );
+}
+
+TEST( indexer_tests, calcPageFileNumber_stable ) {
+    auto options = blogator::dto::Options();
+    options._index.stable_pagination = true;
+
+    ASSERT_EQ( 0, calcPageFileNumber( 0, 4, options ) ); //newest page
+    ASSERT_EQ( 3, calcPageFileNumber( 1, 4, options ) );
+    ASSERT_EQ( 2, calcPageFileNumber( 2, 4, options ) );
+    ASSERT_EQ( 1, calcPageFileNumber( 3, 4, options ) ); //oldest page
+}
+
+TEST( indexer_tests, makeSlug ) {
+    ASSERT_EQ( "my-first-post", makeSlug( "My first post!" ) );
+    ASSERT_EQ( "title-112-co", makeSlug( "Title 112 &amp; co" ) );
+    ASSERT_EQ( "emphasis-here", makeSlug( "<em>Emphasis</em> here" ) );
+    ASSERT_EQ( "news-my-post", makeSlug( "news/my post" ) );
+    ASSERT_EQ( "a-b", makeSlug( " a < b " ) );
+    ASSERT_EQ( "", makeSlug( "--" ) );
+}
+
+TEST( indexer_tests, makePathSlug ) {
+    ASSERT_EQ( "news--first-post", makePathSlug( "news/first-post.html" ) );
+    ASSERT_EQ( "a--b", makePathSlug( "a/b.html" ) );
+    ASSERT_EQ( "a-b", makePathSlug( "a-b.html" ) );
+    ASSERT_EQ( "news--my-post-" + makeHashSuffix( "My post", 6 ), makePathSlug( "news/My post.html" ) );
+    ASSERT_EQ( "my-post-" + makeHashSuffix( "My_post", 6 ), makePathSlug( "My_post.html" ) );
+    ASSERT_EQ( makeHashSuffix( "--", 6 ), makePathSlug( "--.html" ) );
+}
+
+TEST( indexer_tests, addSlugOutputPaths ) {
+    auto options = blogator::dto::Options();
+    options._paths.source_dir = "/site/source";
+    options._paths.posts_dir  = "/site/posts";
+    options._posts.file_names = blogator::dto::Options::Posts::FileNames::TITLE;
+
+    auto articles = blogator::dto::Index::Articles_t( 3 ); //newest to oldest
+    articles[0]._heading = "Same";
+    articles[0]._paths.src_html = "/site/source/c.html";
+    articles[0]._datestamp = blogator::dto::DateStamp( 2020, 3, 1 );
+    articles[1]._heading = "Same";
+    articles[1]._paths.src_html = "/site/source/b.html";
+    articles[1]._datestamp = blogator::dto::DateStamp( 2020, 2, 1 );
+    articles[2]._heading = "&#9733;"; //no ASCII letter/digit
+    articles[2]._paths.src_html = "/site/source/sub/a.html";
+    articles[2]._datestamp = blogator::dto::DateStamp( 2020, 1, 1 );
+
+    addSlugOutputPaths( options, articles );
+    ASSERT_EQ( "same-" + makeHashSuffix( "c.html", 6 ) + ".html", articles[0]._paths.out_html );
+    ASSERT_EQ( "same-" + makeHashSuffix( "b.html", 6 ) + ".html", articles[1]._paths.out_html );
+    ASSERT_EQ( "sub--a.html", articles[2]._paths.out_html );
+
+    options._posts.file_names = blogator::dto::Options::Posts::FileNames::SOURCE_PATH;
+    addSlugOutputPaths( options, articles );
+    ASSERT_EQ( "c.html", articles[0]._paths.out_html );
+    ASSERT_EQ( "b.html", articles[1]._paths.out_html );
+    ASSERT_EQ( "sub--a.html", articles[2]._paths.out_html );
+}
+
+TEST( indexer_tests, addSlugOutputPaths_stable ) {
+    using FileNames = blogator::dto::Options::Posts::FileNames;
+
+    auto options = blogator::dto::Options();
+    options._paths.source_dir = "/site/source";
+    options._paths.posts_dir  = "/site/posts";
+
+    auto articles = blogator::dto::Index::Articles_t( 2 ); //newest to oldest
+    articles[0]._heading = "Unique";
+    articles[0]._paths.src_html = "/site/source/a-b.html";
+    articles[0]._datestamp = blogator::dto::DateStamp( 2020, 3, 1 );
+    articles[1]._heading = "Other";
+    articles[1]._paths.src_html = "/site/source/news/Other.html";
+    articles[1]._datestamp = blogator::dto::DateStamp( 2020, 2, 1 );
+
+    auto backdated = blogator::dto::Article(); //same title and flattened source path as the newest post
+    backdated._heading = "Unique";
+    backdated._paths.src_html = "/site/source/a/b.html";
+    backdated._datestamp = blogator::dto::DateStamp( 2019, 1, 1 );
+
+    for( const auto mode : { FileNames::TITLE, FileNames::SOURCE_PATH } ) {
+        auto posts = articles;
+        options._posts.file_names = mode;
+
+        addSlugOutputPaths( options, posts );
+        const auto names = std::vector<std::filesystem::path>( { posts[0]._paths.out_html, posts[1]._paths.out_html } );
+
+        posts.emplace_back( backdated );
+        addSlugOutputPaths( options, posts );
+
+        ASSERT_EQ( names[0], posts[0]._paths.out_html );
+        ASSERT_EQ( names[1], posts[1]._paths.out_html );
+        ASSERT_NE( names[0], posts[2]._paths.out_html );
+
+        if( mode == FileNames::SOURCE_PATH ) {
+            ASSERT_EQ( "a-b.html", posts[0]._paths.out_html );
+            ASSERT_EQ( "a--b.html", posts[2]._paths.out_html );
+        }
+    }
+}
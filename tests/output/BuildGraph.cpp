@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include "../../src/output/BuildGraph.h"
+
+using blogator::output::BuildGraph;
+
+class BuildGraph_tests : public testing::Test {
+  protected:
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() / "blogator_tests" / "BuildGraph";
+        std::filesystem::remove_all( dir );
+        std::filesystem::create_directories( dir / "out" );
+
+        options = std::make_unique<blogator::dto::Options>();
+        options->_paths.root_dir    = dir;
+        options->_paths.temp_dir    = dir / "tmp";
+        options->_output.incremental = true;
+
+        page_a = dir / "out" / "a.html";
+        page_b = dir / "out" / "b.html";
+        std::ofstream( page_a ) << "a";
+        std::ofstream( page_b ) << "b";
+    }
+
+    void TearDown() override { std::filesystem::remove_all( dir ); }
+
+    /**
+     * Saves a first run's graph where 'a' is built from input 'src:a' and 'b' from 'src:b' at position 1
+     */
+    void savePreviousRun() {
+        auto graph = BuildGraph( *options );
+        ASSERT_FALSE( graph.load() );
+        graph.setInput( "src:a", 1 );
+        graph.setInput( "src:b", 2 );
+        ASSERT_TRUE( graph.update( page_a, { "src:a" } ) );
+        ASSERT_TRUE( graph.update( page_b, { "src:b", BuildGraph::valueKey( "position", "1" ) } ) );
+        graph.save();
+    }
+
+  public:
+    std::filesystem::path                   dir;
+    std::filesystem::path                   page_a;
+    std::filesystem::path                   page_b;
+    std::unique_ptr<blogator::dto::Options> options;
+};
+
+TEST_F( BuildGraph_tests, update_unchanged_inputs ) {
+    savePreviousRun();
+
+    auto graph = BuildGraph( *options );
+    ASSERT_TRUE( graph.load() );
+    ASSERT_TRUE( graph.incremental() );
+    graph.setInput( "src:a", 1 );
+    graph.setInput( "src:b", 2 );
+    ASSERT_FALSE( graph.update( page_a, { "src:a" } ) );
+    ASSERT_FALSE( graph.update( page_b, { "src:b", BuildGraph::valueKey( "position", "1" ) } ) );
+    ASSERT_EQ( 2, graph.outputCount() );
+    ASSERT_EQ( 0, graph.renderCount() );
+}
+
+TEST_F( BuildGraph_tests, update_changed_inputs ) {
+    savePreviousRun();
+
+    auto graph = BuildGraph( *options );
+    ASSERT_TRUE( graph.load() );
+    graph.setInput( "src:a", 10 ); //content changed
+    graph.setInput( "src:b", 2 );
+    ASSERT_TRUE( graph.update( page_a, { "src:a" } ) );
+    ASSERT_TRUE( graph.update( page_b, { "src:b", BuildGraph::valueKey( "position", "2" ) } ) ); //moved
+    ASSERT_EQ( 2, graph.renderCount() );
+}
+
+TEST_F( BuildGraph_tests, update_changed_input_list ) {
+    savePreviousRun();
+
+    auto graph = BuildGraph( *options );
+    ASSERT_TRUE( graph.load() );
+    graph.setInput( "src:a", 1 );
+    graph.setInput( "src:b", 2 );
+    ASSERT_TRUE( graph.update( page_a, { "src:a", "src:b" } ) );
+    ASSERT_TRUE( graph.update( page_b, { "src:b", "src:unknown" } ) );
+}
+
+TEST_F( BuildGraph_tests, update_missing_output ) {
+    savePreviousRun();
+    std::filesystem::remove( page_a );
+
+    auto graph = BuildGraph( *options );
+    ASSERT_TRUE( graph.load() );
+    graph.setInput( "src:a", 1 );
+    ASSERT_TRUE( graph.update( page_a, { "src:a" } ) );
+}
+
+TEST_F( BuildGraph_tests, update_not_incremental ) {
+    savePreviousRun();
+    options->_output.incremental = false;
+
+    auto graph = BuildGraph( *options );
+    ASSERT_TRUE( graph.load() );
+    ASSERT_FALSE( graph.incremental() );
+    graph.setInput( "src:a", 1 );
+    ASSERT_TRUE( graph.update( page_a, { "src:a" } ) );
+}
+
+TEST_F( BuildGraph_tests, removeStaleOutputs ) {
+    savePreviousRun();
+
+    auto graph = BuildGraph( *options );
+    ASSERT_TRUE( graph.load() );
+    graph.setInput( "src:a", 1 );
+    graph.update( page_a, { "src:a" } ); //'b' is not generated anymore
+    ASSERT_EQ( 1, graph.removeStaleOutputs() );
+    ASSERT_TRUE( std::filesystem::exists( page_a ) );
+    ASSERT_FALSE( std::filesystem::exists( page_b ) );
+}
+
+TEST_F( BuildGraph_tests, discard ) {
+    savePreviousRun();
+
+    auto graph = BuildGraph( *options );
+    ASSERT_TRUE( std::filesystem::exists( graph.path() ) );
+    graph.discard();
+    ASSERT_FALSE( std::filesystem::exists( graph.path() ) );
+    ASSERT_FALSE( graph.load() );
+}
+
+TEST( BuildGraph_Digest_tests, value ) {
+    ASSERT_EQ( BuildGraph::Digest().add( "abc" ).value(), BuildGraph::Digest().add( "abc" ).value() );
+    ASSERT_NE( BuildGraph::Digest().add( "abc" ).value(), BuildGraph::Digest().add( "abd" ).value() );
+    ASSERT_NE( BuildGraph::Digest().add( "ab" ).add( "c" ).value(), BuildGraph::Digest().add( "a" ).add( "bc" ).value() );
+}
@@ -0,0 +1,89 @@
+#include "gtest/gtest.h"
+#include <fstream>
+#include <sstream>
+
+#include "../../../src/output/generic/EntryWriter.h"
+#include "../../../src/html/reader/reader.h"
+
+using blogator::dto::Template;
+using blogator::output::generic::EntryWriter;
+
+namespace {
+    const auto test_dir = std::filesystem::temp_directory_path() / "blogator_EntryWriter_test";
+
+    std::shared_ptr<Template> makeTemplate( const std::vector<std::string> &lines ) {
+        auto tmpl = std::make_shared<Template>( Template::Type::INDEX_ENTRY );
+
+        tmpl->src           = test_dir / "templates" / "entry.html";
+        tmpl->html          = std::make_unique<blogator::dto::HTML>();
+        tmpl->block_classes = Template::BlockInsertClasses_t( { { "post-number", false }, { "title", false } } );
+        tmpl->html->_lines  = lines;
+
+        tmpl->path_write_pos  = blogator::dto::Templates::extractRelativePaths( *tmpl->html );
+        tmpl->block_write_pos = blogator::html::reader::getConsecutiveWritePositions( *tmpl->html, tmpl->block_classes );
+        tmpl->compile();
+
+        return tmpl;
+    }
+
+    blogator::dto::Article makeArticle( size_t number, const std::string &heading ) {
+        auto article = blogator::dto::Article();
+
+        article._number         = number;
+        article._heading        = heading;
+        article._paths.src_html = test_dir / "source" / ( heading + ".html" );
+
+        return article;
+    }
+
+    std::string render( const EntryWriter &writer, const std::filesystem::path &path, const blogator::dto::Article &article ) {
+        std::filesystem::create_directories( path.parent_path() );
+
+        {
+            auto page = blogator::dto::Page( path );
+            writer.write( page, "\t", article );
+        }
+
+        auto in = std::ifstream( path );
+        auto ss = std::stringstream();
+        ss << in.rdbuf();
+        return ss.str();
+    }
+}
+
+TEST( EntryWriter_tests, write ) {
+    auto options = std::make_shared<blogator::dto::Options>();
+    auto writer  = EntryWriter( options, makeTemplate( {
+        "<div class=\"entry\">",
+        "\t<span class=\"post-number\"></span><img src=\"img/a.png\"/> <h2 class=\"title\"></h2>",
+        "</div>"
+    } ) );
+
+    auto article = makeArticle( 7, "post" );
+
+    const auto expected = "\t\t<div class=\"entry\">\n"
+                          "\t\t\t<span class=\"post-number\">7</span><img src=\"../templates/img/a.png\"/> <h2 class=\"title\">post</h2>\n"
+                          "\t\t</div>\n";
+
+    ASSERT_EQ( expected, render( writer, test_dir / "out" / "0.html", article ) );
+    ASSERT_EQ( expected, render( writer, test_dir / "out" / "1.html", article ) ); //cached fragment
+    ASSERT_EQ( "\t\t<div class=\"entry\">\n"
+               "\t\t\t<span class=\"post-number\">7</span><img src=\"../../templates/img/a.png\"/> <h2 class=\"title\">post</h2>\n"
+               "\t\t</div>\n",
+               render( writer, test_dir / "out" / "sub" / "0.html", article ) ); //different output directory
+}
+
+TEST( EntryWriter_tests, write_custom ) {
+    auto options = std::make_shared<blogator::dto::Options>();
+    auto writer  = EntryWriter( options, makeTemplate( { "<div class=\"title\"></div>" } ) );
+    auto copy    = writer;
+
+    auto article1 = makeArticle( 1, "default" );
+    auto article2 = makeArticle( 2, "custom" );
+
+    article2._cust_index_entry = makeTemplate( { "<p class=\"post-number\"></p>" } );
+
+    ASSERT_EQ( "\t\t<div class=\"title\">default</div>\n", render( writer, test_dir / "out" / "a.html", article1 ) );
+    ASSERT_EQ( "\t\t<p class=\"post-number\">2</p>\n", render( writer, test_dir / "out" / "a.html", article2 ) );
+    ASSERT_EQ( "\t\t<p class=\"post-number\">2</p>\n", render( copy, test_dir / "out" / "b.html", article2 ) );
+}
@@ -0,0 +1,184 @@
+#include "gtest/gtest.h"
+#include <fstream>
+#include <sstream>
+
+#include "../../../src/output/helper/TemplateRenderer.h"
+#include "../../../src/html/reader/reader.h"
+#include "../../../src/html/html.h"
+#include "../../../src/fs/fs.h"
+
+using blogator::dto::Template;
+using blogator::output::helper::TemplateRenderer;
+
+namespace {
+    typedef TemplateRenderer::BlockWriter_t BlockWriter_t;
+
+    /**
+     * Reference implementation (previous per-line writer loops of the landing/post pages, listers and entries)
+     */
+    void referenceWrite( blogator::dto::Page &page, const Template &tmpl, TemplateRenderer::Layout layout,
+                         const BlockWriter_t &block_writer, const std::string &outer )
+    {
+        auto block_it = tmpl.block_write_pos.cbegin();
+        auto path_it  = tmpl.path_write_pos.cbegin();
+
+        for( size_t line_i = 0; line_i < tmpl.html->_lines.size(); ++line_i ) {
+            const auto &line = tmpl.html->_lines[ line_i ];
+
+            auto hasBlock = [&]() { return ( block_it != tmpl.block_write_pos.cend() && block_it->first.line == line_i ); };
+            auto hasPath  = [&]() { return ( path_it  != tmpl.path_write_pos.cend()  && path_it->first.line  == line_i ); };
+            auto path     = [&]() { return blogator::html::encodePathToURL( blogator::fs::adaptRelPath( tmpl.src, page._abs_path, path_it->second.string() ).string() ); };
+
+            std::string::size_type col = 0;
+            const auto indent          = blogator::html::reader::getIndent( line );
+            const auto total_indent    = outer + indent;
+            bool       carriage_return = ( layout == TemplateRenderer::Layout::ENTRY );
+
+            if( !hasBlock() && !hasPath() ) {
+                page._out << ( layout == TemplateRenderer::Layout::ENTRY ? outer : "" ) << line << "\n";
+                continue;
+            }
+
+            while( hasBlock() || hasPath() ) {
+                if( hasBlock() && ( !hasPath() || block_it->first.col < path_it->first.col ) ) {
+                    if( layout == TemplateRenderer::Layout::PAGE ) {
+                        page._out << line.substr( col, block_it->first.col - col ) << "\n";
+                        block_writer( page, indent + "\t", block_it->second );
+                        page._out << indent;
+
+                    } else if( layout == TemplateRenderer::Layout::LIST ) {
+                        if( carriage_return )
+                            page._out << indent;
+
+                        page._out << line.substr( col, block_it->first.col - col );
+
+                        if( ( carriage_return = block_writer( page, indent, block_it->second ) ) )
+                            page._out << indent;
+
+                    } else {
+                        if( carriage_return )
+                            page._out << outer;
+
+                        page._out << line.substr( col, block_it->first.col - col );
+
+                        if( ( carriage_return = block_writer( page, total_indent + "\t", block_it->second ) ) )
+                            page._out << total_indent;
+                    }
+
+                    col = block_it->first.col;
+                    ++block_it;
+
+                } else {
+                    page._out << line.substr( col, path_it->first.col - col ) << path();
+                    col = path_it->first.col;
+                    ++path_it;
+                }
+            }
+
+            page._out << line.substr( col ) << "\n";
+        }
+    }
+
+    std::string render( const std::function<void( blogator::dto::Page & )> &writer ) {
+        const auto path = std::filesystem::temp_directory_path() / "blogator_TemplateRenderer_test" / "out" / "page.html";
+        std::filesystem::create_directories( path.parent_path() );
+
+        auto page = blogator::dto::Page( path );
+        writer( page );
+        page._out.close();
+
+        auto in = std::ifstream( path );
+        auto ss = std::stringstream();
+        ss << in.rdbuf();
+        return ss.str();
+    }
+
+    std::unique_ptr<Template> makeTemplate() {
+        auto tmpl = std::make_unique<Template>( Template::Type::INDEX );
+
+        tmpl->src           = std::filesystem::temp_directory_path() / "blogator_TemplateRenderer_test" / "templates" / "template.html";
+        tmpl->html          = std::make_unique<blogator::dto::HTML>();
+        tmpl->block_classes = Template::BlockInsertClasses_t( { { "a", false }, { "b", false } } );
+        tmpl->html->_lines  = {
+            "<html>",
+            "\t<div class=\"a\"></div><div class=\"b\"></div>",
+            "  <img src=\"img/y.png\"/><div class=\"a\"></div>",
+            "\t\t<div class=\"b\"></div> <a href=\"p/q.html\">l</a> <div class=\"a\"></div><div class=\"a\"></div>",
+            "    <img src=\"img/i.png\"/> <img src=\"../k.png\"/>",
+            "",
+            "\t<div class=\"b\"></div>",
+            "</html>"
+        };
+
+        tmpl->path_write_pos  = blogator::dto::Templates::extractRelativePaths( *tmpl->html );
+        tmpl->block_write_pos = blogator::html::reader::getConsecutiveWritePositions( *tmpl->html, tmpl->block_classes );
+
+        return tmpl;
+    }
+
+    bool writeBlock( blogator::dto::Page &page, const std::string &indent, const std::string &block_class ) {
+        if( block_class == "a" ) {
+            page._out << "\n" << indent << "[A]\n";
+            return true;
+        }
+
+        page._out << "[B]";
+        return false;
+    }
+}
+
+TEST( TemplateRenderer_tests, plan ) {
+    auto tmpl = makeTemplate();
+    tmpl->compile();
+
+    const auto &plan = *tmpl->plan;
+
+    ASSERT_EQ( 8, plan.lines.size() );
+    ASSERT_FALSE( plan.lines[ 0 ].hasSlots() );
+    ASSERT_TRUE( plan.lines[ 1 ].hasSlots() );
+    ASSERT_EQ( "\t", plan.lines[ 1 ].indent );
+    ASSERT_EQ( "\t\t", plan.lines[ 1 ].block_indent );
+    ASSERT_EQ( std::vector<std::filesystem::path>( { "img/y.png", "p/q.html", "img/i.png", "../k.png" } ), plan.paths );
+    ASSERT_EQ( std::vector<std::string>( { "a", "b", "a", "b", "a", "b" } ), plan.blocks ); //one insertion point per class per line
+
+    const auto &line = plan.lines[ 2 ]; //"  <img src=""/><div class="a"></div>"
+    ASSERT_EQ( 3, line.end - line.begin );
+    ASSERT_EQ( "  <img src=\"", plan.literal( plan.segments[ line.begin ] ) );
+    ASSERT_EQ( blogator::dto::RenderPlan::SlotType::PATH, plan.segments[ line.begin ].slot );
+    ASSERT_EQ( "\"/><div class=\"a\">", plan.literal( plan.segments[ line.begin + 1 ] ) );
+    ASSERT_EQ( blogator::dto::RenderPlan::SlotType::BLOCK, plan.segments[ line.begin + 1 ].slot );
+    ASSERT_EQ( "</div>", plan.literal( plan.segments[ line.begin + 2 ] ) );
+    ASSERT_EQ( blogator::dto::RenderPlan::SlotType::NONE, plan.segments[ line.begin + 2 ].slot );
+}
+
+TEST( TemplateRenderer_tests, eq_reference ) {
+    auto tmpl = makeTemplate();
+    tmpl->compile();
+
+    for( auto layout : { TemplateRenderer::Layout::PAGE, TemplateRenderer::Layout::LIST, TemplateRenderer::Layout::ENTRY } ) {
+        for( const auto &outer : { std::string(), std::string( "\t\t" ) } ) {
+            if( layout != TemplateRenderer::Layout::ENTRY && !outer.empty() )
+                continue;
+
+            const auto renderer = TemplateRenderer( *tmpl, layout );
+            const auto expected = render( [&]( blogator::dto::Page &page ) { referenceWrite( page, *tmpl, layout, writeBlock, outer ); } );
+            const auto result   = render( [&]( blogator::dto::Page &page ) { renderer.write( page, writeBlock, outer ); } );
+
+            EXPECT_EQ( expected, result ) << "layout: " << static_cast<int>( layout ) << ", outer: \"" << outer << "\"";
+        }
+    }
+}
+
+TEST( TemplateRenderer_tests, write_range ) {
+    auto tmpl     = makeTemplate();
+    auto renderer = TemplateRenderer( *tmpl, TemplateRenderer::Layout::LIST ); //plan compiled on the fly
+
+    const auto expected = render( [&]( blogator::dto::Page &page ) { renderer.write( page, writeBlock ); } );
+    const auto result   = render( [&]( blogator::dto::Page &page ) {
+        renderer.write( page, 0, 3, writeBlock );
+        renderer.write( page, 3, 100, writeBlock );
+    } );
+
+    ASSERT_EQ( 8, renderer.lineCount() );
+    ASSERT_EQ( expected, result );
+}
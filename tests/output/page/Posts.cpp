@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <map>
+
+#include "../../../src/output/page/Posts.h"
+#include "../../../src/indexer/indexer.h"
+#include "../../../src/fs/fs.h"
+
+using blogator::output::page::Posts;
+using blogator::output::BuildGraph;
+
+class Posts_tests : public testing::Test {
+  protected:
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() / "blogator_tests" / "Posts";
+        std::filesystem::remove_all( dir );
+        std::filesystem::create_directories( dir );
+    }
+
+    void TearDown() override { std::filesystem::remove_all( dir ); }
+
+    /**
+     * Creates a site from the example site with extra posts
+     * @param name   Site folder name
+     * @param config Configuration lines to append to the example's
+     * @return Options of the site
+     */
+    std::shared_ptr<blogator::dto::Options> makeSite( const std::string &name, const std::string &config ) {
+        const auto root = dir / name;
+
+        std::filesystem::copy( example_dir, root, std::filesystem::copy_options::recursive );
+        std::ofstream( root / "blogator.cfg", std::ios::app ) << "\n" << config << "\n";
+
+        for( int i = 1; i <= 24; ++i ) {
+            auto day = std::to_string( i );
+            std::ofstream( root / "source" / ( "post_" + day + ".html" ) )
+                << "<div>\n"
+                << "    <h1><span class=\"title\">Post " << day << "</span></h1>\n"
+                << "    <time datetime=\"2019-03-" << ( i < 10 ? "0" : "" ) << day << "\">" << day << " March 2019</time>\n"
+                << "    <span class=\"author\">Author " << ( i % 2 ) << "</span>\n"
+                << "    <span class=\"tag\">Tag " << ( i % 3 ) << "</span>\n"
+                << "    <p><span class=\"summary\">Summary " << day << "</span> <img src=\"../img/smiley.svg\"/></p>\n"
+                << "</div>\n";
+        }
+
+        auto options = blogator::fs::importOptions( root / "blogator.cfg" );
+        options->setupAbsolutePaths( root );
+        options->setTempPath( root / "tmp" );
+        return options;
+    }
+
+    /**
+     * Writes the post pages of a site
+     * @param options Site options
+     */
+    static void writePosts( const std::shared_ptr<blogator::dto::Options> &options ) {
+        blogator::fs::setupEnvironment( options );
+
+        auto index     = blogator::indexer::index( options );
+        auto templates = blogator::fs::importTemplates( *index, *options );
+        auto posts     = Posts( index, templates, options, std::make_shared<BuildGraph>( *options ) );
+
+        ASSERT_TRUE( posts.init() );
+    }
+
+    /**
+     * Reads all the files in a folder
+     * @param folder Folder path
+     * @return Content of the files {K=path relative to the folder, V=content}
+     */
+    static std::map<std::string, std::string> readFiles( const std::filesystem::path &folder ) {
+        auto files = std::map<std::string, std::string>();
+
+        for( const auto &p : std::filesystem::recursive_directory_iterator( folder ) ) {
+            if( p.is_regular_file() ) {
+                auto ss = std::stringstream();
+                ss << std::ifstream( p.path() ).rdbuf();
+                files.emplace( p.path().lexically_relative( folder ).string(), ss.str() );
+            }
+        }
+
+        return files;
+    }
+
+  public:
+    const std::filesystem::path example_dir = std::filesystem::path( __FILE__ ).parent_path() / "../../../resources/example";
+    std::filesystem::path       dir;
+};
+
+TEST_F( Posts_tests, init_jobs_match_serial ) {
+    auto serial   = makeSite( "serial", "" );
+    auto parallel = makeSite( "parallel", "" );
+
+    serial->setJobCount( 1 );
+    parallel->setJobCount( 4 );
+
+    writePosts( serial );
+    writePosts( parallel );
+
+    const auto serial_files = readFiles( serial->_paths.posts_dir );
+
+    ASSERT_EQ( 3 + 24, serial_files.size() ); //example + generated posts
+    ASSERT_EQ( serial_files, readFiles( parallel->_paths.posts_dir ) );
+}
+
+TEST_F( Posts_tests, init_writes_tag_pane ) {
+    auto options = makeSite( "tags", "" );
+
+    writePosts( options );
+
+    const auto files = readFiles( options->_paths.posts_dir );
+    size_t     pages = 0;
+
+    for( const auto &[name, content] : files ) {
+        if( std::filesystem::path( name ).extension() != ".html" )
+            continue;
+
+        const auto pane = content.find( "<div class=\"index-pane-tags\">" );
+        const auto tree = content.find( "<ol class=\"tree\">", pane );
+
+        ASSERT_NE( std::string::npos, pane ) << name;
+        ASSERT_NE( std::string::npos, tree ) << name;
+        ASSERT_NE( std::string::npos, content.find( ">Tag 1</label>", tree ) ) << name;
+        ++pages;
+    }
+
+    ASSERT_EQ( 3 + 24, pages );
+}
+
+TEST_F( Posts_tests, init_writes_tag_pane_ssi ) {
+    auto options = makeSite( "ssi", "ssi-index-panes = true;" );
+
+    writePosts( options );
+
+    const auto files    = readFiles( options->_paths.posts_dir );
+    const auto fragment = files.find( "ssi/index-pane-tags.html" );
+    size_t     pages    = 0;
+
+    ASSERT_NE( files.end(), fragment );
+    ASSERT_NE( std::string::npos, fragment->second.find( ">Tag 1</label>" ) );
+
+    for( const auto &[name, content] : files ) {
+        if( std::filesystem::path( name ).parent_path() == "ssi" || std::filesystem::path( name ).extension() != ".html" )
+            continue;
+
+        const auto style = content.find( "<style>" );
+        const auto pane  = content.find( "<div class=\"index-pane-tags\">" );
+
+        ASSERT_NE( std::string::npos, style ) << name;
+        ASSERT_NE( std::string::npos, content.find( "#checkbox_t", style ) ) << name; //article's tags expanded
+        ASSERT_NE( std::string::npos, content.find( ".tree a[href=\"" + name + "\"]", style ) ) << name;
+        ASSERT_NE( std::string::npos, pane ) << name;
+        ASSERT_NE( std::string::npos, content.find( "<!--#include virtual=\"ssi/index-pane-tags.html\" -->", pane ) ) << name;
+        ASSERT_EQ( std::string::npos, content.find( ">Tag 1</label>" ) ) << name;
+        ++pages;
+    }
+
+    ASSERT_EQ( 3 + 24, pages );
+}